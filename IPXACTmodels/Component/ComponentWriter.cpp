@@ -34,6 +34,132 @@
 #include <IPXACTmodels/common/ChoiceWriter.h>
 #include <IPXACTmodels/kactusExtensions/FileDependency.h>
 
+#include <QtConcurrent/QtConcurrentMap>
+#include <QVector>
+
+#include <functional>
+
+//-----------------------------------------------------------------------------
+//! Collects the component sections to be serialized in parallel.
+//!
+//! The document writer marks the position of each section with an empty placeholder element. An empty element
+//! leaves the writer in the same formatting state as a written section, so the rest of the document is
+//! unaffected. Each section is then written by its own writer nested in dummy elements to the depth of the
+//! section and the placeholders are replaced with the resulting text.
+//-----------------------------------------------------------------------------
+class ComponentWriter::ParallelSections
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] autoFormattingIndent    The indentation used by the document writer.
+     */
+    explicit ParallelSections(int autoFormattingIndent): autoFormattingIndent_(autoFormattingIndent) {}
+
+    /*!
+     *  Add a section in the current position of the document.
+     *
+     *    @param [in] writer      The document writer.
+     *    @param [in] depth       The number of elements enclosing the section.
+     *    @param [in] write       Writes the section.
+     */
+    void add(QXmlStreamWriter& writer, int depth, std::function<void(QXmlStreamWriter&)> write)
+    {
+        QString placeholderName = QStringLiteral("kactus2Section%1").arg(sections_.size());
+        writer.writeEmptyElement(placeholderName);
+
+        QByteArray indentation(qAbs(autoFormattingIndent_) * depth, autoFormattingIndent_ < 0 ? '\t' : ' ');
+
+        Section section;
+        section.placeholder = '\n' + indentation + '<' + placeholderName.toUtf8() + "/>";
+        section.depth = depth;
+        section.write = write;
+        sections_.append(section);
+    }
+
+    /*!
+     *  Serialize the sections concurrently and replace the placeholders in the document with them.
+     *
+     *    @param [in] document    The document containing the placeholders.
+     *
+     *    @return The complete document.
+     */
+    QByteArray splice(QByteArray const& document) const
+    {
+        QVector<QByteArray> serialized = QtConcurrent::blockingMapped<QVector<QByteArray> >(sections_,
+            [this](Section const& section) { return serialize(section); });
+
+        qsizetype totalSize = document.size();
+        for (QByteArray const& sectionText : serialized)
+        {
+            totalSize += sectionText.size();
+        }
+
+        QByteArray result;
+        result.reserve(totalSize);
+
+        qsizetype position = 0;
+        for (int i = 0; i < sections_.size(); ++i)
+        {
+            qsizetype placeholderPosition = document.indexOf(sections_.at(i).placeholder, position);
+            Q_ASSERT(placeholderPosition >= 0);
+
+            result.append(document.constData() + position, placeholderPosition - position);
+            result.append(serialized.at(i));
+            position = placeholderPosition + sections_.at(i).placeholder.size();
+        }
+
+        result.append(document.constData() + position, document.size() - position);
+        return result;
+    }
+
+private:
+
+    //! A section of the document.
+    struct Section
+    {
+        //! The placeholder text in the document.
+        QByteArray placeholder;
+
+        //! The number of elements enclosing the section.
+        int depth = 0;
+
+        //! Writes the section.
+        std::function<void(QXmlStreamWriter&)> write;
+    };
+
+    /*!
+     *  Serialize a section as it would be written in the document.
+     */
+    QByteArray serialize(Section const& section) const
+    {
+        QByteArray output;
+        QXmlStreamWriter writer(&output);
+        writer.setAutoFormatting(true);
+        writer.setAutoFormattingIndent(autoFormattingIndent_);
+
+        for (int i = 0; i < section.depth; ++i)
+        {
+            writer.writeStartElement(QStringLiteral("kactus2Enclosing"));
+        }
+
+        // The start tag of the innermost enclosing element is closed only when the section is written.
+        qsizetype sectionStart = output.size() + 1;
+
+        section.write(writer);
+
+        return output.mid(sectionStart);
+    }
+
+    //! The indentation used by the document writer.
+    int autoFormattingIndent_;
+
+    //! The sections in document order.
+    QVector<Section> sections_;
+};
+
 //-----------------------------------------------------------------------------
 // Function: ComponentWriter::ComponentWriter()
 //-----------------------------------------------------------------------------
@@ -46,6 +172,31 @@ ComponentWriter::ComponentWriter() : DocumentWriter()
 // Function: ComponentWriter::writeComponent()
 //-----------------------------------------------------------------------------
 void ComponentWriter::writeComponent(QXmlStreamWriter& writer, QSharedPointer<Component> component) const
+{
+    writeComponentDocument(writer, component, nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentWriter::writeComponent()
+//-----------------------------------------------------------------------------
+QByteArray ComponentWriter::writeComponent(QSharedPointer<Component> component) const
+{
+    QByteArray document;
+    QXmlStreamWriter writer(&document);
+    writer.setAutoFormatting(true);
+    writer.setAutoFormattingIndent(-1);
+
+    ParallelSections sections(writer.autoFormattingIndent());
+    writeComponentDocument(writer, component, &sections);
+
+    return sections.splice(document);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentWriter::writeComponentDocument()
+//-----------------------------------------------------------------------------
+void ComponentWriter::writeComponentDocument(QXmlStreamWriter& writer, QSharedPointer<Component> component,
+    ParallelSections* sections) const
 {
     writer.writeStartDocument();
 
@@ -73,15 +224,15 @@ void ComponentWriter::writeComponent(QXmlStreamWriter& writer, QSharedPointer<Co
 
     writeAddressSpaces(writer, component);
 
-    writeMemoryMaps(writer, component);
+    writeMemoryMaps(writer, component, sections);
 
-    writeModel(writer, component);
+    writeModel(writer, component, sections);
     
     writeComponentGenerators(writer, component);
 
     writeChoices(writer, component);
 
-    writeFileSets(writer, component);
+    writeFileSets(writer, component, sections);
 
     writeCPUs(writer, component);
 
@@ -233,10 +384,20 @@ void ComponentWriter::writeAddressSpaces(QXmlStreamWriter& writer, QSharedPointe
 //-----------------------------------------------------------------------------
 // Function: ComponentWriter::writeMemoryMaps()
 //-----------------------------------------------------------------------------
-void ComponentWriter::writeMemoryMaps(QXmlStreamWriter& writer, QSharedPointer<Component> component) const
+void ComponentWriter::writeMemoryMaps(QXmlStreamWriter& writer, QSharedPointer<Component> component,
+    ParallelSections* sections) const
 {
     if (!component->getMemoryMaps()->isEmpty())
     {
+        if (sections != nullptr)
+        {
+            sections->add(writer, 1, [this, component](QXmlStreamWriter& sectionWriter)
+                {
+                    writeMemoryMaps(sectionWriter, component);
+                });
+            return;
+        }
+
         writer.writeStartElement(QStringLiteral("ipxact:memoryMaps"));
 
         for (auto const& memoryMap : *component->getMemoryMaps())
@@ -251,7 +412,8 @@ void ComponentWriter::writeMemoryMaps(QXmlStreamWriter& writer, QSharedPointer<C
 //-----------------------------------------------------------------------------
 // Function: ComponentWriter::writeModel()
 //-----------------------------------------------------------------------------
-void ComponentWriter::writeModel(QXmlStreamWriter& writer, QSharedPointer<Component> component) const
+void ComponentWriter::writeModel(QXmlStreamWriter& writer, QSharedPointer<Component> component,
+    ParallelSections* sections) const
 {
     if (component->getModel()->hasContents())
     {
@@ -261,7 +423,7 @@ void ComponentWriter::writeModel(QXmlStreamWriter& writer, QSharedPointer<Compon
 
         writeInstantiations(writer, component);
 
-        writePorts(writer, component);
+        writePorts(writer, component, sections);
 
         writer.writeEndElement(); // ipxact:model
     }
@@ -317,10 +479,20 @@ void ComponentWriter::writeInstantiations(QXmlStreamWriter& writer, QSharedPoint
 //-----------------------------------------------------------------------------
 // Function: ComponentWriter::writePorts()
 //-----------------------------------------------------------------------------
-void ComponentWriter::writePorts(QXmlStreamWriter& writer, QSharedPointer<Component> component) const
+void ComponentWriter::writePorts(QXmlStreamWriter& writer, QSharedPointer<Component> component,
+    ParallelSections* sections) const
 {
     if (!component->getPorts()->isEmpty())
     {
+        if (sections != nullptr)
+        {
+            sections->add(writer, 2, [this, component](QXmlStreamWriter& sectionWriter)
+                {
+                    writePorts(sectionWriter, component);
+                });
+            return;
+        }
+
         PortWriter portWriter;
 
         writer.writeStartElement(QStringLiteral("ipxact:ports"));
@@ -374,10 +546,20 @@ void ComponentWriter::writeChoices(QXmlStreamWriter& writer, QSharedPointer<Comp
 //-----------------------------------------------------------------------------
 // Function: ComponentWriter::writeFileSets()
 //-----------------------------------------------------------------------------
-void ComponentWriter::writeFileSets(QXmlStreamWriter& writer, QSharedPointer<Component> component) const
+void ComponentWriter::writeFileSets(QXmlStreamWriter& writer, QSharedPointer<Component> component,
+    ParallelSections* sections) const
 {
     if (!component->getFileSets()->isEmpty())
     {
+        if (sections != nullptr)
+        {
+            sections->add(writer, 1, [this, component](QXmlStreamWriter& sectionWriter)
+                {
+                    writeFileSets(sectionWriter, component);
+                });
+            return;
+        }
+
         writer.writeStartElement(QStringLiteral("ipxact:fileSets"));
 
         for (QSharedPointer<FileSet> fileSet : *component->getFileSets())
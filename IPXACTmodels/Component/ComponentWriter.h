@@ -16,6 +16,7 @@
 #include <IPXACTmodels/common/DocumentWriter.h>
 
 #include <QXmlStreamWriter>
+#include <QByteArray>
 #include <QSharedPointer>
 
 class Component;
@@ -45,12 +46,37 @@ public:
      */
     void writeComponent(QXmlStreamWriter& writer, QSharedPointer<Component> component) const;
 
+    /*!
+     *  Write a component to an XML document using auto-formatting with tab indentation.
+     *
+     *  The memory maps, ports and file sets are serialized into separate buffers concurrently and spliced
+     *  into the document in order. The result is identical to writing the component with a single writer.
+     *
+     *    @param [in] component   The component to be written.
+     *
+     *    @return The XML document.
+     */
+    QByteArray writeComponent(QSharedPointer<Component> component) const;
+
 private:
 
+    //! Collects the component sections to be serialized in parallel.
+    class ParallelSections;
+
     //! No copying allowed.
     ComponentWriter(ComponentWriter const& rhs);
     ComponentWriter& operator=(ComponentWriter const& rhs);
 
+    /*!
+     *  Write the component document.
+     *
+     *    @param [in] writer      The used XML writer.
+     *    @param [in] component   The component to be written.
+     *    @param [in] sections    Collector of the sections serialized in parallel, or null to write in place.
+     */
+    void writeComponentDocument(QXmlStreamWriter& writer, QSharedPointer<Component> component,
+        ParallelSections* sections) const;
+
     /*!
      *  Write the bus interfaces.
      *
@@ -98,16 +124,20 @@ private:
      *
      *    @param [in] writer      The used XML writer.
      *    @param [in] component   The component being written.
+     *    @param [in] sections    Collector of the sections serialized in parallel, or null to write in place.
      */
-    void writeMemoryMaps(QXmlStreamWriter& writer, QSharedPointer<Component> component) const;
+    void writeMemoryMaps(QXmlStreamWriter& writer, QSharedPointer<Component> component,
+        ParallelSections* sections = nullptr) const;
 
     /*!
      *  Write the model.
      *
      *    @param [in] writer      The used XML writer.
      *    @param [in] component   The component being written.
+     *    @param [in] sections    Collector of the sections serialized in parallel, or null to write in place.
      */
-    void writeModel(QXmlStreamWriter& writer, QSharedPointer<Component> component) const;
+    void writeModel(QXmlStreamWriter& writer, QSharedPointer<Component> component,
+        ParallelSections* sections = nullptr) const;
 
     /*!
      *  Write the views.
@@ -130,8 +160,10 @@ private:
      *
      *    @param [in] writer      The used XML writer.
      *    @param [in] component   The component being written.
+     *    @param [in] sections    Collector of the sections serialized in parallel, or null to write in place.
      */
-    void writePorts(QXmlStreamWriter& writer, QSharedPointer<Component> component) const;
+    void writePorts(QXmlStreamWriter& writer, QSharedPointer<Component> component,
+        ParallelSections* sections = nullptr) const;
 
     /*!
      *  Write the component generators.
@@ -154,8 +186,10 @@ private:
      *
      *    @param [in] writer      The used XML writer.
      *    @param [in] component   The component being written.
+     *    @param [in] sections    Collector of the sections serialized in parallel, or null to write in place.
      */
-    void writeFileSets(QXmlStreamWriter& writer, QSharedPointer<Component> component) const;
+    void writeFileSets(QXmlStreamWriter& writer, QSharedPointer<Component> component,
+        ParallelSections* sections = nullptr) const;
 
     /*!
      *  Write the cpus.
@@ -36,7 +36,7 @@ EnumeratedValueReader::~EnumeratedValueReader()
 QSharedPointer<EnumeratedValue> EnumeratedValueReader::createEnumeratedValueFrom
     (QDomNode const& enumeratedValueNode) const
 {
-    QSharedPointer<EnumeratedValue> newEnumeratedValue (new EnumeratedValue());
+    QSharedPointer<EnumeratedValue> newEnumeratedValue = QSharedPointer<EnumeratedValue>::create();
 
     parseUsage(enumeratedValueNode, newEnumeratedValue);
 
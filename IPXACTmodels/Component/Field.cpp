@@ -28,12 +28,12 @@ Extendable(),
 id_(),
 isPresent_(),
 bitOffset_(),
-resets_(new QList<QSharedPointer<FieldReset> >()),
+resets_(QSharedPointer<QList<QSharedPointer<FieldReset> > >::create()),
 typeIdentifier_(),
 bitWidth_(),
 volatile_(),
 access_(AccessTypes::ACCESS_COUNT),
-enumeratedValues_(new QList<QSharedPointer<EnumeratedValue> > ()),
+enumeratedValues_(QSharedPointer<QList<QSharedPointer<EnumeratedValue> > >::create()),
 modifiedWrite_(General::MODIFIED_WRITE_COUNT),
 modifiedWriteModify_(),
 writeValueConstraint_(),
@@ -42,7 +42,7 @@ readActionModify_(),
 testable_(),
 testConstraint_(General::TESTCONSTRAINT_COUNT),
 reserved_(),
-parameters_(new QList<QSharedPointer<Parameter> > ())
+parameters_(QSharedPointer<QList<QSharedPointer<Parameter> > >::create())
 {
 
 }
@@ -58,12 +58,12 @@ isPresent_(other.isPresent_),
 bitOffset_(other.bitOffset_),
 fieldDefinitionRef_(other.fieldDefinitionRef_),
 typeDefinitionsRef_(other.typeDefinitionsRef_),
-resets_(new QList<QSharedPointer<FieldReset> >()),
+resets_(QSharedPointer<QList<QSharedPointer<FieldReset> > >::create()),
 typeIdentifier_(other.typeIdentifier_),
 bitWidth_(other.bitWidth_),
 volatile_(other.volatile_),
 access_(other.access_),
-enumeratedValues_(new QList<QSharedPointer<EnumeratedValue> > ()),
+enumeratedValues_(QSharedPointer<QList<QSharedPointer<EnumeratedValue> > >::create()),
 modifiedWrite_(other.modifiedWrite_),
 modifiedWriteModify_(other.modifiedWriteModify_),
 readAction_(other.readAction_),
@@ -71,7 +71,7 @@ readActionModify_(other.readActionModify_),
 testable_(other.testable_),
 testConstraint_(other.testConstraint_),
 reserved_(other.reserved_),
-parameters_(new QList<QSharedPointer<Parameter> > ())
+parameters_(QSharedPointer<QList<QSharedPointer<Parameter> > >::create())
 {
     Copy::copyList(other.enumeratedValues_, enumeratedValues_);
     Copy::copyList(other.parameters_, parameters_);
@@ -482,7 +482,7 @@ private:
 	
 	//! The field access policies of the field, for standard revision 2022.
 	QSharedPointer<QList<QSharedPointer<FieldAccessPolicy> > > fieldAccessPolicies_ = 
-		QSharedPointer<QList<QSharedPointer<FieldAccessPolicy> > >(new QList<QSharedPointer<FieldAccessPolicy> > ());
+		QSharedPointer<QList<QSharedPointer<FieldAccessPolicy> > >::create();
 };
 
 Q_DECLARE_METATYPE(QSharedPointer<Field>);
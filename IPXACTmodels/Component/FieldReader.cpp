@@ -19,6 +19,7 @@
 #include "FieldAccessPolicyReader.h"
 
 #include <IPXACTmodels/common/NameGroupReader.h>
+#include <IPXACTmodels/common/StringPool.h>
 
 //-----------------------------------------------------------------------------
 // Function: FieldReader::createFieldFrom()
@@ -27,7 +28,7 @@ QSharedPointer<Field> FieldReader::createFieldFrom(QDomNode const& fieldNode, Do
 {
     QDomElement fieldElement = fieldNode.toElement();
 
-    QSharedPointer<Field> newField (new Field());
+    QSharedPointer<Field> newField = QSharedPointer<Field>::create();
 
     NameGroupReader::parseNameGroup(fieldNode, newField);
     
@@ -144,7 +145,7 @@ void FieldReader::Details::parseResets(QDomElement const& fieldElement, QSharedP
         {
             QDomElement resetElement = resetNodeList.at(resetIndex).toElement();
 
-            QSharedPointer<FieldReset> fldReset = QSharedPointer<FieldReset>(new FieldReset());
+            QSharedPointer<FieldReset> fldReset = QSharedPointer<FieldReset>::create();
 
             parseResetTypeRef(resetElement, fldReset);
             parseResetValue(resetElement, fldReset);
@@ -163,7 +164,7 @@ void FieldReader::Details::parseResetTypeRef(QDomElement const& resetElement, QS
 {
   if (resetElement.hasAttribute(QStringLiteral("resetTypeRef")))
   {
-      fieldReset->setResetTypeReference(resetElement.attribute(QStringLiteral("resetTypeRef")));
+      fieldReset->setResetTypeReference(StringPool::intern(resetElement.attribute(QStringLiteral("resetTypeRef"))));
   }
 }
 
@@ -199,7 +200,7 @@ void FieldReader::Details::parseTypeIdentifier(QDomElement const& fieldElement,
     if (!typeIdentifierElement.isNull())
     {
         QString typeIdentifier = typeIdentifierElement.firstChild().nodeValue();
-        newField->setTypeIdentifier(typeIdentifier);
+        newField->setTypeIdentifier(StringPool::intern(typeIdentifier));
     }
 }
 
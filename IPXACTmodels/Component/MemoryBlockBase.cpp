@@ -124,7 +124,7 @@ void MemoryBlockBase::copyParameters(const MemoryBlockBase& other)
     {
         if (parameter)
         {
-            QSharedPointer<Parameter> copy = QSharedPointer<Parameter>(new Parameter(*parameter.data()));
+            QSharedPointer<Parameter> copy = QSharedPointer<Parameter>::create(*parameter.data());
             parameters_->append(copy);
         }
     }
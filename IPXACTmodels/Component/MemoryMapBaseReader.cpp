@@ -20,6 +20,17 @@
 #include <IPXACTmodels/Component/AddressBlockReader.h>
 #include <IPXACTmodels/Component/SubspaceMapReader.h>
 
+#include <QDomDocument>
+#include <QtConcurrent/QtConcurrentMap>
+
+#include <functional>
+
+namespace
+{
+    //! Memory maps with fewer memory blocks than this are read in the calling thread.
+    const int PARALLEL_BLOCK_COUNT = 4;
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryMapBaseReader::createMemoryMapBaseFrom()
 //-----------------------------------------------------------------------------
@@ -69,21 +80,56 @@ void MemoryMapBaseReader::Details::parseMemoryBlocks(QDomNode const& memoryMapBa
 {
     QDomNodeList childNodes = memoryMapBaseNode.childNodes();
 
+    QList<QDomNode> blockNodes;
     for (int childIndex = 0; childIndex < childNodes.count(); ++childIndex)
     {
         QDomNode blockBaseNode = childNodes.at(childIndex);
-        if (blockBaseNode.nodeName() == QLatin1String("ipxact:addressBlock"))
+        if (blockBaseNode.nodeName() == QLatin1String("ipxact:addressBlock") ||
+            blockBaseNode.nodeName() == QLatin1String("ipxact:subspaceMap"))
         {
-            QSharedPointer<AddressBlock> newAddressBlock =
-                AddressBlockReader::createAddressBlockFrom(blockBaseNode, docRevision);
-
-            newMemoryMapBase->getMemoryBlocks()->append(newAddressBlock);
+            blockNodes.append(blockBaseNode);
         }
-        else if (blockBaseNode.nodeName() == QLatin1String("ipxact:subspaceMap"))
+    }
+
+    std::function<QSharedPointer<MemoryBlockBase>(QDomNode const&)> parseBlock =
+        [docRevision](QDomNode const& blockBaseNode) -> QSharedPointer<MemoryBlockBase>
         {
-            QSharedPointer<SubSpaceMap> newSubSpaceMap = SubspaceMapReader::createSubspaceMapFrom(blockBaseNode, docRevision);
+            if (blockBaseNode.nodeName() == QLatin1String("ipxact:addressBlock"))
+            {
+                return AddressBlockReader::createAddressBlockFrom(blockBaseNode, docRevision);
+            }
+
+            return SubspaceMapReader::createSubspaceMapFrom(blockBaseNode, docRevision);
+        };
 
-            newMemoryMapBase->getMemoryBlocks()->append(newSubSpaceMap);
+    if (blockNodes.size() < PARALLEL_BLOCK_COUNT)
+    {
+        for (QDomNode const& blockBaseNode : blockNodes)
+        {
+            newMemoryMapBase->getMemoryBlocks()->append(parseBlock(blockBaseNode));
+        }
+    }
+    else
+    {
+        // QDom is not thread-safe even for reading, so each block is copied to a document of its own in the
+        // calling thread and only the copies are read in parallel. The mapped results keep the document order.
+        QList<QDomDocument> blockDocuments;
+        blockDocuments.reserve(blockNodes.size());
+        for (QDomNode const& blockBaseNode : blockNodes)
+        {
+            QDomDocument blockDocument;
+            blockDocument.appendChild(blockDocument.importNode(blockBaseNode, true));
+            blockDocuments.append(blockDocument);
         }
+
+        std::function<QSharedPointer<MemoryBlockBase>(QDomDocument const&)> parseBlockDocument =
+            [&parseBlock](QDomDocument const& blockDocument)
+            {
+                return parseBlock(blockDocument.documentElement());
+            };
+
+        newMemoryMapBase->getMemoryBlocks()->append(
+            QtConcurrent::blockingMapped<QList<QSharedPointer<MemoryBlockBase> > >(blockDocuments,
+                parseBlockDocument));
     }
 }
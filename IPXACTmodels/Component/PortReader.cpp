@@ -14,6 +14,7 @@
 #include <IPXACTmodels/common/NameGroupReader.h>
 #include <IPXACTmodels/common/ProtocolReader.h>
 #include <IPXACTmodels/common/QualifierReader.h>
+#include <IPXACTmodels/common/StringPool.h>
 
 //-----------------------------------------------------------------------------
 // Function: PortReader::createPortFrom()
@@ -24,7 +25,8 @@ QSharedPointer<Port> PortReader::createPortFrom(QDomNode const& portNode, Docume
 
     NameGroupReader::parseNameGroup(portNode, newPort);
 
-    newPort->setIsPresent(portNode.firstChildElement(QStringLiteral("ipxact:isPresent")).firstChild().nodeValue());
+    newPort->setIsPresent(
+        portNode.firstChildElement(QStringLiteral("ipxact:isPresent")).firstChild().nodeValue());
 
     if (QDomElement wireElement = portNode.firstChildElement(QStringLiteral("ipxact:wire")); 
         !wireElement.isNull())
@@ -152,7 +154,7 @@ QSharedPointer<QList<QSharedPointer<WireTypeDef> > > PortReader::Details::parseW
         QDomElement wireTypeDefinitionElement = wireYypeDefinitionNodeList.at(wireTypeIndex).toElement();
 
         QDomElement nameElement = wireTypeDefinitionElement.firstChildElement(QStringLiteral("ipxact:typeName"));
-        QString typeName = nameElement.firstChild().nodeValue();
+        QString typeName = StringPool::intern(nameElement.firstChild().nodeValue());
         QSharedPointer<WireTypeDef> newWireTypeDefinition (new WireTypeDef(typeName));
         if (!nameElement.attribute(attributeName).isEmpty())
         {
@@ -180,7 +182,7 @@ void PortReader::Details::parseTypeDefinitions(QDomElement const& wireTypeDefini
     for (int typeDefinitionIndex = 0; typeDefinitionIndex < typeDefinitionList.count(); ++typeDefinitionIndex)
     {
         QString definition = typeDefinitionList.at(typeDefinitionIndex).firstChild().nodeValue();
-        definitionList->append(definition);
+        definitionList->append(StringPool::intern(definition));
     }
     if (!definitionList->isEmpty())
     {
@@ -200,7 +202,7 @@ void PortReader::Details::parseViewReferences(QDomElement const& wireTypeDefinit
     for (int viewIndex = 0; viewIndex < viewRefNodeList.count(); ++viewIndex)
     {
         QString viewName = viewRefNodeList.at(viewIndex).firstChild().nodeValue();
-        viewRefs->append(viewName);
+        viewRefs->append(StringPool::intern(viewName));
     }
 
     if (!viewRefs->isEmpty())
@@ -20,7 +20,7 @@
 Register::Register(QString const& name, QString const& addressOffset, QString const& size):
 RegisterDefinition(name, addressOffset),
 size_(size),
-alternateRegisters_(new QList<QSharedPointer<AlternateRegister> > ())
+alternateRegisters_(QSharedPointer<QList<QSharedPointer<AlternateRegister> > >::create())
 {
 
 }
@@ -31,7 +31,7 @@ alternateRegisters_(new QList<QSharedPointer<AlternateRegister> > ())
 Register::Register(const Register& other):
     RegisterDefinition(other),
     size_(other.size_),
-    alternateRegisters_(new QList<QSharedPointer<AlternateRegister> > ()),
+    alternateRegisters_(QSharedPointer<QList<QSharedPointer<AlternateRegister> > >::create()),
     registerDefinitionReference_(other.registerDefinitionReference_),
     typeDefinitionsReference_(other.typeDefinitionsReference_)
 {
@@ -70,7 +70,7 @@ Register::~Register()
 //-----------------------------------------------------------------------------
 QSharedPointer<RegisterBase> Register::clone()
 {
-    return QSharedPointer<RegisterBase>(new Register(*this));
+    return QSharedPointer<Register>::create(*this);
 }
 
 //-----------------------------------------------------------------------------
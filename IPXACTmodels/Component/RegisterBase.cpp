@@ -232,7 +232,7 @@ void RegisterBase::copyParameters(const RegisterBase& other)
     {
         if (parameter)
         {
-            QSharedPointer<Parameter> copy = QSharedPointer<Parameter>(new Parameter(*parameter.data()));
+            QSharedPointer<Parameter> copy = QSharedPointer<Parameter>::create(*parameter.data());
             parameters_->append(copy);
         }
     }
@@ -189,11 +189,11 @@ private:
 
 	//! Contains the parameters.
     QSharedPointer<QList<QSharedPointer<Parameter> > > parameters_ = 
-        QSharedPointer<QList<QSharedPointer<Parameter> > >(new QList<QSharedPointer<Parameter> > ());
+        QSharedPointer<QList<QSharedPointer<Parameter> > >::create();
 
     //! The access policies.
     QSharedPointer<QList<QSharedPointer<AccessPolicy> > > accessPolicies_ =
-        QSharedPointer<QList<QSharedPointer<AccessPolicy> > >(new QList<QSharedPointer<AccessPolicy> >());;
+        QSharedPointer<QList<QSharedPointer<AccessPolicy> > >::create();
 };
 
 Q_DECLARE_METATYPE(QSharedPointer<RegisterBase>);
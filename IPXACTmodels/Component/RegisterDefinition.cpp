@@ -20,7 +20,7 @@ RegisterDefinition::RegisterDefinition(QString const& name, QString const& addre
   RegisterBase(name, addressOffset),
   volatile_(),
   access_(AccessTypes::ACCESS_COUNT),
-  fields_(new QList<QSharedPointer<Field> > ())
+  fields_(QSharedPointer<QList<QSharedPointer<Field> > >::create())
 {
 
 }
@@ -28,7 +28,7 @@ RegisterDefinition::RegisterDefinition(QString const& name /* = QString() */) :
   RegisterBase(name),
   volatile_(),
   access_(AccessTypes::ACCESS_COUNT),
-  fields_(new QList<QSharedPointer<Field> > ())
+  fields_(QSharedPointer<QList<QSharedPointer<Field> > >::create())
 {
 
 }
@@ -40,7 +40,7 @@ RegisterDefinition::RegisterDefinition(const RegisterDefinition& other):
 RegisterBase(other),
 volatile_(other.volatile_),
 access_(other.access_),
-fields_(new QList<QSharedPointer<Field> > ())
+fields_(QSharedPointer<QList<QSharedPointer<Field> > >::create())
 {
     copyFields(other);
 }
@@ -138,7 +138,7 @@ void RegisterDefinition::copyFields(const RegisterDefinition& other)
     {
         if (field)
         {
-            QSharedPointer<Field> copy = QSharedPointer<Field>(new Field(*field.data()));
+            QSharedPointer<Field> copy = QSharedPointer<Field>::create(*field.data());
             fields_->append(copy);
         }
     }
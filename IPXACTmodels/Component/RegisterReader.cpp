@@ -21,6 +21,7 @@
 #include "AccessPolicyReader.h"
 
 #include <IPXACTmodels/common/NameGroupReader.h>
+#include <IPXACTmodels/common/StringPool.h>
 
 //-----------------------------------------------------------------------------
 // Function: RegisterReader::createRegisterfrom()
@@ -29,7 +30,7 @@ QSharedPointer<Register> RegisterReader::createRegisterfrom(QDomNode const& regi
 {
     QDomElement registerElement = registerNode.toElement();
 
-    QSharedPointer<Register> newRegister(new Register());
+    QSharedPointer<Register> newRegister = QSharedPointer<Register>::create();
 
     NameGroupReader::parseNameGroup(registerNode, newRegister);
 
@@ -166,7 +167,7 @@ void RegisterReader::Details::parseTypeIdentifier(QDomNode const& registerBaseNo
     if (!typeIdentifierElement.isNull())
     {
         QString typeIdentifier = typeIdentifierElement.firstChild().nodeValue();
-        registerBase->setTypeIdentifier(typeIdentifier);
+        registerBase->setTypeIdentifier(StringPool::intern(typeIdentifier));
     }
 }
 
@@ -73,6 +73,7 @@ HEADERS += ./generaldeclarations.h \
     ./common/ProtocolWriter.h \
     ./common/Qualifier.h \
     ./common/Range.h \
+    ./common/StringPool.h \
     ./common/TimingConstraint.h \
     ./common/TransactionalTypes.h \
     ./common/Vector.h \
@@ -386,6 +387,7 @@ SOURCES += ./Component/validators/CollectionValidators.cpp \
     ./common/QualifierReader.cpp \
     ./common/QualifierWriter.cpp \
     ./common/Range.cpp \
+    ./common/StringPool.cpp \
     ./common/TimingConstraint.cpp \
     ./common/TransactionalTypes.cpp \
     ./common/Vector.cpp \
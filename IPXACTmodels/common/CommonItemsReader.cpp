@@ -15,6 +15,7 @@
 #include <IPXACTmodels/common/GenericVendorExtension.h>
 
 #include <IPXACTmodels/common/ChoiceReader.h>
+#include <IPXACTmodels/common/StringPool.h>
 
 //-----------------------------------------------------------------------------
 // Function: CommonItemsReader::CommonItemsReader()
@@ -29,10 +30,14 @@ CommonItemsReader::CommonItemsReader()
 //-----------------------------------------------------------------------------
 VLNV CommonItemsReader::createVLNVFrom(QDomNode const& vlnvNode, VLNV::IPXactType type)
 {
-    QString vendor = vlnvNode.firstChildElement(QStringLiteral("ipxact:vendor")).firstChild().nodeValue();
-    QString library = vlnvNode.firstChildElement(QStringLiteral("ipxact:library")).firstChild().nodeValue();
-    QString name = vlnvNode.firstChildElement(QStringLiteral("ipxact:name")).firstChild().nodeValue();
-    QString version = vlnvNode.firstChildElement(QStringLiteral("ipxact:version")).firstChild().nodeValue();
+    QString vendor = StringPool::intern(
+        vlnvNode.firstChildElement(QStringLiteral("ipxact:vendor")).firstChild().nodeValue());
+    QString library = StringPool::intern(
+        vlnvNode.firstChildElement(QStringLiteral("ipxact:library")).firstChild().nodeValue());
+    QString name = StringPool::intern(
+        vlnvNode.firstChildElement(QStringLiteral("ipxact:name")).firstChild().nodeValue());
+    QString version = StringPool::intern(
+        vlnvNode.firstChildElement(QStringLiteral("ipxact:version")).firstChild().nodeValue());
     
     return VLNV(type, vendor, library, name, version);
 }
@@ -46,10 +51,10 @@ VLNV CommonItemsReader::parseVLNVAttributes(QDomNode const& vlnvNode, VLNV::IPXa
 
     VLNV attributedVLNV;
     attributedVLNV.setType(vlnvType);
-    attributedVLNV.setVendor(attributes.namedItem(QStringLiteral("vendor")).nodeValue());
-    attributedVLNV.setLibrary(attributes.namedItem(QStringLiteral("library")).nodeValue());
-    attributedVLNV.setName(attributes.namedItem(QStringLiteral("name")).nodeValue());
-    attributedVLNV.setVersion(attributes.namedItem(QStringLiteral("version")).nodeValue());
+    attributedVLNV.setVendor(StringPool::intern(attributes.namedItem(QStringLiteral("vendor")).nodeValue()));
+    attributedVLNV.setLibrary(StringPool::intern(attributes.namedItem(QStringLiteral("library")).nodeValue()));
+    attributedVLNV.setName(StringPool::intern(attributes.namedItem(QStringLiteral("name")).nodeValue()));
+    attributedVLNV.setVersion(StringPool::intern(attributes.namedItem(QStringLiteral("version")).nodeValue()));
 
     return attributedVLNV;
 }
@@ -102,10 +107,10 @@ QSharedPointer<ConfigurableVLNVReference> CommonItemsReader::parseConfigurableVL
 {
     QDomNamedNodeMap attributeMap = configurableVLNVNode.attributes();
 
-    QString vendor = attributeMap.namedItem(QStringLiteral("vendor")).nodeValue();
-    QString library = attributeMap.namedItem(QStringLiteral("library")).nodeValue();
-    QString name = attributeMap.namedItem(QStringLiteral("name")).nodeValue();
-    QString version = attributeMap.namedItem(QStringLiteral("version")).nodeValue();
+    QString vendor = StringPool::intern(attributeMap.namedItem(QStringLiteral("vendor")).nodeValue());
+    QString library = StringPool::intern(attributeMap.namedItem(QStringLiteral("library")).nodeValue());
+    QString name = StringPool::intern(attributeMap.namedItem(QStringLiteral("name")).nodeValue());
+    QString version = StringPool::intern(attributeMap.namedItem(QStringLiteral("version")).nodeValue());
 
     QSharedPointer<ConfigurableVLNVReference> vlnvReference(
         new ConfigurableVLNVReference(type, vendor, library, name, version));
@@ -139,8 +144,8 @@ QSharedPointer<ConfigurableElementValue> CommonItemsReader::parseConfigurableEle
     for (int i = 0; i < attributeMap.size(); ++i)
     {
         QDomNode attributeItem = attributeMap.item(i);
-        newConfigurableElementValue->insertAttribute(
-            attributeItem.nodeName(), attributeItem.firstChild().nodeValue());
+        newConfigurableElementValue->insertAttribute(StringPool::intern(attributeItem.nodeName()),
+            attributeItem.firstChild().nodeValue());
     }
 
     return newConfigurableElementValue;
@@ -156,7 +161,7 @@ QMap<QString, QString> CommonItemsReader::parseAttributes(QDomNode const& attrib
     QDomNamedNodeMap attributeMap = attributedNode.attributes();
     for (int j = 0; j < attributeMap.size(); ++j)
     {
-        QString name = attributeMap.item(j).nodeName();
+        QString name = StringPool::intern(attributeMap.item(j).nodeName());
         QString value = attributeMap.item(j).nodeValue();
         attributes.insert(name, value);
     }
@@ -248,8 +253,7 @@ QSharedPointer<PartSelect> CommonItemsReader::parsePartSelect(QDomNode const& pa
 //-----------------------------------------------------------------------------
 Range CommonItemsReader::parseRange(QDomElement const& rangeElement)
 {
-    return Range(
-        rangeElement.firstChildElement(QStringLiteral("ipxact:left")).firstChild().nodeValue(),
+    return Range(rangeElement.firstChildElement(QStringLiteral("ipxact:left")).firstChild().nodeValue(),
         rangeElement.firstChildElement(QStringLiteral("ipxact:right")).firstChild().nodeValue());
 }
 
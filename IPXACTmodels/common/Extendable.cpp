@@ -27,7 +27,7 @@ QSharedPointer<QList<QSharedPointer<VendorExtension> > > Extendable::getVendorEx
 // Function: Extendable::Extendable()
 //-----------------------------------------------------------------------------
 Extendable::Extendable() :
-vendorExtensions_(new QList<QSharedPointer<VendorExtension> >())
+vendorExtensions_(QSharedPointer<QList<QSharedPointer<VendorExtension> > >::create())
 {
 
 }
@@ -36,7 +36,7 @@ vendorExtensions_(new QList<QSharedPointer<VendorExtension> >())
 // Function: Extendable::Extendable()
 //-----------------------------------------------------------------------------
 Extendable::Extendable(Extendable const& other) : 
-vendorExtensions_(new QList<QSharedPointer<VendorExtension> >())
+vendorExtensions_(QSharedPointer<QList<QSharedPointer<VendorExtension> > >::create())
 {
     copyVendorExtensions(other);
 }
@@ -19,7 +19,7 @@
 QSharedPointer<ModuleParameter> ModuleParameterReader::createModuleParameterFrom(
     QDomNode const& moduleParameterNode, Document::Revision docRevision)
 {
-    QSharedPointer<ModuleParameter> newModuleParameter (new ModuleParameter());
+    QSharedPointer<ModuleParameter> newModuleParameter = QSharedPointer<ModuleParameter>::create();
 
     ParameterReader::Details::parseAttributes(moduleParameterNode, newModuleParameter);
 
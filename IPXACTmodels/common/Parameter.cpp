@@ -19,6 +19,14 @@
 
 #include <QUuid>
 
+#include <atomic>
+
+namespace
+{
+    //! The generation of the parameter ids, shared by all the parameters.
+    std::atomic<unsigned int> idGeneration(0);
+}
+
 //-----------------------------------------------------------------------------
 // Function: Parameter::Parameter()
 //-----------------------------------------------------------------------------
@@ -41,6 +49,8 @@ Parameter::Parameter( const Parameter &other ): NameGroup(other),
     Copy::copyList(other.vectors_, vectors_);
     Copy::copyList(other.arrays_, arrays_);
     copyVendorExtensions(other);
+
+    ++idGeneration;
 }
 
 //-----------------------------------------------------------------------------
@@ -62,6 +72,7 @@ Parameter & Parameter::operator=(Parameter const& other)
         Extendable::operator=(other);
 		value_ = other.value_;
         attributes_ = other.attributes_;
+        ++idGeneration;
 		valueAttributes_ = other.valueAttributes_;
 
         vectors_->clear();
@@ -195,6 +206,14 @@ void Parameter::setValueId(QString const& id)
      setAttribute(QStringLiteral("parameterId"), id);
 }
 
+//-----------------------------------------------------------------------------
+// Function: Parameter::getIdGeneration()
+//-----------------------------------------------------------------------------
+unsigned int Parameter::getIdGeneration() noexcept
+{
+    return idGeneration;
+}
+
 //-----------------------------------------------------------------------------
 // Function: parameter::getUsageCount()
 //-----------------------------------------------------------------------------
@@ -256,6 +275,11 @@ QString Parameter::getAttribute(QString const& attributeName) const
 //-----------------------------------------------------------------------------
 void Parameter::setAttribute(QString const& attributeName, QString const& attributeValue)
 {
+    if (attributeName == QLatin1String("parameterId"))
+    {
+        ++idGeneration;
+    }
+
     if (!attributeValue.isEmpty())
     {
         attributes_.insert(attributeName, attributeValue);
@@ -145,6 +145,14 @@ public:
      */
      void setValueId(QString const& id);
 
+    /*!
+     *  Gets the generation of the parameter ids. The generation changes every time a parameter is created or
+     *  the id of any parameter is changed.
+     *
+     *    @return The id generation.
+     */
+    static unsigned int getIdGeneration() noexcept;
+
      /*!
       *  Get the amount of times the parameter has been referenced.
       *
@@ -335,11 +343,11 @@ private:
 
     //! Vectors for defining parameter bit width.
     QSharedPointer<QList<QSharedPointer<Vector> > > vectors_ = 
-        QSharedPointer<QList<QSharedPointer<Vector> > >(new QList<QSharedPointer<Vector> >());
+        QSharedPointer<QList<QSharedPointer<Vector> > >::create();
 
     //! Arrays for defining parameter as an array of values.
     QSharedPointer<QList<QSharedPointer<Array> > > arrays_ =
-        QSharedPointer<QList<QSharedPointer<Array> > >(new QList<QSharedPointer<Array> >());;
+        QSharedPointer<QList<QSharedPointer<Array> > >::create();
 
 };
 
@@ -15,6 +15,7 @@
 #include <IPXACTmodels/common/Parameter.h>
 #include <IPXACTmodels/common/NameGroupReader.h>
 #include <IPXACTmodels/common/GenericVendorExtension.h>
+#include <IPXACTmodels/common/StringPool.h>
 
 //-----------------------------------------------------------------------------
 // Function: ParameterReader::createParameterFrom()
@@ -22,7 +23,7 @@
 QSharedPointer<Parameter> ParameterReader::createParameterFrom(QDomNode const& parameterNode,
     Document::Revision revision)
 {
-    QSharedPointer<Parameter> parameter(new Parameter());
+    QSharedPointer<Parameter> parameter = QSharedPointer<Parameter>::create();
     Details::parseAttributes(parameterNode, parameter);
 
     NameGroupReader::parseNameGroup(parameterNode, parameter);
@@ -55,7 +56,14 @@ void ParameterReader::Details::parseAttributes(QDomNode const& parameterNode, QS
             attributeName.prepend(QStringLiteral("kactus2:"));
         }
 
-        parameter->setAttribute(attributeName, attributeValue);
+        // Only the enumerated values repeat enough to be worth sharing.
+        if (attributeName == QLatin1String("resolve") || attributeName == QLatin1String("type") ||
+            attributeName == QLatin1String("sign"))
+        {
+            attributeValue = StringPool::intern(attributeValue);
+        }
+
+        parameter->setAttribute(StringPool::intern(attributeName), attributeValue);
     }            
 }
 
@@ -137,6 +145,6 @@ void ParameterReader::Details::parseValue(QDomNode const& parameterNode, QShared
         QString attributeName = valueAttributes.item(j).nodeName();
         QString attributeValue = valueAttributes.item(j).nodeValue();
 
-        parameter->setValueAttribute(attributeName, attributeValue);
+        parameter->setValueAttribute(StringPool::intern(attributeName), attributeValue);
     }
 }
@@ -0,0 +1,79 @@
+//-----------------------------------------------------------------------------
+// File: StringPool.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Shared pool of the short strings repeated across the elements of IP-XACT documents.
+//-----------------------------------------------------------------------------
+
+#include "StringPool.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+
+#include <array>
+
+namespace
+{
+    //! A part of the pool guarded by its own lock, so that readers in several threads rarely wait for each other.
+    struct Shard
+    {
+        QMutex mutex;
+        QSet<QString> strings;
+    };
+
+    //! The number of shards in the pool.
+    const int SHARD_COUNT = 16;
+
+    //! The interned strings divided by their hash.
+    std::array<Shard, SHARD_COUNT> shards;
+}
+
+//-----------------------------------------------------------------------------
+// Function: StringPool::intern()
+//-----------------------------------------------------------------------------
+QString StringPool::intern(QString const& text)
+{
+    if (text.isEmpty() || text.size() > MAXIMUM_LENGTH)
+    {
+        return text;
+    }
+
+    Shard& shard = shards[qHash(text) % SHARD_COUNT];
+    QMutexLocker locker(&shard.mutex);
+
+    auto existing = shard.strings.constFind(text);
+    if (existing != shard.strings.cend())
+    {
+        return *existing;
+    }
+
+    if (shard.strings.size() < CAPACITY / SHARD_COUNT)
+    {
+        // Store a detached copy, so the pool does not keep alive a larger buffer the text may be part of.
+        // The first caller gets the pooled copy as well, so every use of the string shares the same data.
+        return *shard.strings.insert(QString(text.constData(), text.size()));
+    }
+
+    return text;
+}
+
+//-----------------------------------------------------------------------------
+// Function: StringPool::size()
+//-----------------------------------------------------------------------------
+int StringPool::size()
+{
+    int count = 0;
+    for (Shard& shard : shards)
+    {
+        QMutexLocker locker(&shard.mutex);
+        count += shard.strings.size();
+    }
+
+    return count;
+}
@@ -0,0 +1,53 @@
+//-----------------------------------------------------------------------------
+// File: StringPool.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Shared pool of the short strings repeated across the elements of IP-XACT documents.
+//-----------------------------------------------------------------------------
+
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <QString>
+
+//-----------------------------------------------------------------------------
+//! Shared pool of the short strings repeated across the elements of IP-XACT documents.
+//!
+//! Values like VLNV parts, type names and enumerated attribute values repeat in thousands of elements.
+//! Interning them lets the elements share one implicitly shared string instead of each holding its own copy.
+//! The pool is global and capped, so only values from such small sets should be interned: expressions, offsets,
+//! ranges and other values with many distinct instances would fill it and keep their strings alive. Long
+//! strings are returned as such, and the pool stops growing when it reaches its capacity.
+//-----------------------------------------------------------------------------
+namespace StringPool
+{
+    //! Strings longer than this are not interned.
+    const int MAXIMUM_LENGTH = 64;
+
+    //! The maximum number of strings in the pool.
+    const int CAPACITY = 1 << 16;
+
+    /*!
+     *  Get the pooled copy of a string.
+     *
+     *    @param [in] text    The string to intern.
+     *
+     *    @return The pooled string equal to the given one, or the given string if it is not interned.
+     */
+    IPXACTMODELS_EXPORT QString intern(QString const& text);
+
+    /*!
+     *  Get the number of strings in the pool.
+     *
+     *    @return The number of interned strings.
+     */
+    IPXACTMODELS_EXPORT int size();
+}
+
+#endif // STRINGPOOL_H
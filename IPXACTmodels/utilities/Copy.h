@@ -30,8 +30,11 @@ namespace Copy
             return;
         }
 
+        to->reserve(to->size() + from->size());
+
+        // Each copy is allocated in the same block with its reference count.
         std::for_each(from->cbegin(), from->cend(), [&to](auto const& item) 
-            { to->append(QSharedPointer<Item>(new Item(*item))); });
+            { to->append(QSharedPointer<Item>::create(*item)); });
 
     };
 
@@ -43,6 +46,8 @@ namespace Copy
             return;
         }
 
+        to->reserve(to->size() + from->size());
+
         std::for_each(from->cbegin(), from->cend(), [&to](auto const& item)
             { to->append(Item(item)); });
 
@@ -509,6 +509,7 @@ HEADERS += ./common/NameGenerationPolicy.h \
     ./editors/ComponentEditor/choices/ChoicesEditor.h \
     ./editors/ComponentEditor/choices/ChoicesModel.h \
     ./editors/ComponentEditor/choices/EnumerationModel.h \
+    ./editors/ComponentEditor/common/CellValueCache.h \
     ./editors/ComponentEditor/common/ConfigurableElementFinder.h \
     ./editors/ComponentEditor/common/DesignConfigurationInstantiationParameterFinder.h \
     ./editors/ComponentEditor/common/MasterExpressionEditor.h \
@@ -1397,6 +1398,7 @@ SOURCES += ./editors/ComponentEditor/busInterfaces/general/MasterModeEditor.cpp
     ./editors/ComponentEditor/choices/ChoicesModel.cpp \
     ./editors/ComponentEditor/choices/EnumerationModel.cpp \
     ./editors/ComponentEditor/common/AbstractParameterModel.cpp \
+    ./editors/ComponentEditor/common/CellValueCache.cpp \
     ./editors/ComponentEditor/common/ConfigurableElementFinder.cpp \
     ./editors/ComponentEditor/common/DesignConfigurationInstantiationParameterFinder.cpp \
     ./editors/ComponentEditor/common/EnumerationEditorConstructorDelegate.cpp \
@@ -23,8 +23,11 @@ HEADERS += ./KactusAPI.h \
     ./include/ComponentParameterFinder.h \
     ./include/ConsoleMediator.h \
     ./include/DesignParameterFinder.h \
+    ./include/DocumentCache.h \
     ./include/DocumentFileAccess.h \
+    ./include/DocumentSummary.h \
     ./include/DocumentValidator.h \
+    ./include/ExpressionEvaluationCache.h \
     ./include/ExpressionFormatter.h \
     ./include/ExpressionFormatterFactory.h \
     ./include/ExpressionFormatterFactoryImplementation.h \
@@ -47,12 +50,14 @@ HEADERS += ./KactusAPI.h \
     ./include/IPXactSystemVerilogParser.h \
     ./include/LibraryInterface.h \
     ./include/LibraryLoader.h \
+    ./include/LibraryWatcher.h \
     ./include/ListHelper.h \
     ./include/ListParameterFinder.h \
     ./include/MasterPortInterface.h \
     ./include/MemoryBlockInterface.h \
     ./include/MemoryMapExpressionsGatherer.h \
     ./include/MemoryMapInterface.h \
+    ./include/NameIndex.h \
     ./include/MemoryRemapExpressionGatherer.h \
     ./include/MessageMediator.h \
     ./include/ModeConditionParser.h \
@@ -68,6 +73,7 @@ HEADERS += ./KactusAPI.h \
     ./include/NullParser.h \
     ./include/ParameterFinder.h \
     ./include/ParameterizableInterface.h \
+    ./include/RegisterMapImporter.h \
     ./include/ParametersInterface.h \
     ./include/PluginManager.h \
     ./include/PluginSettingsModel.h \
@@ -103,6 +109,7 @@ SOURCES += ./KactusAPI.cpp \
     ./expressions/ComponentInstantiationParameterFinder.cpp \
     ./expressions/ComponentParameterFinder.cpp \
     ./expressions/DesignParameterFinder.cpp \
+    ./expressions/ExpressionEvaluationCache.cpp \
     ./expressions/ExpressionFormatter.cpp \
     ./expressions/ExpressionFormatterFactoryImplementation.cpp \
     ./expressions/FieldExpressionsGatherer.cpp \
@@ -156,9 +163,12 @@ SOURCES += ./KactusAPI.cpp \
     ./utilities/ConsoleMediator.cpp \
     ./utilities/FileHandler.cpp \
     ./utilities/NullChannel.cpp \
+    ./utilities/RegisterMapImporter.cpp \
     ./utilities/utils.cpp \
     ./utilities/VersionHelper.cpp \
+    ./library/DocumentCache.cpp \
     ./library/DocumentFileAccess.cpp \
+    ./library/DocumentSummary.cpp \
     ./library/DocumentValidator.cpp \
     ./library/hierarchyitem.cpp \
     ./library/hierarchymodel.cpp \
@@ -166,4 +176,5 @@ SOURCES += ./KactusAPI.cpp \
     ./library/LibraryItem.cpp \
     ./library/LibraryLoader.cpp \
     ./library/LibraryTreeModel.cpp \
+    ./library/LibraryWatcher.cpp \
     ./library/TagManager.cpp
@@ -6,7 +6,7 @@ TEMPLATE = lib
 TARGET = KactusAPI
 DESTDIR = ../executable
 CONFIG += c++17 release
-QT += xml widgets
+QT += xml widgets concurrent
 DEFINES +=  KACTUS2_EXPORTS
 LIBS += -L"../executable" \
     -lIPXACTmodels 
@@ -23,6 +23,16 @@
 #include <IPXACTmodels/Component/RegisterBase.h>
 #include <IPXACTmodels/Component/IndirectInterface.h>
 
+namespace
+{
+    //! Checks if an item is in the given position of a list.
+    template <typename Item>
+    bool isAt(QSharedPointer<QList<QSharedPointer<Item> > > const& items, int position, Item const* item)
+    {
+        return position < items->size() && items->at(position).data() == item;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentParameterFinder::ComponentParameterFinder()
 //-----------------------------------------------------------------------------
@@ -157,6 +167,7 @@ void ComponentParameterFinder::registerParameterModel(QAbstractItemModel const*
 void ComponentParameterFinder::setComponent(QSharedPointer<Component const> component)
 {
     component_ = component;
+    invalidateIndex();
 }
 
 //-----------------------------------------------------------------------------
@@ -169,63 +180,30 @@ QSharedPointer<Parameter> ComponentParameterFinder::searchParameter(QStringView
         return nullptr;
     }
 
-    for (QSharedPointer<Parameter> parameter : *component_->getParameters())
+    if (!indexValid_)
     {
-        if (parameter->getValueId() == parameterId)
-        {
-            return parameter;
-        }
+        rebuildIndex();
     }
 
-    for (QSharedPointer<Parameter> busInterfaceParameter : allBusInterfaceParameters())
-    {
-        if (busInterfaceParameter->getValueId() == parameterId)
-        {
-            return busInterfaceParameter;
-        }
-    }
+    QString const id = parameterId.toString();
 
-    for (QSharedPointer<Parameter> cpuParameter : allCpuParameters())
+    // The component may have changed after the index was built. A hit is checked from its position and a miss
+    // from the id generation, so that a stale index is rebuilt without walking the component on every search.
+    auto entry = parameterIndex_.constFind(id);
+    if (entry == parameterIndex_.cend())
     {
-        if (cpuParameter->getValueId() == parameterId)
+        if (indexedGeneration_ == Parameter::getIdGeneration())
         {
-            return cpuParameter;
+            return nullptr;
         }
     }
-
-    for (QSharedPointer<Parameter> generatorParameter : allGeneratorParameters())
+    else if (isCurrent(*entry, parameterId))
     {
-        if (generatorParameter->getValueId() == parameterId)
-        {
-            return generatorParameter;
-        }
-    }
-
-    for (QSharedPointer<Parameter> addressSpaceParameter : allAddressSpaceParameters())
-    {
-        if (addressSpaceParameter->getValueId() == parameterId)
-        {
-            return addressSpaceParameter;
-        }
+        return entry->parameter;
     }
 
-    for (QSharedPointer<Parameter> registerParameter : allRegisterParameters())
-    {
-        if (registerParameter->getValueId() == parameterId)
-        {
-            return registerParameter;
-        }
-    }
-
-    for (auto indirectInterfaceParameter : allIndirectInterfacesParameters())
-    {
-        if (indirectInterfaceParameter->getValueId() == parameterId)
-        {
-            return indirectInterfaceParameter;
-        }
-    }
-
-    return QSharedPointer<Parameter>();
+    rebuildIndex();
+    return parameterIndex_.value(id).parameter;
 }
 
 //-----------------------------------------------------------------------------
@@ -384,3 +362,154 @@ QSharedPointer<const Component> ComponentParameterFinder::getComponent() const n
 {
     return component_;
 }
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterFinder::invalidateIndex()
+//-----------------------------------------------------------------------------
+void ComponentParameterFinder::invalidateIndex() noexcept
+{
+    indexValid_ = false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterFinder::rebuildIndex()
+//-----------------------------------------------------------------------------
+void ComponentParameterFinder::rebuildIndex() const
+{
+    parameterIndex_.clear();
+    parameterOwners_.clear();
+    indexedGeneration_ = Parameter::getIdGeneration();
+
+    // Add the parameters in the search order, so that the first parameter with a given id is found.
+    addToIndex([this]() { return component_->getParameters(); });
+
+    auto busInterfaces = component_->getBusInterfaces();
+    for (int i = 0; i < busInterfaces->size(); ++i)
+    {
+        addToIndex([this, i, busInterface = busInterfaces->at(i).data()]()
+            {
+                return isAt(component_->getBusInterfaces(), i, busInterface) ?
+                    busInterface->getParameters() : nullptr;
+            });
+    }
+
+    auto cpus = component_->getCpus();
+    for (int i = 0; i < cpus->size(); ++i)
+    {
+        addToIndex([this, i, cpu = cpus->at(i).data()]()
+            {
+                return isAt(component_->getCpus(), i, cpu) ? cpu->getParameters() : nullptr;
+            });
+    }
+
+    auto generators = component_->getComponentGenerators();
+    for (int i = 0; i < generators->size(); ++i)
+    {
+        addToIndex([this, i, generator = generators->at(i).data()]()
+            {
+                return isAt(component_->getComponentGenerators(), i, generator) ?
+                    generator->getParameters() : nullptr;
+            });
+    }
+
+    auto addressSpaces = component_->getAddressSpaces();
+    for (int i = 0; i < addressSpaces->size(); ++i)
+    {
+        AddressSpace* addressSpace = addressSpaces->at(i).data();
+        addToIndex([this, i, addressSpace]()
+            {
+                return isAt(component_->getAddressSpaces(), i, addressSpace) ?
+                    addressSpace->getParameters() : nullptr;
+            });
+
+        if (QSharedPointer<MemoryMapBase> localMap = addressSpace->getLocalMemoryMap(); localMap)
+        {
+            addRegistersToIndex(localMap, [this, i, addressSpace, map = localMap.data()]()
+                {
+                    return isAt(component_->getAddressSpaces(), i, addressSpace) &&
+                        addressSpace->getLocalMemoryMap().data() == map;
+                });
+        }
+    }
+
+    auto memoryMaps = component_->getMemoryMaps();
+    for (int i = 0; i < memoryMaps->size(); ++i)
+    {
+        addRegistersToIndex(memoryMaps->at(i), [this, i, map = memoryMaps->at(i).data()]()
+            {
+                return isAt(component_->getMemoryMaps(), i, map);
+            });
+    }
+
+    auto indirectInterfaces = component_->getIndirectInterfaces();
+    for (int i = 0; i < indirectInterfaces->size(); ++i)
+    {
+        addToIndex([this, i, indirectInterface = indirectInterfaces->at(i).data()]()
+            {
+                return isAt(component_->getIndirectInterfaces(), i, indirectInterface) ?
+                    indirectInterface->getParameters() : nullptr;
+            });
+    }
+
+    indexValid_ = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterFinder::addToIndex()
+//-----------------------------------------------------------------------------
+void ComponentParameterFinder::addToIndex(ParameterOwner const& owner) const
+{
+    int const ownerIndex = parameterOwners_.size();
+    parameterOwners_.append(owner);
+
+    auto parameters = owner();
+    for (int i = 0; i < parameters->size(); ++i)
+    {
+        QSharedPointer<Parameter> const& parameter = parameters->at(i);
+        if (!parameterIndex_.contains(parameter->getValueId()))
+        {
+            parameterIndex_.insert(parameter->getValueId(), IndexEntry{ parameter, ownerIndex, i });
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterFinder::addRegistersToIndex()
+//-----------------------------------------------------------------------------
+void ComponentParameterFinder::addRegistersToIndex(QSharedPointer<MemoryMapBase> const& memoryMap,
+    std::function<bool()> const& mapOwner) const
+{
+    auto memoryBlocks = memoryMap->getMemoryBlocks();
+    for (int blockIndex = 0; blockIndex < memoryBlocks->size(); ++blockIndex)
+    {
+        QSharedPointer<AddressBlock> addressBlock = memoryBlocks->at(blockIndex).dynamicCast<AddressBlock>();
+        if (addressBlock.isNull())
+        {
+            continue;
+        }
+
+        auto registers = addressBlock->getRegisterData();
+        for (int registerIndex = 0; registerIndex < registers->size(); ++registerIndex)
+        {
+            // The containing elements are checked from the component down, so that each is known to exist.
+            addToIndex([mapOwner, map = memoryMap.data(), blockIndex, block = addressBlock.data(), registerIndex,
+                registerBase = registers->at(registerIndex).data()]()
+                {
+                    return mapOwner() && isAt<MemoryBlockBase>(map->getMemoryBlocks(), blockIndex, block) &&
+                        isAt(block->getRegisterData(), registerIndex, registerBase) ?
+                        registerBase->getParameters() : nullptr;
+                });
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterFinder::isCurrent()
+//-----------------------------------------------------------------------------
+bool ComponentParameterFinder::isCurrent(IndexEntry const& entry, QStringView id) const
+{
+    auto parameters = parameterOwners_.at(entry.owner)();
+
+    return parameters && entry.position < parameters->size() &&
+        parameters->at(entry.position) == entry.parameter && entry.parameter->getValueId() == id;
+}
@@ -0,0 +1,53 @@
+//-----------------------------------------------------------------------------
+// File: ExpressionEvaluationCache.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Cache for the evaluation results of expressions.
+//-----------------------------------------------------------------------------
+
+#include "ExpressionEvaluationCache.h"
+
+#include "ExpressionFormatter.h"
+
+//-----------------------------------------------------------------------------
+// Function: ExpressionEvaluationCache::ExpressionEvaluationCache()
+//-----------------------------------------------------------------------------
+ExpressionEvaluationCache::ExpressionEvaluationCache(QSharedPointer<ExpressionParser> parser):
+parser_(parser)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ExpressionEvaluationCache::evaluate()
+//-----------------------------------------------------------------------------
+ExpressionParser::Evaluation const& ExpressionEvaluationCache::evaluate(QString const& expression)
+{
+    auto cached = evaluations_.constFind(expression);
+    if (cached == evaluations_.constEnd())
+    {
+        cached = evaluations_.insert(expression, parser_->evaluate(expression));
+    }
+
+    return cached.value();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ExpressionEvaluationCache::formattedValue()
+//-----------------------------------------------------------------------------
+QString ExpressionEvaluationCache::formattedValue(QString const& expression)
+{
+    return ExpressionFormatter::formatEvaluation(evaluate(expression));
+}
+
+//-----------------------------------------------------------------------------
+// Function: ExpressionEvaluationCache::clear()
+//-----------------------------------------------------------------------------
+void ExpressionEvaluationCache::clear()
+{
+    evaluations_.clear();
+}
@@ -16,7 +16,6 @@
 #include <IPXACTmodels/common/validators/ValueFormatter.h>
 
 #include <QStringList>
-#include <QRegularExpression>
 
 
 //-----------------------------------------------------------------------------
@@ -41,13 +40,18 @@ ExpressionFormatter::~ExpressionFormatter()
 //-----------------------------------------------------------------------------
 QString ExpressionFormatter::format(QString const& expression, QSharedPointer<ExpressionParser> parser)
 {
-    bool isValidExpression = false;
-    QString value = parser->parseExpression(expression, &isValidExpression);
+    return formatEvaluation(parser->evaluate(expression));
+}
 
-    if (isValidExpression)
+//-----------------------------------------------------------------------------
+// Function: ExpressionFormatter::formatEvaluation()
+//-----------------------------------------------------------------------------
+QString ExpressionFormatter::formatEvaluation(ExpressionParser::Evaluation const& evaluation)
+{
+    if (evaluation.valid)
     {
         ValueFormatter formatter;
-        return formatter.format(value, parser->baseForExpression(expression));
+        return formatter.format(evaluation.value, evaluation.base);
     }
     else
     {
@@ -60,15 +64,36 @@ QString ExpressionFormatter::format(QString const& expression, QSharedPointer<Ex
 //-----------------------------------------------------------------------------
 QString ExpressionFormatter::formatReferringExpression(QString const& expression) const
 {
-    static const QRegularExpression NON_ALPHA_CHARACTERS("[^a-zA-Z0-9:_.]+");
+    auto isIdCharacter = [](QChar const& character)
+    {
+        char16_t const code = character.unicode();
+        return (code >= u'a' && code <= u'z') || (code >= u'A' && code <= u'Z') ||
+            (code >= u'0' && code <= u'9') || code == u':' || code == u'_' || code == u'.';
+    };
 
-    QString formattedExpression = expression;
+    // Copy the expression in a single pass, replacing the referenced ids with the parameter names.
+    QString formattedExpression;
+    formattedExpression.reserve(expression.size());
 
-    for (QString const& valueID : expression.split(NON_ALPHA_CHARACTERS, Qt::SkipEmptyParts))
+    qsizetype const length = expression.size();
+    qsizetype position = 0;
+    while (position < length)
     {
-        if (parameterFinder_->hasId(valueID))
+        qsizetype const tokenStart = position;
+        bool const isToken = isIdCharacter(expression.at(position));
+        while (position < length && isIdCharacter(expression.at(position)) == isToken)
+        {
+            ++position;
+        }
+
+        QStringView token = QStringView(expression).mid(tokenStart, position - tokenStart);
+        if (isToken && parameterFinder_->hasId(token))
+        {
+            formattedExpression.append(parameterFinder_->nameForId(token));
+        }
+        else
         {
-            formattedExpression.replace(valueID, parameterFinder_->nameForId(valueID));
+            formattedExpression.append(token);
         }
     }
 
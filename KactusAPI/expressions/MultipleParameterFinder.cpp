@@ -14,7 +14,8 @@
 //-----------------------------------------------------------------------------
 // Function: MultipleParameterFinder::MultipleParameterFinder()
 //-----------------------------------------------------------------------------
-MultipleParameterFinder::MultipleParameterFinder()
+MultipleParameterFinder::MultipleParameterFinder():
+missingParameter_(new Parameter())
 {
 
 }
@@ -27,6 +28,7 @@ void MultipleParameterFinder::addFinder(QSharedPointer<ParameterFinder> finder)
     if (!finders_.contains(finder))
     {
         finders_.append(finder);
+        indexValid_ = false;
     }
 }
 
@@ -36,6 +38,7 @@ void MultipleParameterFinder::addFinder(QSharedPointer<ParameterFinder> finder)
 void MultipleParameterFinder::removeFinder(QSharedPointer<ParameterFinder> finder)
 {
     finders_.removeAll(finder);
+    indexValid_ = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -44,6 +47,7 @@ void MultipleParameterFinder::removeFinder(QSharedPointer<ParameterFinder> finde
 void MultipleParameterFinder::removeAllFinders()
 {
     finders_.clear();
+    indexValid_ = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -51,15 +55,13 @@ void MultipleParameterFinder::removeAllFinders()
 //-----------------------------------------------------------------------------
 QSharedPointer<Parameter> MultipleParameterFinder::getParameterWithID(QStringView parameterId) const
 {
-    for (QSharedPointer<ParameterFinder> finder : finders_)
+    if (ResolvedId resolved = resolve(parameterId); resolved.finder)
     {
-        if (finder->hasId(parameterId))
-        {
-            return finder->getParameterWithID(parameterId);
-        }
+        return resolved.parameter;
     }
 
-    return QSharedPointer<Parameter>(new Parameter);
+    // A new parameter for every miss would advance the id generation and invalidate the index.
+    return missingParameter_;
 }
 
 //-----------------------------------------------------------------------------
@@ -67,7 +69,7 @@ QSharedPointer<Parameter> MultipleParameterFinder::getParameterWithID(QStringVie
 //-----------------------------------------------------------------------------
 bool MultipleParameterFinder::hasId(QStringView id) const
 {
-    return std::any_of(finders_.cbegin(), finders_.cend(), [id](const auto& finder) { return finder->hasId(id); });
+    return !resolve(id).finder.isNull();
 }
 
 //-----------------------------------------------------------------------------
@@ -83,12 +85,9 @@ QString MultipleParameterFinder::nameForId(QStringView id) const
 //-----------------------------------------------------------------------------
 QString MultipleParameterFinder::valueForId(QStringView id) const
 {
-    for (QSharedPointer<ParameterFinder> finder : finders_)
+    if (ResolvedId resolved = resolve(id); resolved.finder)
     {
-        if (finder->hasId(id))
-        {
-            return finder->valueForId(id);
-        }
+        return resolved.finder->valueForId(id);
     }
 
     return QString();
@@ -125,3 +124,65 @@ void MultipleParameterFinder::registerParameterModel(QAbstractItemModel const* /
 {
     // Nothing to do.
 }
+
+//-----------------------------------------------------------------------------
+// Function: MultipleParameterFinder::resolve()
+//-----------------------------------------------------------------------------
+MultipleParameterFinder::ResolvedId MultipleParameterFinder::resolve(QStringView id) const
+{
+    if (!indexValid_ || indexedGeneration_ != Parameter::getIdGeneration())
+    {
+        rebuildIndex();
+    }
+
+    QString const key = id.toString();
+    if (auto resolved = resolvedIds_.constFind(key); resolved != resolvedIds_.cend())
+    {
+        if (resolved->finder->getParameterWithID(id) == resolved->parameter)
+        {
+            return *resolved;
+        }
+
+        // The parameter has been removed from its finder, which may reveal the id in a later finder.
+        rebuildIndex();
+        if (resolved = resolvedIds_.constFind(key); resolved != resolvedIds_.cend())
+        {
+            return *resolved;
+        }
+    }
+
+    // Existing parameters may have been moved into a finder without a change in the id generation.
+    for (QSharedPointer<ParameterFinder> const& finder : finders_)
+    {
+        if (finder->hasId(id))
+        {
+            ResolvedId resolved{ finder, finder->getParameterWithID(id) };
+            resolvedIds_.insert(key, resolved);
+            return resolved;
+        }
+    }
+
+    return ResolvedId();
+}
+
+//-----------------------------------------------------------------------------
+// Function: MultipleParameterFinder::rebuildIndex()
+//-----------------------------------------------------------------------------
+void MultipleParameterFinder::rebuildIndex() const
+{
+    resolvedIds_.clear();
+    indexedGeneration_ = Parameter::getIdGeneration();
+
+    for (QSharedPointer<ParameterFinder> const& finder : finders_)
+    {
+        for (QString const& id : finder->getAllParameterIds())
+        {
+            if (!resolvedIds_.contains(id))
+            {
+                resolvedIds_.insert(id, ResolvedId{ finder, finder->getParameterWithID(id) });
+            }
+        }
+    }
+
+    indexValid_ = true;
+}
@@ -83,6 +83,8 @@ void ParameterCache::registerParameterModel(QAbstractItemModel const* model)
 //-----------------------------------------------------------------------------
 void ParameterCache::resetCache()
 {
+    invalidateIndex();
+
     availableParameters_.clear();
     for(QString const& id : ComponentParameterFinder::getAllParameterIds())
     {
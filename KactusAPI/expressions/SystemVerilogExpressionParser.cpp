@@ -53,6 +53,8 @@ namespace
         UNARY_OPERATOR.pattern() % QStringLiteral("|") %
         TERNARY_OPERATOR.pattern());
 
+    const QRegularExpression SYMBOL_SEPARATOR(ANY_OPERATOR.pattern() % QStringLiteral("|[(){}\\[\\],\\s]"));
+
     const QRegularExpression LITERAL_EXPRESSION(QStringLiteral("^\\s*(") % SystemVerilogSyntax::INTEGRAL_NUMBER%
         QStringLiteral("|") % SystemVerilogSyntax::REAL_NUMBER% QStringLiteral(")\\s*$"));
 
@@ -107,6 +109,77 @@ int SystemVerilogExpressionParser::baseForExpression(QStringView expression) con
     return greatestBase;
 }
 
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::evaluate()
+//-----------------------------------------------------------------------------
+ExpressionParser::Evaluation SystemVerilogExpressionParser::evaluate(QStringView expression) const
+{
+    Evaluation result;
+
+    // Copy of expression needs to be created for replacing unary minuses with special character.
+    QString expressionCopy = expression.toString();
+    QVector<QStringView> rpn = convertToRPN(expressionCopy);
+
+    for (auto const& token : rpn)
+    {
+        if (isLiteral(token))
+        {
+            result.base = qMax(result.base, baseOf(token));
+        }
+        else if (isSymbol(token))
+        {
+            result.base = qMax(result.base, getBaseForSymbol(token));
+            result.references.append(token.toString());
+        }
+    }
+
+    result.value = solveRPN(std::move(rpn), &result.valid);
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::findSymbols()
+//-----------------------------------------------------------------------------
+QVector<QStringView> SystemVerilogExpressionParser::findSymbols(QString const& expression)
+{
+    QVector<QStringView> symbols;
+
+    const auto SIZE = expression.size();
+    for (qsizetype index = 0; index < SIZE; /*index incremented inside loop*/)
+    {
+        const QChar current = expression.at(index);
+        if (current.isSpace() || current == OPEN_PARENTHESIS || current == CLOSE_PARENTHESIS ||
+            current == OPEN_ARRAY || current == CLOSE_ARRAY || current == QLatin1Char('[') ||
+            current == QLatin1Char(']') || current == QLatin1Char(','))
+        {
+            ++index;
+        }
+        else if (QRegularExpressionMatch literalMatch = PRIMARY_LITERAL.match(expression, index,
+            QRegularExpression::NormalMatch, QRegularExpression::AnchorAtOffsetMatchOption);
+            literalMatch.hasMatch() && literalMatch.capturedLength() > 0)
+        {
+            index += literalMatch.capturedLength();
+        }
+        else if (QRegularExpressionMatch operatorMatch = ANY_OPERATOR.match(expression, index,
+            QRegularExpression::NormalMatch, QRegularExpression::AnchorAtOffsetMatchOption);
+            operatorMatch.hasMatch())
+        {
+            index += operatorMatch.capturedLength();
+        }
+        else
+        {
+            // Everything up to the next operator or separator is a single symbol, as in the conversion to RPN.
+            auto symbol = QStringView(expression);
+            symbol = symbol.mid(index, SYMBOL_SEPARATOR.match(expression, index).capturedStart() - index);
+
+            symbols.append(symbol);
+            index += symbol.length();
+        }
+    }
+
+    return symbols;
+}
+
 //-----------------------------------------------------------------------------
 // Function: SystemVerilogExpressionParser::convertToRPN()
 //-----------------------------------------------------------------------------
@@ -676,7 +749,7 @@ QString SystemVerilogExpressionParser::parseConstant(QStringView token) const
 
     // Remove formating of the number.
     auto formattedToken = token.toString();
-    static QRegularExpression prefix(QStringLiteral("^([1-9][0-9_]*)?'[sS]?[dDbBoOhH]?"));
+    static const QRegularExpression prefix(QStringLiteral("^([1-9][0-9_]*)?'[sS]?[dDbBoOhH]?"));
     formattedToken.remove(0, prefix.match(token).capturedLength());
     formattedToken.remove(QLatin1Char('_'));
 
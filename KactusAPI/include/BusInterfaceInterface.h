@@ -15,6 +15,8 @@
 #include <NameGroupInterface.h>
 #include <ParameterizableInterface.h>
 
+#include <KactusAPI/include/NameIndex.h>
+
 #include <IPXACTmodels/generaldeclarations.h>
 #include <IPXACTmodels/common/ConfigurableVLNVReference.h>
 #include <IPXACTmodels/common/Document.h>
@@ -864,6 +866,9 @@ private:
     //! The available bus interfaces.
     QSharedPointer<QList<QSharedPointer<BusInterface> > > busInterfaces_;
 
+    //! Name index of the available bus interfaces.
+    NameIndex<BusInterface> busIndex_;
+
     //! Validator for bus interfaces.
     QSharedPointer<BusInterfaceValidator> busValidator_;
 
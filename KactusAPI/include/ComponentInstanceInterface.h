@@ -14,6 +14,8 @@
 
 #include <NameGroupInterface.h>
 
+#include <KactusAPI/include/NameIndex.h>
+
 #include <QSharedPointer>
 
 class Design;
@@ -207,6 +209,9 @@ private:
     //! The available component instances.
     QSharedPointer<QList<QSharedPointer<ComponentInstance> > > componentInstances_;
 
+    //! Name index of the available component instances.
+    NameIndex<ComponentInstance> instanceIndex_;
+
     //! Interface for accessing design interconnections.
     InterconnectionInterface* connectionInterface_;
 
@@ -16,11 +16,27 @@
 
 #include "KactusAPI/KactusAPIGlobal.h"
 
+#include <QHash>
+#include <QList>
+#include <QSharedPointer>
+#include <QVector>
+
+#include <functional>
+
 class AbstractParameterModel;
 class Component;
+class MemoryMapBase;
 
 //-----------------------------------------------------------------------------
 //! The implementation for finding parameters with the correct ID.
+//!
+//! The parameters are looked up from an index built on the first search. A found parameter is checked to still
+//! be in its indexed position in the component and to have the searched id, so removed, replaced and renamed
+//! parameters cause a rebuild. A missing id causes a rebuild only if parameters have been created or their ids
+//! changed since the index was built, which covers the added parameters.
+//!
+//! The index is updated by the const searches, so a finder must not be searched from several threads at once.
+//! Parallel users, such as the document generators, create a finder of their own for each task.
 //-----------------------------------------------------------------------------
 class KACTUS2_API ComponentParameterFinder : public ParameterFinder
 {
@@ -157,7 +173,59 @@ protected:
      */
     QSharedPointer<const Component> getComponent() const noexcept;
 
+    /*!
+     *  Invalidates the parameter index, forcing it to be rebuilt on the next search.
+     */
+    void invalidateIndex() noexcept;
+
 private:
+
+    //! The parameter list of an element, or null if the element is no longer in its indexed position.
+    using ParameterOwner = std::function<QSharedPointer<QList<QSharedPointer<Parameter> > >()>;
+
+    //! The indexed position of a parameter.
+    struct IndexEntry
+    {
+        //! The indexed parameter.
+        QSharedPointer<Parameter> parameter;
+
+        //! The element containing the parameter in the parameter owners.
+        int owner = 0;
+
+        //! The position of the parameter in the parameter list of the owner.
+        int position = 0;
+    };
+
+    /*!
+     *  Rebuilds the parameter index from the component parameters.
+     */
+    void rebuildIndex() const;
+
+    /*!
+     *  Adds the parameters of an element to the index. Parameters with already indexed ids are skipped.
+     *
+     *    @param [in] owner   The element containing the parameters.
+     */
+    void addToIndex(ParameterOwner const& owner) const;
+
+    /*!
+     *  Adds the register parameters of a memory map to the index.
+     *
+     *    @param [in] memoryMap   The memory map containing the registers.
+     *    @param [in] mapOwner    Checks that the memory map is still in its indexed position.
+     */
+    void addRegistersToIndex(QSharedPointer<MemoryMapBase> const& memoryMap,
+        std::function<bool()> const& mapOwner) const;
+
+    /*!
+     *  Checks if an indexed parameter is still in its position in the component and has the given id.
+     *
+     *    @param [in] entry   The index entry of the parameter.
+     *    @param [in] id      The id the parameter was found with.
+     *
+     *    @return True, if the indexed position is current, otherwise false.
+     */
+    bool isCurrent(IndexEntry const& entry, QStringView id) const;
     
     /*!
      *  Returns number of parameters in bus interfaces.
@@ -175,6 +243,18 @@ private:
 
     //! The parameters are searched from this component.
     QSharedPointer<Component const> component_;
+
+    //! The component parameters indexed by their ids.
+    mutable QHash<QString, IndexEntry> parameterIndex_;
+
+    //! The elements containing the indexed parameters.
+    mutable QVector<ParameterOwner> parameterOwners_;
+
+    //! The generation of the parameter ids when the index was built.
+    mutable unsigned int indexedGeneration_ = 0;
+
+    //! Flag for indicating the index matches the current component.
+    mutable bool indexValid_ = false;
 };
 
 #endif // COMPONENTPARAMETERFINDER_H
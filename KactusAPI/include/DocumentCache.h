@@ -0,0 +1,105 @@
+//-----------------------------------------------------------------------------
+// File: DocumentCache.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Binary cache of the parsed XML content of IP-XACT documents.
+//-----------------------------------------------------------------------------
+
+#ifndef DOCUMENTCACHE_H
+#define DOCUMENTCACHE_H
+
+#include <KactusAPI/KactusAPIGlobal.h>
+
+#include <QString>
+
+class QDomDocument;
+
+//-----------------------------------------------------------------------------
+//! Binary cache of the parsed XML content of IP-XACT documents.
+//!
+//! The XML tree of a document file is stored in a compact binary file with a shared string table, so it can
+//! be restored without tokenizing and decoding the XML text again. Each cache file is keyed by the path,
+//! modification time and size of its source file and is ignored when any of them no longer match. A source is
+//! cached only when it is parsed a second time without changes, so files read once, e.g. during the library
+//! integrity scan, cost no cache writes. The cache files are kept in the cache location of the application and
+//! may be deleted at any time. The files of removed or changed sources are deleted by prune(), which also keeps
+//! the total size of the cache bounded.
+//-----------------------------------------------------------------------------
+namespace DocumentCache
+{
+    //! Source files smaller than this are faster to parse than to restore and are not cached.
+    const qint64 MINIMUM_FILE_SIZE = 64 * 1024;
+
+    //! The default limit for the total size of the cache files.
+    const qint64 MAXIMUM_CACHE_SIZE = 512 * 1024 * 1024;
+
+    /*!
+     *  Enable or disable the cache. The cache is enabled by default.
+     *
+     *    @param [in] enabled     Flag for enabling the cache.
+     */
+    KACTUS2_API void setEnabled(bool enabled);
+
+    /*!
+     *  Check if the cache is enabled.
+     *
+     *    @return True, if the cache is enabled, otherwise false.
+     */
+    KACTUS2_API bool isEnabled();
+
+    /*!
+     *  Get the path to the cache file of a source file.
+     *
+     *    @param [in] sourcePath  Path to the source file.
+     *
+     *    @return Path to the cache file.
+     */
+    KACTUS2_API QString cachePath(QString const& sourcePath);
+
+    /*!
+     *  Restore the XML content of a source file from the cache.
+     *
+     *    @param [in] sourcePath  Path to the source file.
+     *    @param [out] document   The restored XML content.
+     *
+     *    @return True, if an up-to-date cache file was found and restored, otherwise false.
+     */
+    KACTUS2_API bool read(QString const& sourcePath, QDomDocument& document);
+
+    /*!
+     *  Store the XML content of a source file in the cache.
+     *
+     *    @param [in] sourcePath  Path to the source file.
+     *    @param [in] document    The XML content parsed from the source file.
+     *
+     *    @return True, if the cache file was written, otherwise false.
+     */
+    KACTUS2_API bool write(QString const& sourcePath, QDomDocument const& document);
+
+    /*!
+     *  Store the XML content of a source file in the cache, if the same unchanged file has been parsed before.
+     *  Otherwise the file is only recorded as parsed.
+     *
+     *    @param [in] sourcePath  Path to the source file.
+     *    @param [in] document    The XML content parsed from the source file.
+     *
+     *    @return True, if the cache file was written, otherwise false.
+     */
+    KACTUS2_API bool writeIfParsedBefore(QString const& sourcePath, QDomDocument const& document);
+
+    /*!
+     *  Remove the cache files whose source files have been removed or changed. If the remaining files exceed
+     *  the size limit, the least recently written files are removed until the cache fits in the limit.
+     *
+     *    @param [in] maximumSize     The limit for the total size of the cache files in bytes.
+     *
+     *    @return The number of removed cache files.
+     */
+    KACTUS2_API int prune(qint64 maximumSize = MAXIMUM_CACHE_SIZE);
+};
+
+#endif // DOCUMENTCACHE_H
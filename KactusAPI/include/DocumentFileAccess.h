@@ -29,7 +29,7 @@ namespace DocumentFileAccess
     //! Reads the document from given path.
     KACTUS2_API QSharedPointer<Document> readDocument(QString const& path);
 
-    //! Writes to document model to the given path.
+    //! Writes to document model to the given path. The file is replaced only after the document is complete.
     KACTUS2_API bool writeDocument(QSharedPointer<Document> model, QString const& path);
 
 };
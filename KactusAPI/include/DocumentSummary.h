@@ -0,0 +1,121 @@
+//-----------------------------------------------------------------------------
+// File: DocumentSummary.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Compact record of the document data needed by the library views.
+//-----------------------------------------------------------------------------
+
+#ifndef DOCUMENTSUMMARY_H
+#define DOCUMENTSUMMARY_H
+
+#include <KactusAPI/KactusAPIGlobal.h>
+
+#include <IPXACTmodels/common/Document.h>
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <IPXACTmodels/kactusExtensions/KactusAttribute.h>
+
+#include <QDataStream>
+#include <QList>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+//! Compact record of the document data needed by the library views.
+//!
+//! The summary lets the library tree and hierarchy be built and decorated without keeping the parsed
+//! documents in memory. Summaries are stored in the library index between sessions.
+//-----------------------------------------------------------------------------
+struct KACTUS2_API DocumentSummary
+{
+    //! A hierarchical view of a component.
+    struct HierarchicalView
+    {
+        //! Name of the view.
+        QString name;
+
+        //! The design referenced by the design instantiation of the view.
+        VLNV designReference;
+
+        //! The design configuration referenced by the design configuration instantiation of the view.
+        VLNV configurationReference;
+    };
+
+    /*!
+     *  The constructor.
+     */
+    DocumentSummary() = default;
+
+    /*!
+     *  Create a summary of the given document.
+     *
+     *    @param [in] document    The document to summarize.
+     */
+    explicit DocumentSummary(QSharedPointer<Document const> document);
+
+    //! The type of the document.
+    VLNV::IPXactType type = VLNV::INVALID;
+
+    //! The IP-XACT standard revision of the document.
+    Document::Revision revision = Document::Revision::Unknown;
+
+    //! The description of the document.
+    QString description;
+
+    //! The implementation type of the document.
+    KactusAttribute::Implementation implementation = KactusAttribute::KTS_IMPLEMENTATION_COUNT;
+
+    //! The firmness of the document.
+    KactusAttribute::Firmness firmness = KactusAttribute::KTS_REUSE_LEVEL_COUNT;
+
+    //! Flag for a component with hierarchical views.
+    bool hierarchical = false;
+
+    //! Flag for a component with views.
+    bool hasViews = false;
+
+    //! The hierarchical views of a component.
+    QVector<HierarchicalView> hierarchicalViews;
+
+    //! The design referenced by a design configuration.
+    VLNV designReference;
+
+    //! The components instantiated in a design, excluding drafts. Repeated for each instance.
+    QVector<VLNV> instantiatedComponents;
+
+    //! The bus definition of an abstraction definition.
+    VLNV busType;
+
+    //! The catalogs, bus definitions, abstraction definitions and components listed in a catalog.
+    QVector<VLNV> catalogItems;
+
+    //! The VLNVs the document depends on.
+    QList<VLNV> dependentVLNVs;
+};
+
+/*!
+ *  Write a document summary to a data stream.
+ *
+ *    @param [in] stream      The stream to write to.
+ *    @param [in] summary     The summary to write.
+ *
+ *    @return The stream.
+ */
+KACTUS2_API QDataStream& operator<<(QDataStream& stream, DocumentSummary const& summary);
+
+/*!
+ *  Read a document summary from a data stream.
+ *
+ *    @param [in] stream      The stream to read from.
+ *    @param [out] summary    The summary to read.
+ *
+ *    @return The stream.
+ */
+KACTUS2_API QDataStream& operator>>(QDataStream& stream, DocumentSummary& summary);
+
+#endif // DOCUMENTSUMMARY_H
@@ -0,0 +1,83 @@
+//-----------------------------------------------------------------------------
+// File: ExpressionEvaluationCache.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Cache for the evaluation results of expressions.
+//-----------------------------------------------------------------------------
+
+#ifndef EXPRESSIONEVALUATIONCACHE_H
+#define EXPRESSIONEVALUATIONCACHE_H
+
+#include "ExpressionParser.h"
+
+#include "KactusAPI/KactusAPIGlobal.h"
+
+#include <QHash>
+#include <QSharedPointer>
+#include <QString>
+
+//-----------------------------------------------------------------------------
+//! Cache for the evaluation results of expressions.
+//!
+//! The results depend on the values of the referenced parameters, so the owner must clear the cache whenever
+//! the parameters may have changed. The cache is not thread-safe.
+//-----------------------------------------------------------------------------
+class KACTUS2_API ExpressionEvaluationCache
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] parser  The parser used to evaluate the expressions.
+     */
+    explicit ExpressionEvaluationCache(QSharedPointer<ExpressionParser> parser);
+
+    //! The destructor.
+    ~ExpressionEvaluationCache() = default;
+
+    // Disable copying.
+    ExpressionEvaluationCache(ExpressionEvaluationCache const& rhs) = delete;
+    ExpressionEvaluationCache& operator=(ExpressionEvaluationCache const& rhs) = delete;
+
+    /*!
+     *  Get the evaluation results of an expression, evaluating it on the first request.
+     *
+     *    @param [in] expression  The expression to evaluate.
+     *
+     *    @return The evaluation results.
+     */
+    ExpressionParser::Evaluation const& evaluate(QString const& expression);
+
+    /*!
+     *  Get the formatted value of an expression.
+     *
+     *    @param [in] expression  The expression whose value to format.
+     *
+     *    @return The value in the base of the expression, or n/a for an invalid expression.
+     */
+    QString formattedValue(QString const& expression);
+
+    /*!
+     *  Remove all the cached results.
+     */
+    void clear();
+
+private:
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The parser used to evaluate the expressions.
+    QSharedPointer<ExpressionParser> parser_;
+
+    //! The evaluation results keyed by the expression.
+    QHash<QString, ExpressionParser::Evaluation> evaluations_;
+};
+
+#endif // EXPRESSIONEVALUATIONCACHE_H
@@ -13,12 +13,12 @@
 #define EXPRESSIONFORMATTER_H
 
 #include "ParameterFinder.h"
+#include "ExpressionParser.h"
 
 #include "KactusAPI/KactusAPIGlobal.h"
 
 #include <QSharedPointer>
 
-class ExpressionParser;
 
 //-----------------------------------------------------------------------------
 //! Expression formatter.
@@ -51,6 +51,15 @@ public:
 
     static QString format(QString const& expression, QSharedPointer<ExpressionParser> parser);
 
+    /*!
+     *  Format the value of an already evaluated expression in the base of the expression.
+     *
+     *    @param [in] evaluation  The evaluated expression.
+     *
+     *    @return The formatted value, or n/a for an invalid expression.
+     */
+    static QString formatEvaluation(ExpressionParser::Evaluation const& evaluation);
+
 private:
 
 	//! No copying
@@ -13,6 +13,7 @@
 #define EXPRESSIONPARSER_H
 
 #include <QString>
+#include <QStringList>
 #include <QPair>
 
 //-----------------------------------------------------------------------------
@@ -22,6 +23,22 @@ class ExpressionParser
 {
 public:
 
+    //! The results of evaluating a single expression.
+    struct Evaluation
+    {
+        //! The decimal value of the expression.
+        QString value;
+
+        //! The common base for the expression.
+        int base = 0;
+
+        //! Flag for the expression being valid.
+        bool valid = false;
+
+        //! The symbols referenced in the expression.
+        QStringList references;
+    };
+
 	//! The destructor.
     virtual ~ExpressionParser() = default;
 
@@ -52,6 +69,22 @@ public:
      *    @return The common base for the expression.
      */
     virtual int baseForExpression(QStringView expression) const = 0;
+
+    /*!
+     *  Evaluates the value, the common base and the referenced symbols of an expression.
+     *  Parsers should override this to solve all of them from a single tokenization.
+     *
+     *    @param [in] expression   The expression to evaluate.
+     *
+     *    @return The evaluation results.
+     */
+    virtual Evaluation evaluate(QStringView expression) const
+    {
+        Evaluation result;
+        result.value = parseExpression(expression, &result.valid);
+        result.base = baseForExpression(expression);
+        return result;
+    }
 };
 
 #endif // EXPRESSIONPARSER_H
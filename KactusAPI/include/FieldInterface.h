@@ -13,6 +13,7 @@
 #define FIELDINTERFACE_H
 
 #include <KactusAPI/KactusAPIGlobal.h>
+#include <KactusAPI/include/NameIndex.h>
 
 #include <ParameterizableInterface.h>
 #include <NameGroupInterface.h>
@@ -969,6 +970,9 @@ private:
     //! List of the contained fields.
     QSharedPointer<QList<QSharedPointer<Field> > > fields_;
 
+    //! Name index of the contained fields.
+    NameIndex<Field> fieldIndex_;
+
     //! Validator for fields.
     QSharedPointer<FieldValidator> validator_;
 
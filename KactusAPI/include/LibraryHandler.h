@@ -15,12 +15,14 @@
 #include "LibraryInterface.h"
 #include "LibraryLoader.h"
 #include "LibraryTreeModel.h"
+#include "LibraryWatcher.h"
 #include "hierarchymodel.h"
 
 #include "NullChannel.h"
 #include "utils.h"
 
 #include "DocumentFileAccess.h"
+#include "DocumentSummary.h"
 #include "DocumentValidator.h"
 
 #include <IPXACTmodels/common/Document.h>
@@ -30,11 +32,13 @@
 
 #include <KactusAPI/KactusAPIGlobal.h>
 
+#include <QFutureWatcher>
 #include <QString>
 #include <QStringList>
 #include <QList>
 #include <QSharedPointer>
 #include <QObject>
+#include <QThreadPool>
 
 class LibraryItem;
 class MessageMediator;
@@ -48,6 +52,17 @@ class KACTUS2_API LibraryHandler : public QObject, public LibraryInterface
 
 public:
 
+    //! Statistics of the parsed documents kept in the library cache.
+    struct CacheStatistics
+    {
+        quint64 hits = 0;           //!< Document requests served without reading the file.
+        quint64 misses = 0;         //!< Document requests that read the file.
+        quint64 evictions = 0;      //!< Parsed documents released from the cache.
+        int residentDocuments = 0;  //!< Number of parsed documents in the cache.
+        qint64 residentSize = 0;    //!< Estimated memory used by the parsed documents in bytes.
+        qint64 budget = 0;          //!< Memory budget for the parsed documents in bytes.
+    };
+
     //! The the instance of the library.
     static LibraryHandler& getInstance();
 
@@ -57,8 +72,8 @@ public:
     //! No assignment
     LibraryHandler& operator=(const LibraryHandler& other) = delete;
 
-    //! The destructor
-    ~LibraryHandler() final = default;
+    //! The destructor. Waits for the documents being saved.
+    ~LibraryHandler() final;
 
     void setOutputChannel(MessageMediator* messageChannel);
 
@@ -82,6 +97,17 @@ public:
     */
     QSharedPointer<Document const> getModelReadOnly(VLNV const& vlnv) final;
 
+    /*! Get the summary of the document that matches given VLNV.
+     *
+     * The summary is taken from the library index, if the document has not changed since the index was
+     * written. Otherwise the document is read and summarized once.
+     *
+     *    @param [in] vlnv Identifies the desired document.
+     *
+     *    @return The summary of the document, or null if the document was not found.
+    */
+    QSharedPointer<DocumentSummary const> getSummary(VLNV const& vlnv) final;
+
     /*! Gets all the VLNVs currently in the library.
      *
      *    @return All known VLNVs in the library.
@@ -118,13 +144,15 @@ public:
      * that directory. The path must not contain the file name.
      * If file already exists in file system it is written over.
      * 
-     * When model is saved using this function it is not necessary to call 
-     * onItemSaved() because it is called by this function.
+     * The model is added to the library immediately and written to the file in the background.
+     * onItemSaved() is called when the file has been written. If the write fails, the model is removed from
+     * the library again and saveFailed() is emitted.
      *
      *    @param [in] path            Directory path that specifies the directory to save to file into.
      *    @param [in] model           The library component that is written.
      * 
-     *    @return True if the model was in valid state and was successfully written.
+     *    @return True if the model was added to the library and its write was started, false if the file
+     *            cannot be written.
      */
     bool writeModelToFile(QString const& path, QSharedPointer<Document> model) final;
 
@@ -134,10 +162,15 @@ public:
      * it's file path can be found. The changes made to the model are written
      * to the previous file so the model can not be restored to it's previous 
      * state after this operation.
+     *
+     * The file is written in the background and replaced only when the new content is complete.
+     * onItemSaved() is called when the file has been written. If the write fails, the file is left as it was,
+     * the previously written model is restored in the library and saveFailed() is emitted.
      * 
      *    @param [in] model           The model to be written.
      * 
-     *    @return True if the model was in valid state and was successfully written.
+     *    @return True if the model was updated in the library and its write was started, false if the file
+     *            cannot be written.
     */
     bool writeModelToFile(QSharedPointer<Document> model) final;
 
@@ -263,6 +296,36 @@ public:
      */
     QVector<QString> findErrorsInDocument(QSharedPointer<Document> document, QString const& path);
 
+    /*!
+     *  Set the memory budget for the parsed documents in the cache. The least recently used documents are
+     *  released when the budget is exceeded.
+     *
+     *    @param [in] budget    The budget in bytes.
+     */
+    void setCacheBudget(qint64 budget);
+
+    /*!
+     *  Get the statistics of the parsed documents in the cache.
+     *
+     *    @return The cache statistics.
+     */
+    CacheStatistics getCacheStatistics() const;
+
+    /*!
+     *  Keep the parsed document in the cache regardless of the memory budget, e.g. while it is open in an
+     *  editor. Each call must be matched by a call to unpinDocument().
+     *
+     *    @param [in] vlnv    Identifies the document to pin.
+     */
+    void pinDocument(VLNV const& vlnv);
+
+    /*!
+     *  Release a pin set with pinDocument().
+     *
+     *    @param [in] vlnv    Identifies the document to unpin.
+     */
+    void unpinDocument(VLNV const& vlnv);
+
 public slots:
 
     /*! Check the library items for validity
@@ -345,11 +408,20 @@ public slots:
     */
     void endSave();
 
+    //! Wait until the documents being saved in the background have been written to their files.
+    void waitForSaves() final;
+
 signals:
 
 
     void progressStatus();
 
+    //! Inform that the file of a document could not be written and the saved changes were not stored.
+    void saveFailed(VLNV const& vlnv);
+
+    //! Inform that the file of a document was modified outside the library and the document was read again.
+    void documentFileChanged(VLNV const& vlnv);
+
     //! Signal that user wants to open the specified component for editing.
     void openDesign(VLNV const& vlnv, const QString& viewName);
 
@@ -400,7 +472,7 @@ signals:
 
 private slots:
     
-    /*! This function should be called every time an object is written to disk.
+    /*! This function is called every time an object has been written to disk.
     * 
     * This function makes sure that the library object is displayed correctly 
     * on library views and possible changes made to the object are updated to
@@ -411,6 +483,16 @@ private slots:
     */
     void onItemSaved(VLNV const& vlnv);
 
+    /*!
+     *  Updates the library with the IP-XACT files changed outside the library.
+     *
+     *    @param [in] addedFiles      Paths to the added files.
+     *    @param [in] removedFiles    Paths to the removed files.
+     *    @param [in] modifiedFiles   Paths to the modified files.
+     */
+    void onLibraryFilesChanged(QStringList const& addedFiles, QStringList const& removedFiles,
+        QStringList const& modifiedFiles);
+
 private:
 
     //! All relevant data about an IP-XACT document is stored in DocumentInfo.
@@ -419,11 +501,24 @@ private:
         QSharedPointer<Document> document;  //<! The model for the document.
         QString path;                       //<! The path to the file containing the document.
         bool isValid;                       //<! Flag for well-formed content.
+        QSharedPointer<DocumentSummary const> summary;  //<! The summary of the document.
+        QWeakPointer<Document> released;    //<! The model released from the cache, while still in use.
+        qint64 residentSize = 0;            //<! The estimated memory used by the model.
+        quint64 lastUse = 0;                //<! The order of the latest use of the model.
 
         //! Constructor.
         explicit DocumentInfo(QString const& filePath = QString(), 
             QSharedPointer<Document> doc = QSharedPointer<Document>(),
-            bool valid = false): document(doc), path(filePath), isValid(valid) {}
+            bool valid = false): document(doc), path(filePath), isValid(valid),
+            summary(doc.isNull() ? nullptr : new DocumentSummary(doc)) {}
+    };
+
+    //! A document being written to its file in the background.
+    struct SaveInProgress
+    {
+        QFutureWatcher<bool>* watcher = nullptr;  //<! Watches the write of the file.
+        VLNV vlnv;                                  //<! Identifies the saved document.
+        DocumentInfo savedInfo;                     //<! The cache entry of the saved document.
     };
 
     //! Struct for collecting document statistics e.g. in export.
@@ -451,18 +546,110 @@ private:
     //! Show error message for VLNV not found in the library.
     void showNotFoundError(VLNV const& vlnv) const;
 
-    //! Adds a IP-XACT document into the library cache.
+    //! Adds a IP-XACT document into the library cache and starts writing it to the given file.
     bool addObject(QSharedPointer<Document> model, QString const& filePath);
 
+    /*!
+     *  Write a document to its file in the background. onItemSaved() is called when the write is complete,
+     *  and the previously written document is restored if the write fails.
+     *
+     *    @param [in] vlnv        Identifies the document.
+     *    @param [in] savedInfo   The cache entry of the saved document. The document must not be modified
+     *                            afterwards.
+     */
+    void saveInBackground(VLNV const& vlnv, DocumentInfo const& savedInfo);
+
+    /*!
+     *  Update the library after a background write has finished. Does nothing, if the write was already
+     *  completed.
+     *
+     *    @param [in] watcher     The watcher of the finished write.
+     */
+    void completeSave(QFutureWatcher<bool>* watcher);
+
+    /*!
+     *  Restore the cache entry matching the file of a document after a failed write. A document that was
+     *  never written is removed from the library.
+     *
+     *    @param [in] vlnv    Identifies the document.
+     */
+    void restoreWrittenDocument(VLNV const& vlnv);
+
+    /*!
+     *  Remove a document from the library cache and the data models. The file is not removed.
+     *
+     *    @param [in] vlnv    Identifies the document.
+     */
+    void forgetDocument(VLNV const& vlnv);
+
     //! Clears the library cache of documents.
     void clearCache();
 
-    //! Loads all available VLNVs into the library cache.
-    void loadAvailableVLNVs();
+    /*!
+     *  Loads all available VLNVs into the library cache.
+     *
+     *    @return The VLNVs of the documents whose files have changed since the library index was written.
+     */
+    QVector<VLNV> loadAvailableVLNVs();
+
+    //! Writes the VLNVs, paths and summaries of the library cache to the library index.
+    void writeLibraryIndex() const;
+
+    /*!
+     *  Get the model of a document in the cache. The document is read, if the cache does not hold the model.
+     *
+     *    @param [in] info    The cache entry of the document.
+     *
+     *    @return The model of the document.
+     */
+    QSharedPointer<Document> loadDocument(QMap<VLNV, DocumentInfo>::iterator info);
+
+    /*!
+     *  Store a document in the cache, replacing any previous entry for the same VLNV.
+     *
+     *    @param [in] vlnv    Identifies the document.
+     *    @param [in] info    The cache entry of the document.
+     */
+    void storeDocument(VLNV const& vlnv, DocumentInfo const& info);
+
+    /*!
+     *  Count the model of a cache entry in the resident documents and mark it as the most recently used.
+     *
+     *    @param [in] vlnv    Identifies the document.
+     *    @param [in] info    The cache entry of the document.
+     */
+    void addResident(VLNV const& vlnv, DocumentInfo& info);
+
+    /*!
+     *  Mark the model of a cache entry as the most recently used.
+     *
+     *    @param [in] vlnv    Identifies the document.
+     *    @param [in] info    The cache entry of the document.
+     */
+    void markUsed(VLNV const& vlnv, DocumentInfo& info);
+
+    /*!
+     *  Remove the model of a cache entry from the resident documents.
+     *
+     *    @param [in] info    The cache entry of the document.
+     */
+    void removeResident(DocumentInfo& info);
+
+    //! Release the least recently used unpinned models until the resident documents fit in the budget.
+    void enforceCacheBudget();
 
     //! Resets the tree and hierarchy model.
     void resetModels();
 
+    /*!
+     *  Updates the tree and hierarchy model with the differences of the library cache to a previous scan.
+     *  The models are reset, if most of the library has changed.
+     *
+     *    @param [in] previousValidity    The documents and their validity in the previous scan.
+     *    @param [in] changedDocuments    The documents whose files have changed since the previous scan.
+     */
+    void updateModels(QMap<VLNV, bool> const& previousValidity, QVector<VLNV> const& changedDocuments);
+
     //! Shows the results of the library integrity check.
     void showIntegrityResults() const;
 
@@ -579,6 +766,33 @@ private:
     //! Statistics for library integrity check.
     DocumentStatistics checkResults_;
 
+    //! Statistics of the parsed documents in the cache.
+    CacheStatistics cacheStatistics_;
+
+    //! Counter for ordering the uses of the parsed documents.
+    quint64 useCounter_{ 0 };
+
+    //! The VLNVs of the resident documents ordered from the least recently used, keyed by their latest use.
+    QMap<quint64, VLNV> residentOrder_;
+
+    //! The pin counts of the documents kept in the cache regardless of the budget.
+    QMap<VLNV, int> pinnedDocuments_;
+
+    //! Writes the saved documents one at a time in the order they were saved.
+    QThreadPool saveThreads_;
+
+    //! The number of writes pending for each document being saved.
+    QMap<VLNV, int> pendingSaves_;
+
+    //! The cache entries matching the files of the documents being saved.
+    QMap<VLNV, DocumentInfo> writtenDocuments_;
+
+    //! The background writes not yet completed in the order they were started.
+    QList<SaveInProgress> savesInProgress_;
+
+    //! Watches the library locations for files changed outside the library.
+    LibraryWatcher libraryWatcher_;
+
 };
 
 #endif // LIBRARYHANDLER_H
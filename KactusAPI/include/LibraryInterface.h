@@ -20,6 +20,7 @@
 class Design;
 class LibraryItem;
 class Document;
+struct DocumentSummary;
 
 //-----------------------------------------------------------------------------
 //! LibraryInterface defines an interface to operate the IP-XACT-library.
@@ -71,6 +72,15 @@ public:
         return getModelReadOnly(vlnv).dynamicCast<T const>();
     }
 
+    /*! Get the summary of the document that matches given VLNV. Should be used instead of the model when only
+     *  the summarized data is needed, since the summary is available without parsing the document.
+     *
+     *    @param [in] vlnv    Identifies the desired document.
+     *
+     *    @return The summary of the document, or null if the document was not found.
+    */
+    virtual QSharedPointer<DocumentSummary const> getSummary(VLNV const& vlnv) = 0;
+
     /*! Checks if the library already contains the specified VLNV.
      *
      *    @param [in] vlnv    The VLNV that is searched within the library.
@@ -285,6 +295,9 @@ public slots:
     */
     virtual void endSave() = 0;
 
+    //! Wait until the documents being saved in the background have been written to their files.
+    virtual void waitForSaves() = 0;
+
 signals:
 
     //! Signal that user wants to open the specified component for editing.
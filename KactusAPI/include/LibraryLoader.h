@@ -13,12 +13,15 @@
 #define LIBRARYLOADER_H
 
 #include "DocumentFileAccess.h"
+#include "DocumentSummary.h"
 
 #include <KactusAPI/include/MessageMediator.h>
 
 #include <IPXACTmodels/common/VLNV.h>
 
+#include <QHash>
 #include <QObject>
+#include <QSharedPointer>
 
 //-----------------------------------------------------------------------------
 //! Class for IP-XACT file search and type parsing.
@@ -32,10 +35,13 @@ public:
     {
         QString path; //!< The path to IP-XACT file.
         VLNV vlnv;    //!< The VLNV defined in the file.
+        QSharedPointer<DocumentSummary const> summary;  //!< The summary of the document, if known.
+        bool unchanged = false;     //!< True, if the file has not changed since the library index was written.
 
 		//! Constructor.
-        LoadTarget(VLNV const& targetVLNV = VLNV(), QString targetPath = QString()): 
-            path(targetPath), vlnv(targetVLNV) {}
+        LoadTarget(VLNV const& targetVLNV = VLNV(), QString targetPath = QString(),
+            QSharedPointer<DocumentSummary const> targetSummary = QSharedPointer<DocumentSummary const>()):
+            path(targetPath), vlnv(targetVLNV), summary(targetSummary) {}
     };
 
 	/*! Cleans the directory structure.
@@ -44,13 +50,18 @@ public:
 	*/
     void clean(QStringList const& changedDirectories) const;
 
-	/*! Searches for IP-XACT files and returns any found targets.
+	/*! Searches for IP-XACT files and returns any found targets. The VLNVs and summaries of the files that
+	*   have not changed since the library index was written are taken from the index.
 	*
 	*    @return The found IP-XACT targets.
 	*/
     QVector<LoadTarget> parseLibrary(MessageMediator const* messageChannel) const;
 
-private:
+	/*! Writes the library index for the next search.
+	*
+	*    @param [in] targets     The IP-XACT targets in the library.
+	*/
+    void writeLibraryIndex(QVector<LoadTarget> const& targets) const;
 
     /*! Finds the VLNV in the given file.
     *
@@ -60,6 +71,29 @@ private:
     */
     VLNV getDocumentVLNV(QString const& path, MessageMediator const* messageChannel) const;
 
+private:
+
+    //! Struct for the library index entries.
+    struct IndexEntry
+    {
+        qint64 lastModified = 0;    //!< The modification time of the file when it was indexed.
+        qint64 size = 0;            //!< The size of the file when it was indexed.
+        VLNV vlnv;                  //!< The VLNV defined in the file.
+        QSharedPointer<DocumentSummary const> summary;  //!< The summary of the document, if known.
+    };
+
+    /*! Reads the library index written by a previous search.
+    *
+    *    @return The index entries keyed by the file paths.
+    */
+    QHash<QString, IndexEntry> readLibraryIndex() const;
+
+    /*! Gets the path to the library index file.
+    *
+    *    @return The path to the library index.
+    */
+    static QString libraryIndexPath();
+
     /*! Clear the empty directories from the disk within given path.
      *
      *    @param [in] dirPath The path that is removed until one of the base library locations is reached.
@@ -0,0 +1,192 @@
+//-----------------------------------------------------------------------------
+// File: LibraryWatcher.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Watches the library locations for added, removed and modified IP-XACT files.
+//-----------------------------------------------------------------------------
+
+#ifndef LIBRARYWATCHER_H
+#define LIBRARYWATCHER_H
+
+#include <KactusAPI/KactusAPIGlobal.h>
+
+#include <QFileSystemWatcher>
+#include <QHash>
+#include <QObject>
+#include <QPair>
+#include <QSet>
+#include <QStringList>
+#include <QTimer>
+
+//-----------------------------------------------------------------------------
+//! Watches the library locations for added, removed and modified IP-XACT files.
+//!
+//! The directories and XML files under the locations are watched. Change events are collected for a short
+//! delay and reported in a single batch, so e.g. a version control update of many files causes one refresh.
+//! Only the directories and files that produced events are examined.
+//!
+//! If the system cannot watch more files, only the directories are watched for the rest of the files. The
+//! state of those files is then compared when their directory changes, e.g. when a file is replaced.
+//-----------------------------------------------------------------------------
+class KACTUS2_API LibraryWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    //! The delay for collecting change events into a batch in milliseconds.
+    static const int BATCH_DELAY = 500;
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] parent  The parent object.
+     */
+    explicit LibraryWatcher(QObject* parent = nullptr);
+
+    /*!
+     *  The destructor.
+     */
+    ~LibraryWatcher() final = default;
+
+    //! No copying.
+    LibraryWatcher(LibraryWatcher const& other) = delete;
+    LibraryWatcher& operator=(LibraryWatcher const& other) = delete;
+
+    /*!
+     *  Watch the given library locations. The previously watched locations are no longer watched.
+     *
+     *    @param [in] locations   The library locations to watch.
+     */
+    void watch(QStringList const& locations);
+
+    /*!
+     *  Record the current state of a file written by the library, so the write is not reported as a change.
+     *
+     *    @param [in] filePath    Path to the written file.
+     */
+    void markAsKnown(QString const& filePath);
+
+signals:
+
+    /*!
+     *  Emitted when a batch of changes in the watched locations has been collected.
+     *
+     *    @param [in] added       Paths to the added XML files.
+     *    @param [in] removed     Paths to the removed XML files.
+     *    @param [in] modified    Paths to the modified XML files.
+     */
+    void filesChanged(QStringList const& added, QStringList const& removed, QStringList const& modified);
+
+    /*!
+     *  Emitted when some of the directories or files in the locations cannot be watched.
+     *
+     *    @param [in] message     Description of the paths that are not watched.
+     */
+    void noticeMessage(QString const& message);
+
+private slots:
+
+    //! Called when the content of a watched directory has changed.
+    void onDirectoryChanged(QString const& path);
+
+    //! Called when a watched file has been modified or removed.
+    void onFileChanged(QString const& path);
+
+    //! Examines the collected changes and reports them.
+    void onBatchReady();
+
+private:
+
+    /*!
+     *  Start watching a directory and its subdirectories.
+     *
+     *    @param [in] directory   The directory to watch.
+     *    @param [out] found      The XML files found in the directories.
+     */
+    void watchDirectory(QString const& directory, QStringList& found);
+
+    /*!
+     *  Stop watching a directory and its subdirectories.
+     *
+     *    @param [in] directory   The directory to stop watching.
+     *    @param [out] removed    The XML files that were known in the directories.
+     */
+    void forgetDirectory(QString const& directory, QStringList& removed);
+
+    /*!
+     *  Start watching files. Files that cannot be watched are compared when their directory changes.
+     *
+     *    @param [in] files   Paths to the files to watch.
+     */
+    void watchFiles(QStringList const& files);
+
+    /*!
+     *  Find the files not watched individually that have changed in a directory.
+     *
+     *    @param [in] files       The XML files in the directory.
+     *    @param [out] modified   The changed files.
+     */
+    void compareUnwatchedFiles(QSet<QString> const& files, QStringList& modified);
+
+    /*!
+     *  Check if a file has the state recorded for a write by the library.
+     *
+     *    @param [in] filePath    Path to the file.
+     *
+     *    @return True, if the file was written by the library and has not changed since, otherwise false.
+     */
+    bool isKnownState(QString const& filePath) const;
+
+    /*!
+     *  Get the XML files in a directory.
+     *
+     *    @param [in] directory   The directory to list.
+     *
+     *    @return Paths to the XML files in the directory.
+     */
+    static QSet<QString> listXmlFiles(QString const& directory);
+
+    /*!
+     *  Get the state of a file for detecting changes.
+     *
+     *    @param [in] filePath    Path to the file.
+     *
+     *    @return The modification time and size of the file.
+     */
+    static QPair<qint64, qint64> fileState(QString const& filePath);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The file system watcher.
+    QFileSystemWatcher watcher_;
+
+    //! Timer for collecting the change events into a batch.
+    QTimer batchTimer_;
+
+    //! The XML files in each watched directory.
+    QHash<QString, QSet<QString> > directoryFiles_;
+
+    //! The directories with changed content since the previous batch.
+    QSet<QString> changedDirectories_;
+
+    //! The files changed since the previous batch.
+    QSet<QString> changedFiles_;
+
+    //! The modification time and size of the files written by the library.
+    QHash<QString, QPair<qint64, qint64> > knownStates_;
+
+    //! The modification time and size of the files that could not be watched.
+    QHash<QString, QPair<qint64, qint64> > unwatchedStates_;
+
+    //! If false, the system could not watch more files and only the directories are watched.
+    bool watchFiles_ = true;
+};
+
+#endif // LIBRARYWATCHER_H
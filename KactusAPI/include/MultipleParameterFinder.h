@@ -18,8 +18,18 @@
 
 #include "KactusAPI/KactusAPIGlobal.h"
 
+#include <QHash>
+
 //-----------------------------------------------------------------------------
 //! Parameter finder of multiple components.
+//!
+//! The finders are searched in the order they were added, and the first finder containing an id resolves it.
+//!
+//! The resolving finder and parameter of every id in the finders are collected into a single index, so that an
+//! id is found with one hash probe instead of a probe of each finder. The index is rebuilt when finders are
+//! added or removed, and when parameters have been created or their ids changed since it was built. A found
+//! parameter is checked from its finder, and an id not in the index is searched from the finders in order, so
+//! that parameters removed from or moved into a finder are found correctly.
 //-----------------------------------------------------------------------------
 class KACTUS2_API MultipleParameterFinder : public ParameterFinder
 {
@@ -120,8 +130,44 @@ public:
 
 private:
 
+    //! The finder and the parameter resolving an id.
+    struct ResolvedId
+    {
+        //! The first finder containing the id.
+        QSharedPointer<ParameterFinder> finder;
+
+        //! The parameter with the id in the finder.
+        QSharedPointer<Parameter> parameter;
+    };
+
+    /*!
+     *  Finds the first finder containing the given id and its parameter with the id.
+     *
+     *    @param [in] id      The id to search for.
+     *
+     *    @return The resolving finder and parameter, or null ones if no finder contains the id.
+     */
+    ResolvedId resolve(QStringView id) const;
+
+    /*!
+     *  Rebuilds the index of the ids in all the finders.
+     */
+    void rebuildIndex() const;
+
     //! The finders to use in searches.
     QList<QSharedPointer<ParameterFinder> > finders_;
+
+    //! The ids in the finders with their resolving finders and parameters.
+    mutable QHash<QString, ResolvedId> resolvedIds_;
+
+    //! Flag for indicating the index matches the current finders.
+    mutable bool indexValid_ = false;
+
+    //! The generation of the parameter ids when the index was built.
+    mutable unsigned int indexedGeneration_ = 0;
+
+    //! The parameter returned for ids not found in any finder.
+    QSharedPointer<Parameter> missingParameter_;
 };
 
 #endif // MULTIPLEPARAMETERFINDER_H
@@ -0,0 +1,269 @@
+//-----------------------------------------------------------------------------
+// File: NameIndex.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Name-keyed index of the items in a list of named items.
+//-----------------------------------------------------------------------------
+
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QSharedPointer>
+#include <QString>
+
+#include <string>
+
+//-----------------------------------------------------------------------------
+//! Name-keyed index of the items in a list of named items.
+//!
+//! The index is built on the first lookup and reused while its generation is current: the same list with the
+//! same number of items and no invalidation since the build. Items inserted through the owner of the index are
+//! added to it, and a miss on a current index is answered without a rebuild. Every hit is checked against the
+//! list, so items added, removed or moved outside the owner only cost a rebuild. Items renamed outside the
+//! owner require invalidating the index. If several items share a name, the first one is found.
+//-----------------------------------------------------------------------------
+template <typename T>
+class NameIndex
+{
+public:
+
+    //! The type of the indexed list.
+    using List = QList<QSharedPointer<T> >;
+
+    //! The constructor.
+    NameIndex() = default;
+
+    //! The destructor.
+    ~NameIndex() = default;
+
+    // Disable copying.
+    NameIndex(NameIndex const& rhs) = delete;
+    NameIndex& operator=(NameIndex const& rhs) = delete;
+
+    /*!
+     *  Discard the index. Must be called after the items of the list have been removed, moved or renamed.
+     */
+    void invalidate() const
+    {
+        ++generation_;
+    }
+
+    /*!
+     *  Add an item inserted into the list to the index.
+     *
+     *    @param [in] position    The position of the inserted item.
+     *    @param [in] items       The indexed list containing the inserted item.
+     */
+    void insert(int position, List const& items) const
+    {
+        if (isCurrent(items, items.size() - 1) == false)
+        {
+            return;
+        }
+
+        // Items inserted before the end move the positions of the following items.
+        if (position != items.size() - 1)
+        {
+            invalidate();
+            return;
+        }
+
+        // Keep the first item of a duplicated name to match a linear search.
+        QString name = items.at(position)->name();
+        if (positions_.contains(name) == false)
+        {
+            positions_.insert(name, position);
+        }
+
+        indexedSize_ = items.size();
+    }
+
+    /*!
+     *  Add an item inserted into the list to the index.
+     *
+     *    @param [in] position    The position of the inserted item.
+     *    @param [in] items       The indexed list containing the inserted item.
+     */
+    void insert(int position, QSharedPointer<List> const& items) const
+    {
+        if (items.isNull() == false)
+        {
+            insert(position, *items);
+        }
+    }
+
+    /*!
+     *  Get the position of the item with the given name.
+     *
+     *    @param [in] itemName    Name of the item.
+     *    @param [in] items       The indexed list.
+     *
+     *    @return The position of the item, or -1 if the list does not contain the item.
+     */
+    int indexOf(std::string const& itemName, QSharedPointer<List> const& items) const
+    {
+        if (items.isNull())
+        {
+            return -1;
+        }
+
+        return indexOf(QString::fromStdString(itemName), *items);
+    }
+
+    /*!
+     *  Get the position of the item with the given name.
+     *
+     *    @param [in] itemName    Name of the item.
+     *    @param [in] items       The indexed list.
+     *
+     *    @return The position of the item, or -1 if the list does not contain the item.
+     */
+    int indexOf(std::string const& itemName, List const& items) const
+    {
+        return indexOf(QString::fromStdString(itemName), items);
+    }
+
+    /*!
+     *  Get the position of the item with the given name.
+     *
+     *    @param [in] itemName    Name of the item.
+     *    @param [in] items       The indexed list.
+     *
+     *    @return The position of the item, or -1 if the list does not contain the item.
+     */
+    int indexOf(QString const& itemName, List const& items) const
+    {
+        if (isCurrent(items, items.size()))
+        {
+            int position = positions_.value(itemName, -1);
+            if (position < 0 || isValidHit(position, itemName, items))
+            {
+                return position;
+            }
+        }
+
+        rebuild(items);
+
+        int position = positions_.value(itemName, -1);
+        if (isValidHit(position, itemName, items))
+        {
+            return position;
+        }
+
+        return -1;
+    }
+
+    /*!
+     *  Find the item with the given name.
+     *
+     *    @param [in] itemName    Name of the item.
+     *    @param [in] items       The indexed list.
+     *
+     *    @return The item with the given name, or null if the list does not contain the item.
+     */
+    QSharedPointer<T> find(std::string const& itemName, QSharedPointer<List> const& items) const
+    {
+        if (items.isNull())
+        {
+            return QSharedPointer<T>();
+        }
+
+        return find(itemName, *items);
+    }
+
+    /*!
+     *  Find the item with the given name.
+     *
+     *    @param [in] itemName    Name of the item.
+     *    @param [in] items       The indexed list.
+     *
+     *    @return The item with the given name, or null if the list does not contain the item.
+     */
+    QSharedPointer<T> find(std::string const& itemName, List const& items) const
+    {
+        int position = indexOf(itemName, items);
+        if (position < 0)
+        {
+            return QSharedPointer<T>();
+        }
+
+        return items.at(position);
+    }
+
+private:
+
+    /*!
+     *  Check if the index was built from the given list in the current generation.
+     *
+     *    @param [in] items           The list to check.
+     *    @param [in] expectedSize    The number of items indexed from the list.
+     *
+     *    @return True, if the index is current for the list, otherwise false.
+     */
+    bool isCurrent(List const& items, int expectedSize) const
+    {
+        return indexedList_ == &items && indexedSize_ == expectedSize && indexedGeneration_ == generation_;
+    }
+
+    /*!
+     *  Check if the item in the given position has the given name.
+     *
+     *    @param [in] position    The position of the item.
+     *    @param [in] itemName    The expected name.
+     *    @param [in] items       The indexed list.
+     *
+     *    @return True, if the item matches the name, otherwise false.
+     */
+    static bool isValidHit(int position, QString const& itemName, List const& items)
+    {
+        return position >= 0 && position < items.size() && items.at(position)->name() == itemName;
+    }
+
+    /*!
+     *  Rebuild the index from the given list.
+     *
+     *    @param [in] items   The list to index.
+     */
+    void rebuild(List const& items) const
+    {
+        positions_.clear();
+        positions_.reserve(items.size());
+
+        // Insert in reverse so the first item of a duplicated name is kept, matching a linear search.
+        for (int i = items.size() - 1; i >= 0; --i)
+        {
+            positions_.insert(items.at(i)->name(), i);
+        }
+
+        indexedList_ = &items;
+        indexedSize_ = items.size();
+        indexedGeneration_ = generation_;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The list the index was built from.
+    mutable List const* indexedList_ = nullptr;
+
+    //! The number of items indexed from the list.
+    mutable int indexedSize_ = 0;
+
+    //! The generation the index was built in.
+    mutable unsigned int indexedGeneration_ = 0;
+
+    //! The current generation, advanced by every invalidation.
+    mutable unsigned int generation_ = 0;
+
+    //! The positions of the items keyed by their names.
+    mutable QHash<QString, int> positions_;
+};
+
+#endif // NAME_INDEX_H
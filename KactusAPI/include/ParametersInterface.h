@@ -13,6 +13,7 @@
 #define PARAMETERSINTERFACE_H
 
 #include <KactusAPI/KactusAPIGlobal.h>
+#include <KactusAPI/include/NameIndex.h>
 
 #include <AbstractParameterInterface.h>
 
@@ -128,6 +129,9 @@ private:
 
     //! List of available parameters.
     QSharedPointer<QList<QSharedPointer<Parameter> > > parameters_ = nullptr;
+
+    //! Name index of the available parameters.
+    NameIndex<Parameter> parameterIndex_;
 };
 
 #endif // PARAMETERSINTERFACE_H
@@ -13,6 +13,7 @@
 #define PORTSINTERFACE_H
 
 #include <KactusAPI/KactusAPIGlobal.h>
+#include <KactusAPI/include/NameIndex.h>
 
 #include <ParameterizableInterface.h>
 #include <MasterPortInterface.h>
@@ -863,6 +864,9 @@ private:
     //! Pointer to the available ports.
     Port::List ports_ = nullptr;
 
+    //! Name index of the available ports.
+    NameIndex<Port> portIndex_;
+
     //! The validator used for ports.
     QSharedPointer<PortValidator> portValidator_;
 };
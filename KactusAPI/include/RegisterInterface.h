@@ -13,6 +13,7 @@
 #define REGISTERINTERFACE_H
 
 #include <KactusAPI/KactusAPIGlobal.h>
+#include <KactusAPI/include/NameIndex.h>
 
 #include <ParameterizableInterface.h>
 #include <NameGroupInterface.h>
@@ -520,6 +521,9 @@ private:
     //! List of contained registers.
     QList<QSharedPointer<Register> > registers_;
 
+    //! Name index of the contained registers.
+    NameIndex<Register> registerIndex_;
+
     //! Validator for registers.
     QSharedPointer<RegisterValidator> validator_;
 
@@ -0,0 +1,242 @@
+//-----------------------------------------------------------------------------
+// File: RegisterMapImporter.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Imports memory maps, address blocks, registers and fields from tabular data.
+//-----------------------------------------------------------------------------
+
+#ifndef REGISTERMAPIMPORTER_H
+#define REGISTERMAPIMPORTER_H
+
+#include <KactusAPI/KactusAPIGlobal.h>
+
+#include <QHash>
+#include <QSet>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class QIODevice;
+class QJsonObject;
+
+class AddressBlock;
+class Component;
+class MemoryMap;
+class Register;
+
+//-----------------------------------------------------------------------------
+//! Imports memory maps, address blocks, registers and fields from tabular data.
+//!
+//! Each input row describes one field and the register, address block and memory map containing it. The
+//! containing items are created when they are first referenced, and existing items of the component are
+//! reused. CSV and JSON lines are read one row at a time, so the whole input is never held in memory. Rows with
+//! errors, including unknown access values, are skipped and reported with their line numbers.
+//!
+//! The recognized columns are memoryMap, addressBlock, blockBaseAddress, blockRange, blockWidth, register,
+//! registerOffset, registerSize, registerDescription, field, bitOffset, bitWidth, access, resetValue,
+//! resetMask and description. The column names are not case sensitive. A row without a field name only
+//! creates the register.
+//-----------------------------------------------------------------------------
+class KACTUS2_API RegisterMapImporter
+{
+public:
+
+    //! The supported input formats.
+    enum class Format
+    {
+        CSV,        //!< Comma-separated values with a header row.
+        JsonLines,  //!< One JSON object per line.
+        Json        //!< A JSON array of objects.
+    };
+
+    //! An error found in an input row.
+    struct RowError
+    {
+        //! The line of the row in the input, or the position of the object in a JSON array, starting from one.
+        int line = 0;
+
+        //! Description of the error.
+        QString message;
+    };
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] component   The component receiving the imported items.
+     */
+    explicit RegisterMapImporter(QSharedPointer<Component> component);
+
+    //! The destructor.
+    ~RegisterMapImporter() = default;
+
+    // Disable copying.
+    RegisterMapImporter(RegisterMapImporter const& rhs) = delete;
+    RegisterMapImporter& operator=(RegisterMapImporter const& rhs) = delete;
+
+    /*!
+     *  Import the rows of a file. Files ending in .jsonl or .ndjson are read as JSON lines, files ending in .json
+     *  as a JSON array and all the other files as CSV.
+     *
+     *    @param [in] filePath    Path to the imported file.
+     *
+     *    @return The number of imported rows.
+     */
+    int importFile(QString const& filePath);
+
+    /*!
+     *  Import the rows of the given input.
+     *
+     *    @param [in] input   The input device to read.
+     *    @param [in] format  The format of the input.
+     *
+     *    @return The number of imported rows.
+     */
+    int importData(QIODevice& input, Format format);
+
+    /*!
+     *  Get the errors found in the rows of the previous imports.
+     *
+     *    @return The row errors.
+     */
+    QVector<RowError> getErrors() const;
+
+private:
+
+    //! The values of an input row keyed by the lower case column names.
+    using Row = QHash<QString, QString>;
+
+    /*!
+     *  Import CSV rows.
+     *
+     *    @param [in] input   The input device to read.
+     *
+     *    @return The number of imported rows.
+     */
+    int importCsv(QIODevice& input);
+
+    /*!
+     *  Import JSON lines.
+     *
+     *    @param [in] input   The input device to read.
+     *
+     *    @return The number of imported rows.
+     */
+    int importJsonLines(QIODevice& input);
+
+    /*!
+     *  Import the objects of a JSON array. A single JSON object is imported as one row.
+     *
+     *    @param [in] input   The input device to read.
+     *
+     *    @return The number of imported rows.
+     */
+    int importJson(QIODevice& input);
+
+    /*!
+     *  Get the values of an input row from a JSON object.
+     *
+     *    @param [in] object  The JSON object.
+     *
+     *    @return The values of the row.
+     */
+    static Row rowFromJson(QJsonObject const& object);
+
+    /*!
+     *  Split a CSV record into its values.
+     *
+     *    @param [in] record      The record to split.
+     *    @param [out] values     The values of the record.
+     *
+     *    @return True, if the record is complete, false if it ends inside a quoted value.
+     */
+    static bool splitCsvRecord(QString const& record, QStringList& values);
+
+    /*!
+     *  Create the items described by an input row.
+     *
+     *    @param [in] row     The values of the row.
+     *    @param [in] line    The line of the row in the input.
+     *
+     *    @return True, if the row was imported, false otherwise.
+     */
+    bool importRow(Row const& row, int line);
+
+    /*!
+     *  Find or create the memory map with the given name.
+     *
+     *    @param [in] mapName     Name of the memory map.
+     *
+     *    @return The memory map.
+     */
+    QSharedPointer<MemoryMap> findOrCreateMap(QString const& mapName);
+
+    /*!
+     *  Find or create an address block.
+     *
+     *    @param [in] containingMap   The memory map containing the address block.
+     *    @param [in] key             The key of the address block.
+     *    @param [in] row             The values of the row referencing the address block.
+     *
+     *    @return The address block.
+     */
+    QSharedPointer<AddressBlock> findOrCreateBlock(QSharedPointer<MemoryMap> containingMap, QString const& key,
+        Row const& row);
+
+    /*!
+     *  Find or create a register.
+     *
+     *    @param [in] containingBlock     The address block containing the register.
+     *    @param [in] key                 The key of the register.
+     *    @param [in] row                 The values of the row referencing the register.
+     *    @param [in] line                The line of the row in the input.
+     *
+     *    @return The register, or null if the register could not be created.
+     */
+    QSharedPointer<Register> findOrCreateRegister(QSharedPointer<AddressBlock> containingBlock,
+        QString const& key, Row const& row, int line);
+
+    /*!
+     *  Index the existing memory maps, address blocks, registers and fields of the component.
+     */
+    void indexComponent();
+
+    /*!
+     *  Add an error for an input row.
+     *
+     *    @param [in] line        The line of the row.
+     *    @param [in] message     Description of the error.
+     */
+    void addError(int line, QString const& message);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The component receiving the imported items.
+    QSharedPointer<Component> component_;
+
+    //! The memory maps of the component keyed by their names.
+    QHash<QString, QSharedPointer<MemoryMap> > maps_;
+
+    //! The address blocks of the component keyed by the memory map and address block names.
+    QHash<QString, QSharedPointer<AddressBlock> > blocks_;
+
+    //! The registers of the component keyed by the memory map, address block and register names.
+    QHash<QString, QSharedPointer<Register> > registers_;
+
+    //! The fields of the component keyed by the memory map, address block, register and field names.
+    QSet<QString> fields_;
+
+    //! Flag for an up-to-date index of the component items.
+    bool indexed_ = false;
+
+    //! The errors found in the imported rows.
+    QVector<RowError> errors_;
+};
+
+#endif // REGISTERMAPIMPORTER_H
@@ -73,6 +73,26 @@ public:
      */
     int baseForExpression(QStringView expression) const override;
 
+    /*!
+     *  Evaluates the value, the common base and the referenced symbols of an expression from a single
+     *  conversion to reverse polish notation.
+     *
+     *    @param [in] expression   The expression to evaluate.
+     *
+     *    @return The evaluation results.
+     */
+    Evaluation evaluate(QStringView expression) const override;
+
+    /*!
+     *  Finds the symbols e.g. references in an expression using the token rules of the parser.
+     *  Literals, operators, parentheses, brackets and separators are not symbols.
+     *
+     *    @param [in] expression   The expression to search in.
+     *
+     *    @return The symbols in the order they appear in the expression.
+     */
+    static QVector<QStringView> findSymbols(QString const& expression);
+
 protected:
      
     /*!
@@ -24,6 +24,7 @@
 #include <IPXACTmodels/kactusExtensions/KactusAttribute.h>
 
 #include <KactusAPI/KactusAPIGlobal.h>
+#include <KactusAPI/include/DocumentSummary.h>
 
 #include <QObject>
 #include <QSharedPointer>
@@ -88,6 +89,39 @@ public:
 	 */
 	void createChild(const VLNV& vlnv);
 
+	/*! Create a child for the given VLNV at the given position.
+	 *
+	 *    @param [in] row         The position of the new child.
+	 *    @param [in] vlnv        Identifies the document to represent.
+	 *    @param [in] viewName    The name of the view the design belongs to.
+	 */
+	void insertChild(int row, VLNV const& vlnv, QString const& viewName = QString());
+
+	/*! Take a child item from this item. The ownership of the child is transferred to the caller.
+	 *
+	 *    @param [in] row     The position of the child.
+	 *
+	 *    @return The child item that was taken.
+	 */
+	HierarchyItem* takeChild(int row);
+
+	/*! Checks if this HierarchyItem already has child for given vlnv.
+	 *
+	 *    @param [in] vlnv Identifies the child.
+	 *
+	 *    @return bool True if child with given vlnv is found.
+	*/
+	bool hasChild(const VLNV& vlnv);
+
+	/*! Find the topmost items that represent or reference the given vlnv in their document.
+	 *
+	 * The subtrees of the found items change when the referenced document is added or changed.
+	 *
+	 *    @param [in] vlnv        Identifies the referenced document.
+	 *    @param [out] items      The found items.
+	 */
+	void findAffectedItems(VLNV const& vlnv, QVector<HierarchyItem*>& items);
+
 
 	/*! Get the parent of this item.
 	 *
@@ -166,11 +200,11 @@ public:
 	*/
 	void cleanUp();
 	
-	/*! Get pointer to the component that this item represents
+	/*! Get the summary of the document that this item represents.
 	 *
-	 *    @return QSharedPointer<Component> The component model.
+	 *    @return The document summary.
 	*/
-	QSharedPointer<Component const> component() const;
+	QSharedPointer<DocumentSummary const> summary() const;
 
 	/*! Count how many instances of given vlnv is found under this item.
 	 *
@@ -344,13 +378,13 @@ private:
 	//! No assignment
 	HierarchyItem& operator=(const HierarchyItem& other);
 
-	/*! Checks if this HierarchyItem already has child for given vlnv.
+	/*! Checks if the document of this item references the given vlnv.
 	 *
-	 *    @param [in] vlnv Identifies the child.
+	 *    @param [in] vlnv Identifies the referenced document.
 	 *
-	 *    @return bool True if child with given vlnv is found.
+	 *    @return True, if the document references the vlnv, otherwise false.
 	*/
-	bool hasChild(const VLNV& vlnv);
+	bool referencesDocument(VLNV const& vlnv) const;
 
 	/*! Parse this hierarchy item to match a component
 	 *
@@ -368,7 +402,7 @@ private:
      *
      *    @return The design referenced in the view.
      */
-    VLNV findDesignReference(QSharedPointer<View> view);
+    VLNV findDesignReference(DocumentSummary::HierarchicalView const& view);
 
     /*!
      *  Creates a child item for the given design.
@@ -417,9 +451,11 @@ private:
     /*!
      *  Finds the valid component references in a design item.
      *
+     *    @param [in] instantiatedComponents  The components instantiated in the design.
+     *
      *    @return The valid VLVN references.
      */
-    QVector<VLNV> getValidComponentsInDesign(QSharedPointer<Design const> design);
+    QVector<VLNV> getValidComponentsInDesign(QVector<VLNV> const& instantiatedComponents);
 
     /*!
      *  Checks if the given VLNV reference to a component is valid.
@@ -437,8 +473,8 @@ private:
     //! The VLNV this item represents.
     VLNV vlnv_;
 
-	//! The component that this hierarhcyItem represents.
-	QSharedPointer<Component const> component_;
+	//! The summary of the document that this hierarchyItem represents.
+	QSharedPointer<DocumentSummary const> summary_;
 
 	//! The object that manages the library.
 	LibraryInterface* library_;
@@ -202,8 +202,24 @@ public slots:
     //! Shows errors about the item at the given index.
     void onShowErrors(QModelIndex const& index);
 
+    /*! Add the items for a document added to the library.
+     *
+     * The items of the documents referencing the added document are created again to include it.
+     *
+     *    @param [in] vlnv Identifies the added document.
+    */
+    void onAddVLNV(VLNV const& vlnv);
+
     //! Remove the specified vlnv from the tree.
     void onRemoveVLNV(VLNV const& vlnv);
+
+    /*! Update the items of a document whose content has changed in the library.
+     *
+     * The items of the document and of the documents referencing it are created again.
+     *
+     *    @param [in] vlnv Identifies the changed document.
+    */
+    void onDocumentChanged(VLNV const& vlnv);
     
     /*! This function should be called when an IP-XACT document has changed.
      * 
@@ -267,6 +283,28 @@ private:
     //! No assignment
     HierarchyModel& operator=(const HierarchyModel& other);
 
+    /*! Create an item and its subtree again from the current library content.
+     *
+     *    @param [in] item    The item to create again. The item is deleted.
+     *
+     *    @return The new item.
+    */
+    HierarchyItem* recreateItem(HierarchyItem* item);
+
+    /*! Add an abstraction definition under the items of its bus definition.
+     *
+     *    @param [in] absDefVLNV  Identifies the abstraction definition.
+    */
+    void insertAbstractionDefinition(VLNV const& absDefVLNV);
+
+    /*! Update the duplicate status of the top level items with the given vlnvs.
+     *
+     * A top level item is a duplicate when another top level item contains it.
+     *
+     *    @param [in] vlnvs   Identifies the items to update.
+    */
+    void updateDuplicates(QList<VLNV> const& vlnvs);
+
     //! The root item of the model
     HierarchyItem* rootItem_;
 
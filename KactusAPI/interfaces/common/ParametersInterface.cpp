@@ -37,6 +37,7 @@ AbstractParameterInterface(validator, expressionParser, expressionFormatter)
 void ParametersInterface::setParameters(QSharedPointer<QList<QSharedPointer<Parameter> > > newParameters)
 {
     parameters_ = newParameters;
+    parameterIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -44,7 +45,7 @@ void ParametersInterface::setParameters(QSharedPointer<QList<QSharedPointer<Para
 //-----------------------------------------------------------------------------
 int ParametersInterface::getItemIndex(std::string const& itemName) const
 {
-    return ListHelper::itemIndex(itemName, parameters_);
+    return parameterIndex_.indexOf(itemName, parameters_);
 }
 
 //-----------------------------------------------------------------------------
@@ -97,6 +98,7 @@ void ParametersInterface::addParameter(int const& row, std::string const& newPar
     newParameter->setName(parameterName);
 
     parameters_->insert(row, newParameter);
+    parameterIndex_.insert(row, parameters_);
 }
 
 //-----------------------------------------------------------------------------
@@ -110,6 +112,7 @@ bool ParametersInterface::removeParameter(std::string const& parameterName)
         return false;
     }
 
+    parameterIndex_.invalidate();
     return parameters_->removeOne(removedParameter);
 }
 
@@ -126,16 +129,5 @@ QSharedPointer<NameGroup> ParametersInterface::getItem(std::string const& parame
 //-----------------------------------------------------------------------------
 QSharedPointer<Parameter> ParametersInterface::getParameter(std::string const& parameterName) const
 {
-    if (parameters_)
-    {
-        for (auto parameter : *parameters_)
-        {
-            if (parameter->name().toStdString() == parameterName)
-            {
-                return parameter;
-            }
-        }
-    }
-
-    return QSharedPointer<Parameter>();
+    return parameterIndex_.find(parameterName, parameters_);
 }
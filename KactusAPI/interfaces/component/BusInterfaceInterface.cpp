@@ -98,6 +98,7 @@ void BusInterfaceInterface::setParameterInterface(ParametersInterface* newParame
 void BusInterfaceInterface::setBusInterfaces(QSharedPointer<Component> newComponent)
 {
     busInterfaces_ = newComponent->getBusInterfaces();
+    busIndex_.invalidate();
     docRevision_ = newComponent->getRevision();
 
     if (fileSetInterface_ != NULL)
@@ -174,16 +175,7 @@ QString BusInterfaceInterface::getActiveSystemGroup(std::string const& busName)
 //-----------------------------------------------------------------------------
 QSharedPointer<BusInterface> BusInterfaceInterface::getBusInterface(std::string const& busName) const
 {
-    QString busNameQ = QString::fromStdString(busName);
-    for (auto bus : *busInterfaces_)
-    {
-        if (bus->name() == busNameQ)
-        {
-            return bus;
-        }
-    }
-
-    return QSharedPointer<BusInterface>();
+    return busIndex_.find(busName, busInterfaces_);
 }
 
 //-----------------------------------------------------------------------------
@@ -358,16 +350,7 @@ QSharedPointer<BusInterface::MonitorInterface> BusInterfaceInterface::createMoni
 //-----------------------------------------------------------------------------
 int BusInterfaceInterface::getItemIndex(std::string const& itemName) const
 {
-    QString itemNameQ = QString::fromStdString(itemName);
-    for (int i = 0; i < busInterfaces_->size(); ++i)
-    {
-        if (busInterfaces_->at(i)->name() == itemNameQ)
-        {
-            return i;
-        }
-    }
-
-    return -1;
+    return busIndex_.indexOf(itemName, busInterfaces_);
 }
 
 //-----------------------------------------------------------------------------
@@ -426,6 +409,7 @@ bool BusInterfaceInterface::setName(std::string const& currentName, std::string
         QString uniqueNewName = getUniqueName(newName, DEFAULT_NAME.toStdString());
 
         editedBus->setName(uniqueNewName);
+        busIndex_.invalidate();
         return true;
     }
     else
@@ -739,6 +723,7 @@ void BusInterfaceInterface::addBusInterface(int const& newBusIndex, std::string
     newBus->setName(getUniqueName(busName, DEFAULT_NAME.toStdString()));
 
     busInterfaces_->insert(newBusIndex, newBus);
+    busIndex_.insert(newBusIndex, busInterfaces_);
 }
 
 //-----------------------------------------------------------------------------
@@ -760,6 +745,7 @@ bool BusInterfaceInterface::removeBusInterface(std::string const& busName)
         return false;
     }
 
+    busIndex_.invalidate();
     return busInterfaces_->removeOne(removedItem);
 }
 
@@ -768,15 +754,7 @@ bool BusInterfaceInterface::removeBusInterface(std::string const& busName)
 //-----------------------------------------------------------------------------
 bool BusInterfaceInterface::busInterfaceExists(std::string const& busName) const
 {
-    for (auto const& name : getItemNames())
-    {
-        if (name == busName)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return getItemIndex(busName) != -1;
 }
 
 //-----------------------------------------------------------------------------
@@ -797,6 +775,8 @@ void BusInterfaceInterface::swapBusInterfaces(int const& firstIndex, int const&
     {
         busInterfaces_->swapItemsAt(firstIndex, secondIndex);
     }
+
+    busIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -1588,6 +1568,7 @@ std::vector<std::string> BusInterfaceInterface::pasteRows()
                 QSharedPointer<BusInterface> newBus(new BusInterface(*copiedBus.data()));
                 newBus->setName(getUniqueName(newBus->name().toStdString(), DEFAULT_NAME.toStdString()));
                 busInterfaces_->append(newBus);
+                busIndex_.insert(busInterfaces_->size() - 1, busInterfaces_);
 
                 pastedBusNames.push_back(newBus->name().toStdString());
             }
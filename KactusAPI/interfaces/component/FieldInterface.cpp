@@ -53,6 +53,7 @@ subInterface_(subInterface)
 void FieldInterface::setFields(QSharedPointer<QList<QSharedPointer<Field> > > newFields)
 {
     fields_ = newFields;
+    fieldIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -60,18 +61,7 @@ void FieldInterface::setFields(QSharedPointer<QList<QSharedPointer<Field> > > ne
 //-----------------------------------------------------------------------------
 int FieldInterface::getItemIndex(std::string const& itemName) const
 {
-    if (fields_)
-    {
-        for (int i = 0; i < fields_->size(); ++i)
-        {
-            if (fields_->at(i)->name().toStdString() == itemName)
-            {
-                return i;
-            }
-        }
-    }
-
-    return -1;
+    return fieldIndex_.indexOf(itemName, fields_);
 }
 
 //-----------------------------------------------------------------------------
@@ -129,6 +119,7 @@ bool FieldInterface::setName(std::string const& currentName, std::string const&
         QString uniqueNewName = getUniqueName(newName, FIELD_TYPE);
 
         editedField->setName(uniqueNewName);
+        fieldIndex_.invalidate();
         return true;
     }
     else
@@ -1243,18 +1234,7 @@ bool FieldInterface::hasValidWriteValueConstraint(std::string const& fieldName,
 //-----------------------------------------------------------------------------
 QSharedPointer<Field> FieldInterface::getField(std::string const& fieldName) const
 {
-    if (fields_)
-    {
-        for (auto field : *fields_)
-        {
-            if (field->name().toStdString() == fieldName)
-            {
-                return field;
-            }
-        }
-    }
-
-    return QSharedPointer<Field>();
+    return fieldIndex_.find(fieldName, fields_);
 }
 
 //-----------------------------------------------------------------------------
@@ -1268,6 +1248,7 @@ void FieldInterface::addField(int const& row, std::string const& newFieldName /*
     newField->setName(fieldName);
 
     fields_->insert(row, newField);
+    fieldIndex_.insert(row, fields_);
 }
 
 //-----------------------------------------------------------------------------
@@ -1289,6 +1270,7 @@ bool FieldInterface::removeField(std::string const& fieldName)
         return false;
     }
 
+    fieldIndex_.invalidate();
     return fields_->removeOne(removedField);
 }
 
@@ -1335,6 +1317,7 @@ std::vector<std::string> FieldInterface::pasteRows()
                 QSharedPointer<Field> newField(new Field(*field));
                 newField->setName(getUniqueName(newField->name().toStdString(), FIELD_TYPE));
                 fields_->append(newField);
+                fieldIndex_.insert(fields_->size() - 1, fields_);
 
                 pastedFieldNames.push_back(newField->name().toStdString());
             }
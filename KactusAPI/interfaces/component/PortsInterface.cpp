@@ -17,8 +17,6 @@
 #include <IPXACTmodels/Component/Port.h>
 #include <IPXACTmodels/Component/validators/PortValidator.h>
 
-#include <IPXACTmodels/utilities/Search.h>
-
 #include <KactusAPI/include/ListHelper.h>
 
 //-----------------------------------------------------------------------------
@@ -39,6 +37,7 @@ portValidator_(validator)
 void PortsInterface::setPorts(Port::List ports)
 {
     ports_ = ports;
+    portIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -54,7 +53,7 @@ bool PortsInterface::hasPorts() const
 //-----------------------------------------------------------------------------
 int PortsInterface::getItemIndex(std::string const& itemName) const
 {
-    return ListHelper::itemIndex(itemName, ports_);
+    return portIndex_.indexOf(itemName, ports_);
 }
 
 //-----------------------------------------------------------------------------
@@ -91,7 +90,7 @@ std::vector<std::string> PortsInterface::getItemNames() const
 //-----------------------------------------------------------------------------
 QSharedPointer<Port> PortsInterface::getPort(std::string const& portName) const
 {
-    return Search::findByName(QString::fromStdString(portName), ports_);
+    return portIndex_.find(portName, ports_);
 }
 
 //-----------------------------------------------------------------------------
@@ -113,6 +112,7 @@ bool PortsInterface::setName(std::string const& currentPortName, std::string con
         QString uniqueNewName(getUniqueName(newPortName, "port"));
 
         editedPort->setName(uniqueNewName);
+        portIndex_.invalidate();
         return true;
     }
     else
@@ -1269,6 +1269,7 @@ void PortsInterface::addWirePort(std::string const& newPortName)
     newPort->setWire(QSharedPointer<Wire>(new Wire()));
 
     ports_->append(newPort);
+    portIndex_.insert(ports_->size() - 1, ports_);
 }
 
 //-----------------------------------------------------------------------------
@@ -1282,6 +1283,7 @@ void PortsInterface::addTransactionalPort(std::string const& newPortName)
     newPort->setTransactional(QSharedPointer<Transactional>(new Transactional()));
 
     ports_->append(newPort);
+    portIndex_.insert(ports_->size() - 1, ports_);
 }
 
 //-----------------------------------------------------------------------------
@@ -1295,6 +1297,7 @@ bool PortsInterface::removePort(std::string const& portName) const
         return false;
     }
 
+    portIndex_.invalidate();
     return ports_->removeOne(removedPort);
 }
 
@@ -1303,7 +1306,7 @@ bool PortsInterface::removePort(std::string const& portName) const
 //-----------------------------------------------------------------------------
 bool PortsInterface::portExists(std::string const& portName) const
 {
-    return Search::findByName(QString::fromStdString(portName), ports_) != nullptr;
+    return getPort(portName) != nullptr;
 }
 
 //-----------------------------------------------------------------------------
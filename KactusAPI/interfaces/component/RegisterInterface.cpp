@@ -67,6 +67,8 @@ void RegisterInterface::setRegisters(QSharedPointer<QList<QSharedPointer<Registe
             registers_.append(registerItem);
         }
     }
+
+    registerIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -74,15 +76,7 @@ void RegisterInterface::setRegisters(QSharedPointer<QList<QSharedPointer<Registe
 //-----------------------------------------------------------------------------
 int RegisterInterface::getItemIndex(string const& itemName) const
 {
-    for (int i = 0; i < registers_.size(); ++i)
-    {
-        if (registers_.at(i)->name().toStdString() == itemName)
-        {
-            return i;
-        }
-    }
-
-    return -1;
+    return registerIndex_.indexOf(itemName, registers_);
 }
 
 //-----------------------------------------------------------------------------
@@ -154,6 +148,7 @@ bool RegisterInterface::setName(string const& currentName, string const& newName
         QString uniqueNewName = getUniqueName(newName, REGISTER_TYPE);
 
         editedRegister->setName(uniqueNewName);
+        registerIndex_.invalidate();
         return true;
     }
     else
@@ -646,15 +641,7 @@ bool RegisterInterface::hasValidSize(std::string const& registerName) const
 //-----------------------------------------------------------------------------
 QSharedPointer<Register> RegisterInterface::getRegister(std::string const& registerName) const
 {
-    for (auto currentRegister : registers_)
-    {
-        if (currentRegister->name().toStdString() == registerName)
-        {
-            return currentRegister;
-        }
-    }
-
-    return QSharedPointer<Register>();
+    return registerIndex_.find(registerName, registers_);
 }
 
 //-----------------------------------------------------------------------------
@@ -677,6 +664,7 @@ void RegisterInterface::addRegister(int const& row, int const& dataIndex, std::s
     regItem->setName(registerName);
     registers_.insert(row, regItem);
     registerData_->insert(dataIndex, regItem);
+    registerIndex_.insert(row, registers_);
 }
 
 //-----------------------------------------------------------------------------
@@ -699,6 +687,7 @@ bool RegisterInterface::removeRegister(std::string const& registerName, int cons
     }
 
     registerData_->removeAt(dataIndex);
+    registerIndex_.invalidate();
     return registers_.removeOne(removedRegister);
 }
 
@@ -746,6 +735,7 @@ std::vector<std::string> RegisterInterface::pasteRows()
                 newRegister->setName(getUniqueName(newRegister->name().toStdString(), REGISTER_TYPE));
                 registers_.append(newRegister);
                 registerData_->append(newRegister);
+                registerIndex_.insert(registers_.size() - 1, registers_);
 
                 pastedRegisterNames.push_back(newRegister->name().toStdString());
             }
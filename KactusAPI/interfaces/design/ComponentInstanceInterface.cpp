@@ -16,8 +16,6 @@
 #include <IPXACTmodels/Design/Design.h>
 #include <IPXACTmodels/Design/ComponentInstance.h>
 
-#include <IPXACTmodels/utilities/Search.h>
-
 #include <InterconnectionInterface.h>
 #include <AdHocConnectionInterface.h>
 
@@ -44,6 +42,7 @@ adHocConnectionInterface_(adHocInterface)
 void ComponentInstanceInterface::setComponentInstances(QSharedPointer<Design> newDesign)
 {
     componentInstances_ = newDesign->getComponentInstances();
+    instanceIndex_.invalidate();
 
     connectionInterface_->setInterconnections(newDesign);
     adHocConnectionInterface_->setConnections(newDesign);
@@ -55,7 +54,7 @@ void ComponentInstanceInterface::setComponentInstances(QSharedPointer<Design> ne
 QSharedPointer<ComponentInstance> ComponentInstanceInterface::getComponentInstance(std::string const& instanceName)
 const
 {
-    return Search::findByName(QString::fromStdString(instanceName), componentInstances_);
+    return instanceIndex_.find(instanceName, componentInstances_);
 }
 
 //-----------------------------------------------------------------------------
@@ -71,16 +70,7 @@ QSharedPointer<NameGroup> ComponentInstanceInterface::getItem(std::string const&
 //-----------------------------------------------------------------------------
 int ComponentInstanceInterface::getItemIndex(std::string const& itemName) const
 {
-    QString itemNameQ = QString::fromStdString(itemName);
-    for (int i = 0; i < componentInstances_->size(); ++i)
-    {
-        if (componentInstances_->at(i)->getInstanceName() == itemNameQ)
-        {
-            return i;
-        }
-    }
-
-    return -1;
+    return instanceIndex_.indexOf(itemName, componentInstances_);
 }
 
 //-----------------------------------------------------------------------------
@@ -130,6 +120,7 @@ bool ComponentInstanceInterface::setName(std::string const& currentName, std::st
         QString uniqueNewName = getUniqueName(newName, DEFAULT_NAME.toStdString());
 
         editedInstance->setInstanceName(uniqueNewName);
+        instanceIndex_.invalidate();
 
         connectionInterface_->renameComponentReferences(currentName, newName);
         adHocConnectionInterface_->renameComponentReferences(currentName, newName);
@@ -234,6 +225,7 @@ void ComponentInstanceInterface::addComponentInstance(std::string const& instanc
     newInstance->setInstanceName(getUniqueName(instanceName, DEFAULT_NAME.toStdString()));
 
     componentInstances_->append(newInstance);
+    instanceIndex_.insert(componentInstances_->size() - 1, componentInstances_);
 }
 
 //-----------------------------------------------------------------------------
@@ -250,6 +242,7 @@ bool ComponentInstanceInterface::removeComponentInstance(std::string const& inst
     connectionInterface_->removeInstanceInterconnections(instanceName);
     adHocConnectionInterface_->removeInstanceAdHocConnections(instanceName);
 
+    instanceIndex_.invalidate();
     return componentInstances_->removeOne(removedItem);
 }
 
@@ -0,0 +1,541 @@
+//-----------------------------------------------------------------------------
+// File: DocumentCache.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Binary cache of the parsed XML content of IP-XACT documents.
+//-----------------------------------------------------------------------------
+
+#include "DocumentCache.h"
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QDomDocument>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QVector>
+
+#include <atomic>
+
+namespace
+{
+    //! Identifies the cache files.
+    const quint32 CACHE_MAGIC = 0x4B32444D;
+
+    //! Version of the cache file format. Files of other versions are ignored.
+    const quint32 CACHE_VERSION = 2;
+
+    //! Flag for an enabled cache.
+    std::atomic<bool> cacheEnabled(true);
+
+    //! The types of the stored XML nodes.
+    enum NodeKind : quint8
+    {
+        ELEMENT = 1,
+        TEXT,
+        CDATA,
+        COMMENT,
+        PROCESSING_INSTRUCTION
+    };
+
+    //! The key of a source file stored in the cache file.
+    struct SourceKey
+    {
+        QString path;
+        qint64 modified = 0;
+        qint64 size = 0;
+    };
+
+    /*!
+     *  Get the key of a source file.
+     */
+    SourceKey sourceKey(QFileInfo const& sourceInfo)
+    {
+        SourceKey key;
+        key.path = sourceInfo.absoluteFilePath();
+        key.modified = sourceInfo.lastModified().toMSecsSinceEpoch();
+        key.size = sourceInfo.size();
+
+        return key;
+    }
+
+    /*!
+     *  Read the header of a cache file.
+     *
+     *    @return True, if the header is of the current version and was read successfully, otherwise false.
+     */
+    bool readHeader(QDataStream& stream, SourceKey& key)
+    {
+        quint32 magic = 0;
+        quint32 version = 0;
+        stream >> magic >> version;
+        if (magic != CACHE_MAGIC || version != CACHE_VERSION)
+        {
+            return false;
+        }
+
+        stream >> key.path >> key.modified >> key.size;
+        return stream.status() == QDataStream::Ok;
+    }
+
+    /*!
+     *  Check if two keys identify the same state of a source file.
+     */
+    bool isSameSource(SourceKey const& storedKey, SourceKey const& currentKey)
+    {
+        return storedKey.path == currentKey.path && storedKey.modified == currentKey.modified &&
+            storedKey.size == currentKey.size;
+    }
+
+    //! The sources parsed once without being cached, keyed by their paths.
+    QHash<QString, SourceKey> parsedSources;
+
+    //! Guards the parsed sources, since the documents may be read from several threads.
+    QMutex parsedSourcesMutex;
+
+    /*!
+     *  Get the directory containing the cache files.
+     */
+    QString cacheDirectory()
+    {
+        return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/DocumentCache");
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Writes the nodes of an XML tree using a shared table for the names and values.
+    //-----------------------------------------------------------------------------
+    class TreeWriter
+    {
+    public:
+
+        explicit TreeWriter(QDataStream& stream): stream_(stream) {}
+
+        /*!
+         *  Write the child nodes of a node.
+         *
+         *    @return True, if all the nodes could be stored, otherwise false.
+         */
+        bool writeChildren(QDomNode const& parent)
+        {
+            QDomNodeList children = parent.childNodes();
+
+            stream_ << quint32(children.size());
+            for (int i = 0; i < children.size(); ++i)
+            {
+                if (writeNode(children.at(i)) == false)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        //! The strings referenced by the written nodes.
+        QVector<QString> const& strings() const { return strings_; }
+
+    private:
+
+        bool writeNode(QDomNode const& node)
+        {
+            if (node.isElement())
+            {
+                QDomElement element = node.toElement();
+                stream_ << quint8(ELEMENT) << index(element.tagName());
+
+                QDomNamedNodeMap attributes = element.attributes();
+                stream_ << quint32(attributes.size());
+                for (int i = 0; i < attributes.size(); ++i)
+                {
+                    QDomAttr attribute = attributes.item(i).toAttr();
+                    stream_ << index(attribute.name()) << index(attribute.value());
+                }
+
+                return writeChildren(node);
+            }
+            else if (node.isCDATASection())
+            {
+                stream_ << quint8(CDATA) << index(node.nodeValue());
+            }
+            else if (node.isText())
+            {
+                stream_ << quint8(TEXT) << index(node.nodeValue());
+            }
+            else if (node.isComment())
+            {
+                stream_ << quint8(COMMENT) << index(node.nodeValue());
+            }
+            else if (node.isProcessingInstruction())
+            {
+                QDomProcessingInstruction instruction = node.toProcessingInstruction();
+                stream_ << quint8(PROCESSING_INSTRUCTION) << index(instruction.target()) <<
+                    index(instruction.data());
+            }
+            else
+            {
+                // Entity references and document types are not stored, the document is parsed instead.
+                return false;
+            }
+
+            return true;
+        }
+
+        quint32 index(QString const& text)
+        {
+            auto existing = indices_.constFind(text);
+            if (existing != indices_.cend())
+            {
+                return existing.value();
+            }
+
+            quint32 newIndex = quint32(strings_.size());
+            indices_.insert(text, newIndex);
+            strings_.append(text);
+            return newIndex;
+        }
+
+        QDataStream& stream_;
+
+        QHash<QString, quint32> indices_;
+
+        QVector<QString> strings_;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! Reads the nodes of an XML tree written by TreeWriter.
+    //-----------------------------------------------------------------------------
+    class TreeReader
+    {
+    public:
+
+        TreeReader(QDataStream& stream, QVector<QString> const& strings, QDomDocument& document):
+            stream_(stream), strings_(strings), document_(document) {}
+
+        /*!
+         *  Read the child nodes of a node.
+         *
+         *    @return True, if the nodes were read successfully, otherwise false.
+         */
+        bool readChildren(QDomNode& parent)
+        {
+            quint32 count = 0;
+            stream_ >> count;
+
+            for (quint32 i = 0; i < count && stream_.status() == QDataStream::Ok; ++i)
+            {
+                if (readNode(parent) == false)
+                {
+                    return false;
+                }
+            }
+
+            return stream_.status() == QDataStream::Ok;
+        }
+
+    private:
+
+        bool readNode(QDomNode& parent)
+        {
+            quint8 kind = 0;
+            stream_ >> kind;
+
+            if (kind == ELEMENT)
+            {
+                QDomElement element = document_.createElement(string());
+
+                quint32 attributeCount = 0;
+                stream_ >> attributeCount;
+                for (quint32 i = 0; i < attributeCount && stream_.status() == QDataStream::Ok; ++i)
+                {
+                    QString const& name = string();
+                    element.setAttribute(name, string());
+                }
+
+                parent.appendChild(element);
+                return readChildren(element) && valid_;
+            }
+            else if (kind == TEXT)
+            {
+                parent.appendChild(document_.createTextNode(string()));
+            }
+            else if (kind == CDATA)
+            {
+                parent.appendChild(document_.createCDATASection(string()));
+            }
+            else if (kind == COMMENT)
+            {
+                parent.appendChild(document_.createComment(string()));
+            }
+            else if (kind == PROCESSING_INSTRUCTION)
+            {
+                QString const& target = string();
+                parent.appendChild(document_.createProcessingInstruction(target, string()));
+            }
+            else
+            {
+                return false;
+            }
+
+            return valid_;
+        }
+
+        QString const& string()
+        {
+            quint32 index = 0;
+            stream_ >> index;
+
+            if (index >= quint32(strings_.size()))
+            {
+                valid_ = false;
+                return empty_;
+            }
+
+            return strings_.at(index);
+        }
+
+        QDataStream& stream_;
+
+        QVector<QString> const& strings_;
+
+        QDomDocument& document_;
+
+        bool valid_ = true;
+
+        QString const empty_;
+    };
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::setEnabled()
+//-----------------------------------------------------------------------------
+void DocumentCache::setEnabled(bool enabled)
+{
+    cacheEnabled = enabled;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::isEnabled()
+//-----------------------------------------------------------------------------
+bool DocumentCache::isEnabled()
+{
+    return cacheEnabled;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::cachePath()
+//-----------------------------------------------------------------------------
+QString DocumentCache::cachePath(QString const& sourcePath)
+{
+    // The stored key identifies the source, so a plain hash is enough to name the file. The hash must stay
+    // the same between sessions, so the seeded hash of QHash is not used.
+    quint64 pathHash = 14695981039346656037ULL;
+    for (QChar character : QFileInfo(sourcePath).absoluteFilePath())
+    {
+        pathHash = (pathHash ^ character.unicode()) * 1099511628211ULL;
+    }
+
+    return cacheDirectory() + QLatin1Char('/') + QString::number(pathHash, 16) + QStringLiteral(".bin");
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::read()
+//-----------------------------------------------------------------------------
+bool DocumentCache::read(QString const& sourcePath, QDomDocument& document)
+{
+    QFileInfo sourceInfo(sourcePath);
+    if (isEnabled() == false || sourceInfo.size() < MINIMUM_FILE_SIZE)
+    {
+        return false;
+    }
+
+    QFile cacheFile(cachePath(sourcePath));
+    if (cacheFile.open(QIODevice::ReadOnly) == false)
+    {
+        return false;
+    }
+
+    // Reading the whole file at once is faster than reading the small items of the stream from the file.
+    QByteArray content = cacheFile.readAll();
+    cacheFile.close();
+
+    QDataStream stream(content);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    SourceKey storedKey;
+    if (readHeader(stream, storedKey) == false || isSameSource(storedKey, sourceKey(sourceInfo)) == false)
+    {
+        return false;
+    }
+
+    quint32 stringCount = 0;
+    stream >> stringCount;
+    if (stream.status() != QDataStream::Ok || stringCount > quint32(content.size()))
+    {
+        return false;
+    }
+
+    QVector<QString> strings;
+    strings.reserve(stringCount);
+    for (quint32 i = 0; i < stringCount && stream.status() == QDataStream::Ok; ++i)
+    {
+        QString text;
+        stream >> text;
+        strings.append(text);
+    }
+
+    QDomDocument restored;
+    TreeReader reader(stream, strings, restored);
+    if (reader.readChildren(restored) == false || restored.documentElement().isNull())
+    {
+        return false;
+    }
+
+    document = restored;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::write()
+//-----------------------------------------------------------------------------
+bool DocumentCache::write(QString const& sourcePath, QDomDocument const& document)
+{
+    QFileInfo sourceInfo(sourcePath);
+    if (isEnabled() == false || sourceInfo.size() < MINIMUM_FILE_SIZE)
+    {
+        return false;
+    }
+
+    QByteArray tree;
+    QDataStream treeStream(&tree, QIODevice::WriteOnly);
+    treeStream.setVersion(QDataStream::Qt_6_0);
+
+    TreeWriter writer(treeStream);
+    if (writer.writeChildren(document) == false)
+    {
+        return false;
+    }
+
+    QString targetPath = cachePath(sourcePath);
+    if (QDir().mkpath(QFileInfo(targetPath).absolutePath()) == false)
+    {
+        return false;
+    }
+
+    // The cache file is replaced atomically, so a concurrent reader never sees a partial file.
+    QSaveFile cacheFile(targetPath);
+    if (cacheFile.open(QIODevice::WriteOnly) == false)
+    {
+        return false;
+    }
+
+    QDataStream stream(&cacheFile);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    SourceKey key = sourceKey(sourceInfo);
+    stream << CACHE_MAGIC << CACHE_VERSION << key.path << key.modified << key.size;
+
+    stream << quint32(writer.strings().size());
+    for (QString const& text : writer.strings())
+    {
+        stream << text;
+    }
+
+    stream.writeRawData(tree.constData(), int(tree.size()));
+
+    return stream.status() == QDataStream::Ok && cacheFile.commit();
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::writeIfParsedBefore()
+//-----------------------------------------------------------------------------
+bool DocumentCache::writeIfParsedBefore(QString const& sourcePath, QDomDocument const& document)
+{
+    QFileInfo sourceInfo(sourcePath);
+    if (isEnabled() == false || sourceInfo.size() < MINIMUM_FILE_SIZE)
+    {
+        return false;
+    }
+
+    SourceKey key = sourceKey(sourceInfo);
+
+    {
+        QMutexLocker locker(&parsedSourcesMutex);
+
+        auto previous = parsedSources.find(key.path);
+        if (previous == parsedSources.end() || isSameSource(previous.value(), key) == false)
+        {
+            parsedSources.insert(key.path, key);
+            return false;
+        }
+
+        parsedSources.erase(previous);
+    }
+
+    return write(sourcePath, document);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentCache::prune()
+//-----------------------------------------------------------------------------
+int DocumentCache::prune(qint64 maximumSize)
+{
+    // The files are listed from the least recently written.
+    QFileInfoList cacheFiles = QDir(cacheDirectory()).entryInfoList(QStringList(QStringLiteral("*.bin")),
+        QDir::Files, QDir::Time | QDir::Reversed);
+
+    int removedFiles = 0;
+    qint64 totalSize = 0;
+    QFileInfoList keptFiles;
+
+    for (QFileInfo const& cacheInfo : cacheFiles)
+    {
+        QFile cacheFile(cacheInfo.absoluteFilePath());
+
+        SourceKey storedKey;
+        bool current = false;
+        if (cacheFile.open(QIODevice::ReadOnly))
+        {
+            QDataStream stream(&cacheFile);
+            stream.setVersion(QDataStream::Qt_6_0);
+
+            current = readHeader(stream, storedKey) &&
+                isSameSource(storedKey, sourceKey(QFileInfo(storedKey.path)));
+            cacheFile.close();
+        }
+
+        if (current == false && cacheFile.remove())
+        {
+            ++removedFiles;
+        }
+        else
+        {
+            keptFiles.append(cacheInfo);
+            totalSize += cacheInfo.size();
+        }
+    }
+
+    for (QFileInfo const& cacheInfo : keptFiles)
+    {
+        if (totalSize <= maximumSize)
+        {
+            break;
+        }
+
+        if (QFile::remove(cacheInfo.absoluteFilePath()))
+        {
+            totalSize -= cacheInfo.size();
+            ++removedFiles;
+        }
+    }
+
+    return removedFiles;
+}
@@ -43,10 +43,12 @@
 #include <IPXACTmodels/kactusExtensions/ComDefinitionWriter.h>
 #include <IPXACTmodels/kactusExtensions/ApiDefinitionWriter.h>
 
+#include <KactusAPI/include/DocumentCache.h>
 #include <KactusAPI/include/MessageMediator.h>
 
 #include <QObject>
 #include <QDomElement>
+#include <QSaveFile>
 #include <QXmlStreamWriter>
 
 //-----------------------------------------------------------------------------
@@ -54,17 +56,23 @@
 //-----------------------------------------------------------------------------
 QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path)
 {
-    // Create file handle and use it to read the IP-XACT document into memory.
-    QFile file(path);
-    file.open(QIODevice::ReadOnly);
-
+    // Restore the XML content from the cache, if the file has not changed since it was cached.
     QDomDocument doc;
-    if (!doc.setContent(&file))
+    if (DocumentCache::read(path, doc) == false)
     {
-        file.close();        
-        return QSharedPointer<Document>();
+        // Create file handle and use it to read the IP-XACT document into memory.
+        QFile file(path);
+        file.open(QIODevice::ReadOnly);
+
+        if (!doc.setContent(&file))
+        {
+            file.close();        
+            return QSharedPointer<Document>();
+        }
+        file.close();
+
+        DocumentCache::writeIfParsedBefore(path, doc);
     }
-    file.close();
 
     VLNV::IPXactType toCreate = VLNV::string2Type(doc.documentElement().nodeName());
 
@@ -114,14 +122,20 @@ QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path)
 //-----------------------------------------------------------------------------
 bool DocumentFileAccess::writeDocument(QSharedPointer<Document> model, QString const& path)
 {
-    QFile targetFile(path);
-    if (!targetFile.open(QFile::WriteOnly | QFile::Truncate))
+    // The document is written to a temporary file that replaces the target only when complete, so an
+    // interrupted save never leaves a truncated file.
+    QSaveFile targetFile(path);
+    if (!targetFile.open(QFile::WriteOnly))
     {      
         return false;
     }
 
-    // write the parsed model
-    QXmlStreamWriter xmlWriter(&targetFile);
+    // The cached content would be stale, if the file was rewritten within the resolution of its timestamp.
+    QFile::remove(DocumentCache::cachePath(path));
+
+    // The document is serialized in memory and written to the file at once.
+    QByteArray content;
+    QXmlStreamWriter xmlWriter(&content);
     xmlWriter.setAutoFormatting(true);
     xmlWriter.setAutoFormattingIndent(-1);
 
@@ -146,7 +160,7 @@ bool DocumentFileAccess::writeDocument(QSharedPointer<Document> model, QString c
     {
         ComponentWriter writer;
         QSharedPointer<Component> component = model.dynamicCast<Component>();
-        writer.writeComponent(xmlWriter, component);
+        content = writer.writeComponent(component);
     }
     else if (documentType == VLNV::DESIGN)
     {
@@ -174,10 +188,10 @@ bool DocumentFileAccess::writeDocument(QSharedPointer<Document> model, QString c
     else
     {
         Q_ASSERT_X(false, "DocumentFileAccess::writeDocument().", "Trying to write unknown document type to file.");
-        targetFile.close();
+        targetFile.cancelWriting();
         return false;
     }
 
-    targetFile.close();
-    return true;
+    targetFile.write(content);
+    return targetFile.commit();
 }
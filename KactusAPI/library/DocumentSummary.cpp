@@ -0,0 +1,260 @@
+//-----------------------------------------------------------------------------
+// File: DocumentSummary.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Compact record of the document data needed by the library views.
+//-----------------------------------------------------------------------------
+
+#include "DocumentSummary.h"
+
+#include <IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h>
+
+#include <IPXACTmodels/Catalog/Catalog.h>
+#include <IPXACTmodels/Catalog/IpxactFile.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/DesignConfigurationInstantiation.h>
+#include <IPXACTmodels/Component/DesignInstantiation.h>
+#include <IPXACTmodels/Component/View.h>
+
+#include <IPXACTmodels/Design/ComponentInstance.h>
+#include <IPXACTmodels/Design/Design.h>
+
+#include <IPXACTmodels/DesignConfiguration/DesignConfiguration.h>
+
+namespace
+{
+    /*!
+     *  Find the design referenced by the named design instantiation of a component.
+     */
+    VLNV findDesignReference(QSharedPointer<Component const> component, QString const& instantiationName)
+    {
+        for (QSharedPointer<DesignInstantiation> instantiation : *component->getDesignInstantiations())
+        {
+            if (instantiation->name() == instantiationName && instantiation->getDesignReference())
+            {
+                return *instantiation->getDesignReference();
+            }
+        }
+
+        return VLNV();
+    }
+
+    /*!
+     *  Find the design configuration referenced by the named design configuration instantiation of a component.
+     */
+    VLNV findConfigurationReference(QSharedPointer<Component const> component, QString const& instantiationName)
+    {
+        for (QSharedPointer<DesignConfigurationInstantiation> instantiation :
+            *component->getDesignConfigurationInstantiations())
+        {
+            if (instantiation->name() == instantiationName && instantiation->getDesignConfigurationReference())
+            {
+                return *instantiation->getDesignConfigurationReference();
+            }
+        }
+
+        return VLNV();
+    }
+
+    /*!
+     *  Append the VLNVs of the given catalog files to a list.
+     */
+    void appendCatalogFiles(QSharedPointer<QList<QSharedPointer<IpxactFile> > > files, QVector<VLNV>& items)
+    {
+        for (QSharedPointer<IpxactFile> const& file : *files)
+        {
+            items.append(file->getVlnv());
+        }
+    }
+
+    //! Write a VLNV to a data stream.
+    void writeVLNV(QDataStream& stream, VLNV const& vlnv)
+    {
+        stream << qint32(vlnv.getType()) << (vlnv.isEmpty() ? QString() : vlnv.toString());
+    }
+
+    //! Read a VLNV from a data stream.
+    VLNV readVLNV(QDataStream& stream)
+    {
+        qint32 type = 0;
+        QString vlnvString;
+        stream >> type >> vlnvString;
+
+        if (vlnvString.isEmpty())
+        {
+            return VLNV();
+        }
+
+        return VLNV(static_cast<VLNV::IPXactType>(type), vlnvString);
+    }
+
+    //! Write a list of VLNVs to a data stream.
+    template <typename Container>
+    void writeVLNVs(QDataStream& stream, Container const& vlnvs)
+    {
+        stream << qint32(vlnvs.size());
+        for (VLNV const& vlnv : vlnvs)
+        {
+            writeVLNV(stream, vlnv);
+        }
+    }
+
+    //! Read a list of VLNVs from a data stream.
+    template <typename Container>
+    void readVLNVs(QDataStream& stream, Container& vlnvs)
+    {
+        qint32 count = 0;
+        stream >> count;
+
+        vlnvs.clear();
+        for (qint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i)
+        {
+            vlnvs.append(readVLNV(stream));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentSummary::DocumentSummary()
+//-----------------------------------------------------------------------------
+DocumentSummary::DocumentSummary(QSharedPointer<Document const> document)
+{
+    if (document.isNull())
+    {
+        return;
+    }
+
+    type = document->getVlnv().getType();
+    revision = document->getRevision();
+    description = document->getDescription();
+    implementation = document->getImplementation();
+    firmness = document->getFirmness();
+    dependentVLNVs = document->getDependentVLNVs();
+
+    if (type == VLNV::COMPONENT)
+    {
+        QSharedPointer<Component const> component = document.dynamicCast<Component const>();
+
+        hierarchical = component->isHierarchical();
+        hasViews = component->hasViews();
+
+        for (QSharedPointer<View> view : *component->getViews())
+        {
+            if (view->isHierarchical())
+            {
+                HierarchicalView hierarchicalView;
+                hierarchicalView.name = view->name();
+
+                if (view->getDesignInstantiationRef().isEmpty() == false)
+                {
+                    hierarchicalView.designReference =
+                        findDesignReference(component, view->getDesignInstantiationRef());
+                }
+                else
+                {
+                    hierarchicalView.configurationReference =
+                        findConfigurationReference(component, view->getDesignConfigurationInstantiationRef());
+                }
+
+                hierarchicalViews.append(hierarchicalView);
+            }
+        }
+    }
+    else if (type == VLNV::DESIGN)
+    {
+        QSharedPointer<Design const> design = document.dynamicCast<Design const>();
+        for (QSharedPointer<ComponentInstance> instance : *design->getComponentInstances())
+        {
+            if (instance->isDraft() == false && instance->getComponentRef())
+            {
+                instantiatedComponents.append(*instance->getComponentRef());
+            }
+        }
+    }
+    else if (type == VLNV::DESIGNCONFIGURATION)
+    {
+        designReference = document.dynamicCast<DesignConfiguration const>()->getDesignRef();
+    }
+    else if (type == VLNV::ABSTRACTIONDEFINITION)
+    {
+        busType = document.dynamicCast<AbstractionDefinition const>()->getBusType();
+    }
+    else if (type == VLNV::CATALOG)
+    {
+        QSharedPointer<Catalog const> catalog = document.dynamicCast<Catalog const>();
+        appendCatalogFiles(catalog->getCatalogs(), catalogItems);
+        appendCatalogFiles(catalog->getBusDefinitions(), catalogItems);
+        appendCatalogFiles(catalog->getAbstractionDefinitions(), catalogItems);
+        appendCatalogFiles(catalog->getComponents(), catalogItems);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: operator<<()
+//-----------------------------------------------------------------------------
+QDataStream& operator<<(QDataStream& stream, DocumentSummary const& summary)
+{
+    stream << qint32(summary.type) << qint32(summary.revision) << summary.description <<
+        qint32(summary.implementation) << qint32(summary.firmness) << summary.hierarchical << summary.hasViews;
+
+    stream << qint32(summary.hierarchicalViews.size());
+    for (DocumentSummary::HierarchicalView const& view : summary.hierarchicalViews)
+    {
+        stream << view.name;
+        writeVLNV(stream, view.designReference);
+        writeVLNV(stream, view.configurationReference);
+    }
+
+    writeVLNV(stream, summary.designReference);
+    writeVLNVs(stream, summary.instantiatedComponents);
+    writeVLNV(stream, summary.busType);
+    writeVLNVs(stream, summary.catalogItems);
+    writeVLNVs(stream, summary.dependentVLNVs);
+
+    return stream;
+}
+
+//-----------------------------------------------------------------------------
+// Function: operator>>()
+//-----------------------------------------------------------------------------
+QDataStream& operator>>(QDataStream& stream, DocumentSummary& summary)
+{
+    qint32 type = 0;
+    qint32 revision = 0;
+    qint32 implementation = 0;
+    qint32 firmness = 0;
+    stream >> type >> revision >> summary.description >> implementation >> firmness >> summary.hierarchical >>
+        summary.hasViews;
+
+    summary.type = static_cast<VLNV::IPXactType>(type);
+    summary.revision = static_cast<Document::Revision>(revision);
+    summary.implementation = static_cast<KactusAttribute::Implementation>(implementation);
+    summary.firmness = static_cast<KactusAttribute::Firmness>(firmness);
+
+    qint32 viewCount = 0;
+    stream >> viewCount;
+
+    summary.hierarchicalViews.clear();
+    for (qint32 i = 0; i < viewCount && stream.status() == QDataStream::Ok; ++i)
+    {
+        DocumentSummary::HierarchicalView view;
+        stream >> view.name;
+        view.designReference = readVLNV(stream);
+        view.configurationReference = readVLNV(stream);
+
+        summary.hierarchicalViews.append(view);
+    }
+
+    summary.designReference = readVLNV(stream);
+    readVLNVs(stream, summary.instantiatedComponents);
+    summary.busType = readVLNV(stream);
+    readVLNVs(stream, summary.catalogItems);
+    readVLNVs(stream, summary.dependentVLNVs);
+
+    return stream;
+}
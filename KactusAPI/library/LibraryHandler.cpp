@@ -17,6 +17,8 @@
 
 #include "ConsoleMediator.h"
 
+#include "DocumentCache.h"
+
 #include "TagManager.h"
 
 #include <IPXACTmodels/common/Document.h>
@@ -37,12 +39,37 @@
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
+#include <QFutureWatcher>
 #include <QSharedPointer>
 #include <QList>
 #include <QMap>
+#include <QSettings>
 #include <QString>
 #include <QStringList>
 
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <algorithm>
+
+namespace
+{
+    //! Default memory budget for the parsed documents in megabytes.
+    const qint64 DEFAULT_CACHE_BUDGET_MB = 1024;
+
+    //! Estimated ratio of the memory used by a parsed document to the size of its file. The text of the
+    //! document is held in UTF-16 strings taking twice the size of the mostly ASCII file, and every element
+    //! becomes a separately allocated object with shared pointer control blocks and list storage around it.
+    //! The budget only relies on the sizes of the documents relative to each other, so a rough factor is
+    //! enough and the actual memory use is tuned with the budget setting.
+    const qint64 DOCUMENT_SIZE_FACTOR = 8;
+
+    //! The budget is enforced by releasing documents until this percentage of the budget is in use.
+    const qint64 CACHE_LOW_WATER_PERCENT = 80;
+
+    //! The models are rebuilt instead of updated, if more than this percentage of the library has changed.
+    const int MODEL_UPDATE_LIMIT_PERCENT = 25;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::getInstance()
 //-----------------------------------------------------------------------------
@@ -60,10 +87,29 @@ LibraryHandler::LibraryHandler():
 QObject(nullptr),
 LibraryInterface()
 {
+    cacheStatistics_.budget = DEFAULT_CACHE_BUDGET_MB * 1024 * 1024;
+
+    // A single writer keeps consecutive saves of the same file in order.
+    saveThreads_.setMaxThreadCount(1);
+
+    connect(&libraryWatcher_, &LibraryWatcher::filesChanged, this, &LibraryHandler::onLibraryFilesChanged);
+    connect(&libraryWatcher_, &LibraryWatcher::noticeMessage, this, [this](QString const& message)
+        {
+            messageChannel_->showMessage(message);
+        });
+
     // create the connections between models and library handler
     syncronizeModels();
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::~LibraryHandler()
+//-----------------------------------------------------------------------------
+LibraryHandler::~LibraryHandler()
+{
+    waitForSaves();
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::setOutputChannel()
 //-----------------------------------------------------------------------------
@@ -84,16 +130,12 @@ QSharedPointer<Document> LibraryHandler::getModel(VLNV const& vlnv)
         return QSharedPointer<Document>();
     }
 
-    // If object has not already been parsed, read it from the disk.
-    if (info->document.isNull())
-    {
-        info->document = DocumentFileAccess::readDocument(info->path);
-    }
+    QSharedPointer<Document> document = loadDocument(info);
 
     QSharedPointer<Document> copy;
-    if (info->document.isNull() == false)
+    if (document.isNull() == false)
     {
-        copy = info->document->clone();
+        copy = document->clone();
     }
 
     return copy;
@@ -110,12 +152,30 @@ QSharedPointer<Document const> LibraryHandler::getModelReadOnly(VLNV const& vlnv
         return QSharedPointer<Document const>();
     }
 
-    if (info->document.isNull())
+    return loadDocument(info);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::getSummary()
+//-----------------------------------------------------------------------------
+QSharedPointer<DocumentSummary const> LibraryHandler::getSummary(VLNV const& vlnv)
+{
+    auto info = documentCache_.find(vlnv);
+    if (info == documentCache_.end())
+    {
+        return QSharedPointer<DocumentSummary const>();
+    }
+
+    if (info->summary.isNull())
     {
-        info->document = DocumentFileAccess::readDocument(info->path);
+        QSharedPointer<Document> document = loadDocument(info);
+        if (document)
+        {
+            info->summary = QSharedPointer<DocumentSummary const>(new DocumentSummary(document));
+        }
     }
 
-    return info->document;
+    return info->summary;
 }
 
 //-----------------------------------------------------------------------------
@@ -172,8 +232,7 @@ bool LibraryHandler::writeModelToFile(QString const& path, QSharedPointer<Docume
         return false;
     }
 
-    // the hierarchy model must be re-built
-    hierarchyModel_.onResetModel();
+    hierarchyModel_.onAddVLNV(vlnv);
     treeModel_.onAddVLNV(vlnv);
     
     return true;
@@ -192,13 +251,43 @@ bool LibraryHandler::writeModelToFile(QSharedPointer<Document> model)
 //-----------------------------------------------------------------------------
 void LibraryHandler::searchForIPXactFiles()
 {
+    waitForSaves();
+
+    QSettings settings;
+    qint64 budgetMegabytes = settings.value(QStringLiteral("Library/DocumentCacheBudget"),
+        cacheStatistics_.budget / (1024 * 1024)).toLongLong();
+    cacheStatistics_.budget = budgetMegabytes * 1024 * 1024;
+
+    DocumentCache::setEnabled(settings.value(QStringLiteral("Library/BinaryDocumentCache"), true).toBool());
+
+    // The models are updated with the differences to the documents shown in them.
+    QMap<VLNV, bool> previousValidity;
+    for (auto it = documentCache_.cbegin(); it != documentCache_.cend(); ++it)
+    {
+        previousValidity.insert(it.key(), it->isValid);
+    }
+
     clearCache();
 
-    loadAvailableVLNVs();
+    QVector<VLNV> changedDocuments = loadAvailableVLNVs();
 
     onCheckLibraryIntegrity();
+
+    writeLibraryIndex();
+
+    // The library files have all been read, so the binary cache files of removed and changed files are unused.
+    DocumentCache::prune();
     
-    resetModels();
+    updateModels(previousValidity, changedDocuments);
+
+    if (settings.value(QStringLiteral("Library/WatchLocations"), true).toBool())
+    {
+        libraryWatcher_.watch(settings.value(QStringLiteral("Library/ActiveLocations")).toStringList());
+    }
+    else
+    {
+        libraryWatcher_.watch(QStringList());
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -401,16 +490,16 @@ void LibraryHandler::onCheckLibraryIntegrity()
     {
         // TODO: Add model to cache only, if it is already previously cached.
         // Current hierarchy model forces all models to be loaded, but this should be changed.
-        QSharedPointer<Document> model = it->document;
-        if (model.isNull())
-        {
-            model = DocumentFileAccess::readDocument(it->path);
-            it->document = model;
-        }           
+        QSharedPointer<Document> model = loadDocument(it);
 
         if (model.isNull() == false)
         {
             documentTags += (model->getTags());
+
+            if (it->summary.isNull())
+            {
+                it->summary = QSharedPointer<DocumentSummary const>(new DocumentSummary(model));
+            }
         }
 
         it->isValid = validateDocument(model, it->path);
@@ -565,12 +654,12 @@ void LibraryHandler::removeObject(VLNV const& vlnv)
         return;
     }
 
-    QString path = documentCache_.find(vlnv)->path;
+    // A pending save would create the file again after it is removed.
+    waitForSaves();
 
-    documentCache_.remove(vlnv);
+    QString path = getPath(vlnv);
 
-    treeModel_.onRemoveVLNV(vlnv);
-    hierarchyModel_.onRemoveVLNV(vlnv);
+    forgetDocument(vlnv);
 
     removeFile(path);
 }
@@ -611,27 +700,178 @@ void LibraryHandler::endSave()
     saveInProgress_ = false;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::waitForSaves()
+//-----------------------------------------------------------------------------
+void LibraryHandler::waitForSaves()
+{
+    saveThreads_.waitForDone();
+
+    // The finished signals are delivered through the event loop, so the writes are completed here to have
+    // the library match the files on return.
+    while (savesInProgress_.isEmpty() == false)
+    {
+        completeSave(savesInProgress_.first().watcher);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::onItemSaved()
 //-----------------------------------------------------------------------------
 void LibraryHandler::onItemSaved(VLNV const& vlnv) 
 {
-    if (vlnv.isValid() == false)
+    // The item may have been removed while it was written.
+    if (vlnv.isValid() == false || contains(vlnv) == false)
     {
         return;
     }
 
-    VLNV savedItem = vlnv;
-    savedItem.setType(getDocumentType(vlnv));
+    // The saved model and its validity were stored in the cache when the save was started. A new file did
+    // not exist yet at that point, so the validity is checked again for a document found invalid.
+    auto info = documentCache_.find(vlnv);
+    if (info->isValid == false)
+    {
+        info->isValid = validateDocument(loadDocument(info), info->path);
+    }
 
-    // Replace overwritten item with new and check validity.
-    QSharedPointer<Document> model = getModel(vlnv);
-    documentCache_.insert(vlnv, DocumentInfo(getPath(vlnv), model, validateDocument(model, getPath(vlnv))));
-    
     treeModel_.onDocumentUpdated(vlnv);
     hierarchyModel_.onDocumentUpdated(vlnv);
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::onLibraryFilesChanged()
+//-----------------------------------------------------------------------------
+void LibraryHandler::onLibraryFilesChanged(QStringList const& addedFiles, QStringList const& removedFiles,
+    QStringList const& modifiedFiles)
+{
+    messageChannel_->showStatusMessage(tr("Updating library. Please wait..."));
+
+    // The documents of the removed and modified files are found in a single pass over the cache.
+    QMap<QString, VLNV> changedDocuments;
+    for (QString const& path : removedFiles + modifiedFiles)
+    {
+        changedDocuments.insert(QDir::cleanPath(path), VLNV());
+    }
+
+    for (auto it = documentCache_.cbegin(); it != documentCache_.cend(); ++it)
+    {
+        auto changed = changedDocuments.find(QDir::cleanPath(it->path));
+        if (changed != changedDocuments.end())
+        {
+            changed.value() = it.key();
+        }
+    }
+
+    int removedCount = 0;
+    for (QString const& path : removedFiles)
+    {
+        VLNV vlnv = changedDocuments.value(QDir::cleanPath(path));
+
+        // A pending save replaces the file with the saved document.
+        if (vlnv.isValid() && pendingSaves_.contains(vlnv) == false)
+        {
+            forgetDocument(vlnv);
+            removedCount++;
+        }
+    }
+
+    QStringList newFiles = addedFiles;
+    QVector<VLNV> updatedDocuments;
+    for (QString const& path : modifiedFiles)
+    {
+        VLNV previousVLNV = changedDocuments.value(QDir::cleanPath(path));
+
+        // The file was written by a pending save and not modified outside the library.
+        if (pendingSaves_.contains(previousVLNV))
+        {
+            continue;
+        }
+
+        VLNV currentVLNV = loader_.getDocumentVLNV(path, messageChannel_);
+
+        if (previousVLNV.isValid() && previousVLNV == currentVLNV)
+        {
+            // The model and summary are read again from the file when needed.
+            storeDocument(currentVLNV, DocumentInfo(getPath(currentVLNV)));
+            updatedDocuments.append(currentVLNV);
+        }
+        else
+        {
+            // A file with a changed identifier is handled as a removed document and a new document.
+            if (previousVLNV.isValid())
+            {
+                forgetDocument(previousVLNV);
+                removedCount++;
+            }
+
+            newFiles.append(path);
+        }
+    }
+
+    // All the new documents are added before validation, since validation checks for VLNVs in the library.
+    QVector<VLNV> addedDocuments;
+    for (QString const& path : newFiles)
+    {
+        VLNV vlnv = loader_.getDocumentVLNV(path, messageChannel_);
+        if (vlnv.isValid() == false)
+        {
+            continue;
+        }
+
+        if (contains(vlnv))
+        {
+            // A file written by the library is already in the cache.
+            if (QFileInfo(getPath(vlnv)).canonicalFilePath() != QFileInfo(path).canonicalFilePath())
+            {
+                messageChannel_->showMessage(tr("VLNV %1 was already found in the library").arg(
+                    vlnv.toString()));
+            }
+        }
+        else
+        {
+            documentCache_.insert(vlnv, DocumentInfo(path));
+            addedDocuments.append(vlnv);
+        }
+    }
+
+    for (VLNV const& vlnv : addedDocuments + updatedDocuments)
+    {
+        auto info = documentCache_.find(vlnv);
+
+        QSharedPointer<Document> model = loadDocument(info);
+        if (model)
+        {
+            TagManager::getInstance().addNewTags(model->getTags());
+        }
+
+        info->isValid = validateDocument(model, info->path);
+    }
+
+    for (VLNV const& vlnv : addedDocuments)
+    {
+        treeModel_.onAddVLNV(vlnv);
+        treeModel_.onDocumentUpdated(vlnv);
+        hierarchyModel_.onAddVLNV(vlnv);
+    }
+
+    for (VLNV const& vlnv : updatedDocuments)
+    {
+        treeModel_.onDocumentUpdated(vlnv);
+        hierarchyModel_.onDocumentChanged(vlnv);
+
+        emit documentFileChanged(vlnv);
+    }
+
+    if (addedDocuments.isEmpty() == false || removedCount > 0 || updatedDocuments.isEmpty() == false)
+    {
+        messageChannel_->showMessage(tr("Library updated: %1 added, %2 removed and %3 modified item(s).").arg(
+            QString::number(addedDocuments.size()), QString::number(removedCount),
+            QString::number(updatedDocuments.size())));
+    }
+
+    messageChannel_->showStatusMessage(tr("Ready."));
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::syncronizeModels()
 //-----------------------------------------------------------------------------
@@ -697,30 +937,346 @@ bool LibraryHandler::addObject(QSharedPointer<Document> model, QString const& fi
         targetPath = pathInfo.symLinkTarget();
     }
 
-    DocumentFileAccess::writeDocument(model, targetPath);
+    // The file is replaced through a temporary file in the same directory, so the directory must be writable.
+    QFileInfo targetInfo(targetPath);
+    if ((targetInfo.exists() && targetInfo.isWritable() == false) ||
+        QFileInfo(targetInfo.absolutePath()).isWritable() == false)
+    {
+        messageChannel_->showError(tr("Could not write file %1.").arg(targetPath));
+        return false;
+    }
+
+    VLNV vlnv = model->getVlnv();
+
+    // The entry matching the file is kept until the pending writes are done, so it can be restored.
+    if (pendingSaves_.value(vlnv) == 0 && contains(vlnv))
+    {
+        writtenDocuments_.insert(vlnv, documentCache_.value(vlnv));
+    }
+    pendingSaves_[vlnv]++;
+
+    // The snapshot is shared by the cache and the background writer and is not modified afterwards.
+    QSharedPointer<Document> snapshot = model->clone();
 
     TagManager::getInstance().addNewTags(model->getTags());
 
-    documentCache_.insert(model->getVlnv(), DocumentInfo(targetPath, model->clone(), validateDocument(model, targetPath)));
+    DocumentInfo savedInfo(targetPath, snapshot, validateDocument(model, targetPath));
+    storeDocument(vlnv, savedInfo);
+
+    saveInBackground(vlnv, savedInfo);
 
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::saveInBackground()
+//-----------------------------------------------------------------------------
+void LibraryHandler::saveInBackground(VLNV const& vlnv, DocumentInfo const& savedInfo)
+{
+    auto watcher = new QFutureWatcher<bool>(this);
+    connect(watcher, &QFutureWatcher<bool>::finished, this, [this, watcher]()
+        {
+            completeSave(watcher);
+        });
+
+    SaveInProgress save;
+    save.watcher = watcher;
+    save.vlnv = vlnv;
+    save.savedInfo = savedInfo;
+    savesInProgress_.append(save);
+
+    QSharedPointer<Document> document = savedInfo.document;
+    QString filePath = savedInfo.path;
+    watcher->setFuture(QtConcurrent::run(&saveThreads_, [document, filePath]()
+        {
+            return DocumentFileAccess::writeDocument(document, filePath);
+        }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::completeSave()
+//-----------------------------------------------------------------------------
+void LibraryHandler::completeSave(QFutureWatcher<bool>* watcher)
+{
+    auto save = std::find_if(savesInProgress_.begin(), savesInProgress_.end(),
+        [watcher](SaveInProgress const& inProgress) { return inProgress.watcher == watcher; });
+    if (save == savesInProgress_.end())
+    {
+        return;
+    }
+
+    VLNV const vlnv = save->vlnv;
+    DocumentInfo const savedInfo = save->savedInfo;
+    savesInProgress_.erase(save);
+
+    // The finished signal may still be waiting in the event loop, when the write is completed in waitForSaves().
+    watcher->disconnect(this);
+    watcher->deleteLater();
+
+    // The saves are written in order, so no newer save is pending when this is the last one.
+    bool const latestSave = pendingSaves_.value(vlnv) == 1;
+
+    if (watcher->result())
+    {
+        writtenDocuments_.insert(vlnv, savedInfo);
+
+        libraryWatcher_.markAsKnown(savedInfo.path);
+        onItemSaved(vlnv);
+    }
+    else
+    {
+        messageChannel_->showError(tr("Could not write file %1.").arg(savedInfo.path));
+
+        // A newer save replaces the unwritten document in the cache anyway.
+        if (latestSave)
+        {
+            restoreWrittenDocument(vlnv);
+        }
+
+        emit saveFailed(vlnv);
+    }
+
+    if (--pendingSaves_[vlnv] <= 0)
+    {
+        pendingSaves_.remove(vlnv);
+        writtenDocuments_.remove(vlnv);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::restoreWrittenDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::restoreWrittenDocument(VLNV const& vlnv)
+{
+    // The document may have been removed while it was written.
+    if (contains(vlnv) == false)
+    {
+        return;
+    }
+
+    // The file itself is unchanged, since it is only replaced by a completely written file.
+    auto written = writtenDocuments_.constFind(vlnv);
+    if (written == writtenDocuments_.cend())
+    {
+        // The document was never written, so it is not in the library.
+        forgetDocument(vlnv);
+        return;
+    }
+
+    storeDocument(vlnv, written.value());
+
+    treeModel_.onDocumentUpdated(vlnv);
+    hierarchyModel_.onDocumentUpdated(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::forgetDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::forgetDocument(VLNV const& vlnv)
+{
+    auto info = documentCache_.find(vlnv);
+    if (info == documentCache_.end())
+    {
+        return;
+    }
+
+    removeResident(*info);
+    documentCache_.erase(info);
+
+    treeModel_.onRemoveVLNV(vlnv);
+    hierarchyModel_.onRemoveVLNV(vlnv);
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::clearCache()
 //-----------------------------------------------------------------------------
 void LibraryHandler::clearCache()
 {
     documentCache_.clear();
+    residentOrder_.clear();
+
+    cacheStatistics_.residentDocuments = 0;
+    cacheStatistics_.residentSize = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::setCacheBudget()
+//-----------------------------------------------------------------------------
+void LibraryHandler::setCacheBudget(qint64 budget)
+{
+    cacheStatistics_.budget = budget;
+    enforceCacheBudget();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::getCacheStatistics()
+//-----------------------------------------------------------------------------
+LibraryHandler::CacheStatistics LibraryHandler::getCacheStatistics() const
+{
+    return cacheStatistics_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::pinDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::pinDocument(VLNV const& vlnv)
+{
+    pinnedDocuments_[vlnv]++;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::unpinDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::unpinDocument(VLNV const& vlnv)
+{
+    auto pin = pinnedDocuments_.find(vlnv);
+    if (pin != pinnedDocuments_.end() && --pin.value() <= 0)
+    {
+        pinnedDocuments_.erase(pin);
+        enforceCacheBudget();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::loadDocument()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document> LibraryHandler::loadDocument(QMap<VLNV, DocumentInfo>::iterator info)
+{
+    if (info->document)
+    {
+        cacheStatistics_.hits++;
+        markUsed(info.key(), *info);
+        return info->document;
+    }
+
+    // A released model still referenced elsewhere is taken back without reading the file again.
+    QSharedPointer<Document> document = info->released.toStrongRef();
+    info->released.clear();
+
+    if (document.isNull())
+    {
+        cacheStatistics_.misses++;
+        document = DocumentFileAccess::readDocument(info->path);
+    }
+    else
+    {
+        cacheStatistics_.hits++;
+    }
+
+    if (document)
+    {
+        info->document = document;
+        addResident(info.key(), *info);
+        enforceCacheBudget();
+    }
+
+    return document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::storeDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::storeDocument(VLNV const& vlnv, DocumentInfo const& info)
+{
+    auto previous = documentCache_.find(vlnv);
+    if (previous != documentCache_.end())
+    {
+        removeResident(*previous);
+    }
+
+    // The stored entry is counted in the resident documents from the start.
+    auto stored = documentCache_.insert(vlnv, info);
+    stored->residentSize = 0;
+
+    if (stored->document)
+    {
+        addResident(vlnv, *stored);
+        enforceCacheBudget();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::addResident()
+//-----------------------------------------------------------------------------
+void LibraryHandler::addResident(VLNV const& vlnv, DocumentInfo& info)
+{
+    removeResident(info);
+
+    info.residentSize = qMax<qint64>(1, QFileInfo(info.path).size() * DOCUMENT_SIZE_FACTOR);
+    markUsed(vlnv, info);
+
+    cacheStatistics_.residentDocuments++;
+    cacheStatistics_.residentSize += info.residentSize;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::markUsed()
+//-----------------------------------------------------------------------------
+void LibraryHandler::markUsed(VLNV const& vlnv, DocumentInfo& info)
+{
+    residentOrder_.remove(info.lastUse);
+
+    info.lastUse = ++useCounter_;
+    residentOrder_.insert(info.lastUse, vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::removeResident()
+//-----------------------------------------------------------------------------
+void LibraryHandler::removeResident(DocumentInfo& info)
+{
+    if (info.residentSize > 0)
+    {
+        cacheStatistics_.residentDocuments--;
+        cacheStatistics_.residentSize -= info.residentSize;
+        info.residentSize = 0;
+
+        residentOrder_.remove(info.lastUse);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::enforceCacheBudget()
+//-----------------------------------------------------------------------------
+void LibraryHandler::enforceCacheBudget()
+{
+    if (cacheStatistics_.budget <= 0 || cacheStatistics_.residentSize <= cacheStatistics_.budget)
+    {
+        return;
+    }
+
+    qint64 lowWater = cacheStatistics_.budget / 100 * CACHE_LOW_WATER_PERCENT;
+
+    // The resident models are ordered from the least recently used.
+    auto candidate = residentOrder_.begin();
+    while (candidate != residentOrder_.end() && cacheStatistics_.residentSize > lowWater)
+    {
+        auto info = documentCache_.find(candidate.value());
+        ++candidate;
+
+        if (info == documentCache_.end() || pinnedDocuments_.contains(info.key()))
+        {
+            continue;
+        }
+
+        // The model is freed, unless an editor or another user still holds a reference to it.
+        info->released = info->document;
+        info->document.clear();
+
+        removeResident(*info);
+        cacheStatistics_.evictions++;
+    }
 }
 
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::loadAvailableVLNVs()
 //-----------------------------------------------------------------------------
-void LibraryHandler::loadAvailableVLNVs()
+QVector<VLNV> LibraryHandler::loadAvailableVLNVs()
 {
     messageChannel_->showStatusMessage(tr("Scanning library. Please wait..."));
 
+    QVector<VLNV> changedDocuments;
+
     // Read all items before validation.
     // Validation will check for VLNVs in the library, so they must be available before validation.    
     for (auto const& target: loader_.parseLibrary(messageChannel_))
@@ -732,10 +1288,34 @@ void LibraryHandler::loadAvailableVLNVs()
         }
         else
         {
-            documentCache_.insert(target.vlnv, DocumentInfo(target.path));
+            auto info = documentCache_.insert(target.vlnv, DocumentInfo(target.path));
+            info->summary = target.summary;
+
+            if (target.unchanged == false)
+            {
+                changedDocuments.append(target.vlnv);
+            }
         }
     }
     messageChannel_->showStatusMessage(tr("Ready."));
+
+    return changedDocuments;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::writeLibraryIndex()
+//-----------------------------------------------------------------------------
+void LibraryHandler::writeLibraryIndex() const
+{
+    QVector<LibraryLoader::LoadTarget> targets;
+    targets.reserve(documentCache_.size());
+
+    for (auto it = documentCache_.cbegin(); it != documentCache_.cend(); ++it)
+    {
+        targets.append(LibraryLoader::LoadTarget(it.key(), it->path, it->summary));
+    }
+
+    loader_.writeLibraryIndex(targets);
 }
 
 //-----------------------------------------------------------------------------
@@ -750,6 +1330,85 @@ void LibraryHandler::resetModels()
     messageChannel_->showStatusMessage(tr("Ready."));
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::updateModels()
+//-----------------------------------------------------------------------------
+void LibraryHandler::updateModels(QMap<VLNV, bool> const& previousValidity,
+    QVector<VLNV> const& changedDocuments)
+{
+    QVector<VLNV> removedDocuments;
+    for (auto it = previousValidity.cbegin(); it != previousValidity.cend(); ++it)
+    {
+        if (contains(it.key()) == false)
+        {
+            removedDocuments.append(it.key());
+        }
+    }
+
+    QVector<VLNV> addedDocuments;
+    QVector<VLNV> revalidatedDocuments;
+    for (auto it = documentCache_.cbegin(); it != documentCache_.cend(); ++it)
+    {
+        auto previous = previousValidity.constFind(it.key());
+        if (previous == previousValidity.cend())
+        {
+            addedDocuments.append(it.key());
+        }
+        else if (previous.value() != it->isValid)
+        {
+            revalidatedDocuments.append(it.key());
+        }
+    }
+
+    // The documents added by this scan are also in the changed documents.
+    QVector<VLNV> modifiedDocuments;
+    for (VLNV const& vlnv : changedDocuments)
+    {
+        if (previousValidity.contains(vlnv))
+        {
+            modifiedDocuments.append(vlnv);
+        }
+    }
+
+    // Rebuilding the models is faster than applying a large number of changes one at a time.
+    int changeCount = removedDocuments.size() + addedDocuments.size() + modifiedDocuments.size();
+    if (previousValidity.isEmpty() ||
+        changeCount * 100 > qMax(previousValidity.size(), documentCache_.size()) * MODEL_UPDATE_LIMIT_PERCENT)
+    {
+        resetModels();
+        return;
+    }
+
+    messageChannel_->showStatusMessage(tr("Updating library view. Please wait..."));
+
+    for (VLNV const& vlnv : removedDocuments)
+    {
+        treeModel_.onRemoveVLNV(vlnv);
+        hierarchyModel_.onRemoveVLNV(vlnv);
+    }
+
+    for (VLNV const& vlnv : addedDocuments)
+    {
+        treeModel_.onAddVLNV(vlnv);
+        treeModel_.onDocumentUpdated(vlnv);
+        hierarchyModel_.onAddVLNV(vlnv);
+    }
+
+    for (VLNV const& vlnv : modifiedDocuments)
+    {
+        treeModel_.onDocumentUpdated(vlnv);
+        hierarchyModel_.onDocumentChanged(vlnv);
+    }
+
+    for (VLNV const& vlnv : revalidatedDocuments)
+    {
+        treeModel_.onDocumentUpdated(vlnv);
+        hierarchyModel_.onDocumentUpdated(vlnv);
+    }
+
+    messageChannel_->showStatusMessage(tr("Ready."));
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::showIntegrityResults()
 //-----------------------------------------------------------------------------
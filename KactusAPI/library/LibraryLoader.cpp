@@ -11,12 +11,24 @@
 
 #include "LibraryLoader.h"
 
+#include <QDataStream>
 #include <QDir>
 #include <QDirIterator>
 #include <QFileInfo>
+#include <QSaveFile>
 #include <QSettings>
+#include <QStandardPaths>
 #include <QXmlStreamReader>
 
+namespace
+{
+    //! Identifier of the library index files.
+    const quint32 LIBRARY_INDEX_MAGIC = 0x4B324C49;
+
+    //! Format version of the library index. Must be changed whenever the stored data changes.
+    const qint32 LIBRARY_INDEX_VERSION = 1;
+};
+
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::parseLibrary()
 //-----------------------------------------------------------------------------
@@ -25,6 +37,8 @@ QVector<LibraryLoader::LoadTarget> LibraryLoader::parseLibrary(MessageMediator c
     QVector<LoadTarget> vlnvPaths;
     QStringList xmlFilter{ QStringLiteral("*.xml") };
 
+    QHash<QString, IndexEntry> const libraryIndex = readLibraryIndex();
+
     for (QString const& location : QSettings().value(QStringLiteral("Library/ActiveLocations")).toStringList())
     {        
         QDirIterator fileIterator(location, xmlFilter, QDir::Files,
@@ -34,6 +48,16 @@ QVector<LibraryLoader::LoadTarget> LibraryLoader::parseLibrary(MessageMediator c
         {
             QString filePath(fileIterator.next());
 
+            // Unchanged files are not read again.
+            if (auto indexed = libraryIndex.constFind(filePath); indexed != libraryIndex.cend() &&
+                indexed->lastModified == fileIterator.fileInfo().lastModified().toMSecsSinceEpoch() &&
+                indexed->size == fileIterator.fileInfo().size())
+            {
+                vlnvPaths.append(LoadTarget(indexed->vlnv, filePath, indexed->summary));
+                vlnvPaths.last().unchanged = true;
+                continue;
+            }
+
             VLNV vlnv = getDocumentVLNV(filePath, messageChannel);
             if (vlnv.isValid())
             {
@@ -45,6 +69,43 @@ QVector<LibraryLoader::LoadTarget> LibraryLoader::parseLibrary(MessageMediator c
     return vlnvPaths;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::writeLibraryIndex()
+//-----------------------------------------------------------------------------
+void LibraryLoader::writeLibraryIndex(QVector<LoadTarget> const& targets) const
+{
+    QString indexPath = libraryIndexPath();
+    if (indexPath.isEmpty() || QDir().mkpath(QFileInfo(indexPath).absolutePath()) == false)
+    {
+        return;
+    }
+
+    QSaveFile indexFile(indexPath);
+    if (indexFile.open(QIODevice::WriteOnly) == false)
+    {
+        return;
+    }
+
+    QDataStream indexStream(&indexFile);
+    indexStream.setVersion(QDataStream::Qt_6_0);
+    indexStream << LIBRARY_INDEX_MAGIC << LIBRARY_INDEX_VERSION << qint32(targets.size());
+
+    for (LoadTarget const& target : targets)
+    {
+        QFileInfo targetInfo(target.path);
+
+        indexStream << target.path << targetInfo.lastModified().toMSecsSinceEpoch() << targetInfo.size() <<
+            qint32(target.vlnv.getType()) << target.vlnv.toString() << (target.summary.isNull() == false);
+
+        if (target.summary)
+        {
+            indexStream << *target.summary;
+        }
+    }
+
+    indexFile.commit();
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::clean()
 //-----------------------------------------------------------------------------
@@ -114,6 +175,77 @@ VLNV LibraryLoader::getDocumentVLNV(QString const& path, MessageMediator const*
     return documentVLNV;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::readLibraryIndex()
+//-----------------------------------------------------------------------------
+QHash<QString, LibraryLoader::IndexEntry> LibraryLoader::readLibraryIndex() const
+{
+    QHash<QString, IndexEntry> libraryIndex;
+
+    QFile indexFile(libraryIndexPath());
+    if (indexFile.open(QIODevice::ReadOnly) == false)
+    {
+        return libraryIndex;
+    }
+
+    QDataStream indexStream(&indexFile);
+    indexStream.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic = 0;
+    qint32 version = 0;
+    qint32 entryCount = 0;
+    indexStream >> magic >> version >> entryCount;
+
+    // An index of another format is ignored and replaced by the next write.
+    if (magic != LIBRARY_INDEX_MAGIC || version != LIBRARY_INDEX_VERSION || entryCount < 0)
+    {
+        return libraryIndex;
+    }
+
+    libraryIndex.reserve(entryCount);
+    for (qint32 i = 0; i < entryCount; ++i)
+    {
+        QString path;
+        IndexEntry entry;
+        qint32 type = 0;
+        QString vlnvString;
+        bool hasSummary = false;
+
+        indexStream >> path >> entry.lastModified >> entry.size >> type >> vlnvString >> hasSummary;
+        entry.vlnv = VLNV(static_cast<VLNV::IPXactType>(type), vlnvString);
+
+        if (hasSummary)
+        {
+            QSharedPointer<DocumentSummary> summary(new DocumentSummary());
+            indexStream >> *summary;
+            entry.summary = summary;
+        }
+
+        if (indexStream.status() != QDataStream::Ok)
+        {
+            return QHash<QString, IndexEntry>();
+        }
+
+        libraryIndex.insert(path, entry);
+    }
+
+    return libraryIndex;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::libraryIndexPath()
+//-----------------------------------------------------------------------------
+QString LibraryLoader::libraryIndexPath()
+{
+    QString dataLocation = QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation);
+    if (dataLocation.isEmpty())
+    {
+        return QString();
+    }
+
+    return dataLocation + QStringLiteral("/LibraryIndex.dat");
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::clearDirectoryStructure()
 //-----------------------------------------------------------------------------
@@ -12,12 +12,10 @@
 #include "LibraryTreeModel.h"
 #include "LibraryItem.h"
 #include "LibraryInterface.h"
+#include "DocumentSummary.h"
 
 #include <IPXACTmodels/common/Document.h>
 
-#include <IPXACTmodels/Component/Component.h>
-#include <IPXACTmodels/Design/Design.h>
-
 #include <IPXACTmodels/kactusExtensions/KactusAttribute.h>
 
 #include <common/KactusColors.h>
@@ -227,13 +225,15 @@ QVariant LibraryTreeModel::data(QModelIndex const& index, int role) const
                 "<b>Name:</b> " + vlnv.getName() + "<br>" +
                 "<b>Version:</b> " + vlnv.getVersion() + "<br>";
 
-            QSharedPointer<Document const> document = handler_->getModelReadOnly(vlnv);
-
-            text += "<br><b>Compatibility:</b> " + Document::toString(document->getRevision());
-
-            if (document != 0 && !document->getDescription().isEmpty())
+            QSharedPointer<DocumentSummary const> summary = handler_->getSummary(vlnv);
+            if (summary)
             {
-                text += "<br><b>Description:</b><br>" + document->getDescription();
+                text += "<br><b>Compatibility:</b> " + Document::toString(summary->revision);
+
+                if (!summary->description.isEmpty())
+                {
+                    text += "<br><b>Description:</b><br>" + summary->description;
+                }
             }
 
             text += "<br><b>File Path:</b><br>" + handler_->getPath(vlnv);
@@ -254,18 +254,17 @@ QVariant LibraryTreeModel::data(QModelIndex const& index, int role) const
             VLNV::IPXactType documentType = vlnv.getType();
             if (documentType == VLNV::COMPONENT)
             {
-                QSharedPointer<Component const> component = 
-                    handler_->getModelReadOnly(vlnv).staticCast<Component const>();
+                QSharedPointer<DocumentSummary const> component = handler_->getSummary(vlnv);
 
                 if (component != 0)
                 {
-                    if (component->getImplementation() == KactusAttribute::SYSTEM)
+                    if (component->implementation == KactusAttribute::SYSTEM)
                     {
                         return QIcon(":/icons/common/graphics/system-component.png");
                     }
-                    else if (component->getImplementation() == KactusAttribute::SW)
+                    else if (component->implementation == KactusAttribute::SW)
                     {
-                        if (component->isHierarchical())
+                        if (component->hierarchical)
                         {
                             return QIcon(":/icons/common/graphics/hier-sw-component.png");
                         }
@@ -276,7 +275,7 @@ QVariant LibraryTreeModel::data(QModelIndex const& index, int role) const
                     }
                     else
                     {
-                        if (component->isHierarchical())
+                        if (component->hierarchical)
                         {
                             return QIcon(":/icons/common/graphics/hier-hw-component.png");
                         }
@@ -318,9 +317,9 @@ QVariant LibraryTreeModel::data(QModelIndex const& index, int role) const
             else if (documentType == VLNV::DESIGN)
             {
                 // Determine the design type.
-                QSharedPointer<const Design> design = handler_->getModelReadOnly<Design>(vlnv);
-                if (design && (design->getImplementation() == KactusAttribute::SW ||
-                    design->getImplementation() == KactusAttribute::SYSTEM))
+                QSharedPointer<DocumentSummary const> design = handler_->getSummary(vlnv);
+                if (design && (design->implementation == KactusAttribute::SW ||
+                    design->implementation == KactusAttribute::SYSTEM))
                 {
                     return QIcon(":/icons/common/graphics/sw-design48x48.png");
                 }
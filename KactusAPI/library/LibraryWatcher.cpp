@@ -0,0 +1,372 @@
+//-----------------------------------------------------------------------------
+// File: LibraryWatcher.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Watches the library locations for added, removed and modified IP-XACT files.
+//-----------------------------------------------------------------------------
+
+#include "LibraryWatcher.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::LibraryWatcher()
+//-----------------------------------------------------------------------------
+LibraryWatcher::LibraryWatcher(QObject* parent):
+QObject(parent)
+{
+    batchTimer_.setSingleShot(true);
+    batchTimer_.setInterval(BATCH_DELAY);
+
+    connect(&watcher_, &QFileSystemWatcher::directoryChanged, this, &LibraryWatcher::onDirectoryChanged);
+    connect(&watcher_, &QFileSystemWatcher::fileChanged, this, &LibraryWatcher::onFileChanged);
+    connect(&batchTimer_, &QTimer::timeout, this, &LibraryWatcher::onBatchReady);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::watch()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::watch(QStringList const& locations)
+{
+    batchTimer_.stop();
+
+    if (watcher_.files().isEmpty() == false)
+    {
+        watcher_.removePaths(watcher_.files());
+    }
+
+    if (watcher_.directories().isEmpty() == false)
+    {
+        watcher_.removePaths(watcher_.directories());
+    }
+
+    directoryFiles_.clear();
+    changedDirectories_.clear();
+    changedFiles_.clear();
+    knownStates_.clear();
+    unwatchedStates_.clear();
+    watchFiles_ = true;
+
+    QStringList found;
+    for (QString const& location : locations)
+    {
+        if (QFileInfo(location).isDir())
+        {
+            watchDirectory(location, found);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::markAsKnown()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::markAsKnown(QString const& filePath)
+{
+    knownStates_.insert(filePath, fileState(filePath));
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::onDirectoryChanged()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::onDirectoryChanged(QString const& path)
+{
+    changedDirectories_.insert(path);
+    batchTimer_.start();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::onFileChanged()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::onFileChanged(QString const& path)
+{
+    changedFiles_.insert(path);
+    batchTimer_.start();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::onBatchReady()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::onBatchReady()
+{
+    QStringList added;
+    QStringList removed;
+    QStringList modified;
+
+    QSet<QString> const changedDirectories = changedDirectories_;
+    changedDirectories_.clear();
+
+    for (QString const& directory : changedDirectories)
+    {
+        // The directory may have been forgotten along with a removed parent directory.
+        auto knownFiles = directoryFiles_.find(directory);
+        if (knownFiles == directoryFiles_.end())
+        {
+            continue;
+        }
+
+        if (QFileInfo(directory).isDir() == false)
+        {
+            forgetDirectory(directory, removed);
+            continue;
+        }
+
+        QSet<QString> currentFiles = listXmlFiles(directory);
+
+        QStringList newFiles;
+        for (QString const& file : currentFiles)
+        {
+            if (knownFiles->contains(file) == false)
+            {
+                newFiles.append(file);
+            }
+        }
+
+        for (QString const& file : *knownFiles)
+        {
+            if (currentFiles.contains(file) == false)
+            {
+                removed.append(file);
+                knownStates_.remove(file);
+                unwatchedStates_.remove(file);
+            }
+        }
+
+        *knownFiles = currentFiles;
+
+        compareUnwatchedFiles(currentFiles, modified);
+
+        if (newFiles.isEmpty() == false)
+        {
+            watchFiles(newFiles);
+            added += newFiles;
+        }
+
+        // Directories created e.g. by a version control update are watched with their content.
+        for (QString const& name : QDir(directory).entryList(QDir::Dirs | QDir::NoDotAndDotDot))
+        {
+            QString subdirectory = directory + QLatin1Char('/') + name;
+            if (directoryFiles_.contains(subdirectory) == false)
+            {
+                watchDirectory(subdirectory, added);
+            }
+        }
+    }
+
+    QSet<QString> const changedFiles = changedFiles_;
+    changedFiles_.clear();
+
+    QSet<QString> const addedFiles(added.cbegin(), added.cend());
+    QSet<QString> const removedFiles(removed.cbegin(), removed.cend());
+
+    for (QString const& file : changedFiles)
+    {
+        if (addedFiles.contains(file) || removedFiles.contains(file))
+        {
+            continue;
+        }
+
+        QFileInfo fileInfo(file);
+        if (fileInfo.exists() == false)
+        {
+            auto knownFiles = directoryFiles_.find(fileInfo.path());
+            if (knownFiles != directoryFiles_.end() && knownFiles->remove(file))
+            {
+                removed.append(file);
+                knownStates_.remove(file);
+                unwatchedStates_.remove(file);
+            }
+
+            continue;
+        }
+
+        // A file replaced by renaming another file over it is no longer watched.
+        watcher_.removePath(file);
+        watchFiles({ file });
+
+        if (isKnownState(file) == false)
+        {
+            modified.append(file);
+        }
+    }
+
+    if (added.isEmpty() == false || removed.isEmpty() == false || modified.isEmpty() == false)
+    {
+        emit filesChanged(added, removed, modified);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::watchDirectory()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::watchDirectory(QString const& directory, QStringList& found)
+{
+    QStringList directories{ directory };
+
+    QDirIterator directoryIterator(directory, QDir::Dirs | QDir::NoDotAndDotDot,
+        QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+    while (directoryIterator.hasNext())
+    {
+        directories.append(directoryIterator.next());
+    }
+
+    QStringList newDirectories;
+    QStringList newFiles;
+    for (QString const& path : directories)
+    {
+        if (directoryFiles_.contains(path) == false)
+        {
+            QSet<QString> files = listXmlFiles(path);
+            directoryFiles_.insert(path, files);
+
+            newDirectories.append(path);
+            newFiles += QStringList(files.cbegin(), files.cend());
+        }
+    }
+
+    if (newDirectories.isEmpty() == false)
+    {
+        QStringList failedDirectories = watcher_.addPaths(newDirectories);
+        if (failedDirectories.isEmpty() == false)
+        {
+            emit noticeMessage(tr("Could not watch %1 directories in the library, e.g. %2. Refresh the library "
+                "to find the changes in them.").arg(QString::number(failedDirectories.size()),
+                failedDirectories.first()));
+        }
+    }
+
+    if (newFiles.isEmpty() == false)
+    {
+        watchFiles(newFiles);
+    }
+
+    found += newFiles;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::forgetDirectory()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::forgetDirectory(QString const& directory, QStringList& removed)
+{
+    QString const subdirectoryPrefix = directory + QLatin1Char('/');
+
+    for (auto it = directoryFiles_.begin(); it != directoryFiles_.end(); )
+    {
+        if (it.key() == directory || it.key().startsWith(subdirectoryPrefix))
+        {
+            for (QString const& file : *it)
+            {
+                removed.append(file);
+                knownStates_.remove(file);
+                unwatchedStates_.remove(file);
+            }
+
+            it = directoryFiles_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::watchFiles()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::watchFiles(QStringList const& files)
+{
+    QStringList failedFiles = files;
+    if (watchFiles_)
+    {
+        failedFiles = watcher_.addPaths(files);
+    }
+
+    if (failedFiles.isEmpty())
+    {
+        return;
+    }
+
+    // Typically the limit of watched files has been reached, so no more files are tried.
+    if (watchFiles_)
+    {
+        watchFiles_ = false;
+        emit noticeMessage(tr("Could not watch all the files in the library, e.g. %1. Only the directories "
+            "are watched for the rest of the files. Refresh the library to find files modified in place.").arg(
+            failedFiles.first()));
+    }
+
+    for (QString const& file : failedFiles)
+    {
+        unwatchedStates_.insert(file, fileState(file));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::compareUnwatchedFiles()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::compareUnwatchedFiles(QSet<QString> const& files, QStringList& modified)
+{
+    for (QString const& file : files)
+    {
+        auto unwatchedState = unwatchedStates_.find(file);
+        if (unwatchedState == unwatchedStates_.end())
+        {
+            continue;
+        }
+
+        QPair<qint64, qint64> currentState = fileState(file);
+        if (currentState != *unwatchedState)
+        {
+            *unwatchedState = currentState;
+
+            if (isKnownState(file) == false)
+            {
+                modified.append(file);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::isKnownState()
+//-----------------------------------------------------------------------------
+bool LibraryWatcher::isKnownState(QString const& filePath) const
+{
+    auto knownState = knownStates_.constFind(filePath);
+    if (knownState == knownStates_.cend())
+    {
+        return false;
+    }
+
+    return *knownState == fileState(filePath);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::listXmlFiles()
+//-----------------------------------------------------------------------------
+QSet<QString> LibraryWatcher::listXmlFiles(QString const& directory)
+{
+    QSet<QString> files;
+
+    for (QString const& name : QDir(directory).entryList({ QStringLiteral("*.xml") }, QDir::Files))
+    {
+        files.insert(directory + QLatin1Char('/') + name);
+    }
+
+    return files;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::fileState()
+//-----------------------------------------------------------------------------
+QPair<qint64, qint64> LibraryWatcher::fileState(QString const& filePath)
+{
+    QFileInfo fileInfo(filePath);
+    return qMakePair(fileInfo.lastModified().toMSecsSinceEpoch(), fileInfo.size());
+}
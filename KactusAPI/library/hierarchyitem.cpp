@@ -17,10 +17,6 @@
 
 #include <IPXACTmodels/common/VLNV.h>
 
-#include <IPXACTmodels/Catalog/IpxactFile.h>
-
-#include <IPXACTmodels/DesignConfiguration/DesignConfiguration.h>
-
 #include <IPXACTmodels/kactusExtensions/SystemView.h>
 
 //-----------------------------------------------------------------------------
@@ -30,7 +26,7 @@ HierarchyItem::HierarchyItem(LibraryInterface* handler, HierarchyItem* parent,
     VLNV const& vlnv, KactusAttribute::Implementation implementation, QString const& viewName):
 QObject(parent),
     vlnv_(vlnv),
-    component_(),    
+    summary_(),    
     library_(handler),
     childItems_(),
     parentItem_(parent),
@@ -96,7 +92,7 @@ QObject(parent),
 HierarchyItem::HierarchyItem(LibraryInterface* handler, QObject* parent ):
 QObject(parent),
     vlnv_(),
-    component_(),
+    summary_(),
     library_(handler),
     childItems_(),
     parentItem_(NULL),
@@ -122,6 +118,33 @@ void HierarchyItem::createChild(VLNV const& vlnv)
 	childItems_.append(new HierarchyItem(library_, this, vlnv));
 }
 
+//-----------------------------------------------------------------------------
+// Function: HierarchyItem::insertChild()
+//-----------------------------------------------------------------------------
+void HierarchyItem::insertChild(int row, VLNV const& vlnv, QString const& viewName)
+{
+    // Designs are created with the implementation of their summary, like in createChildItemForDesign().
+    KactusAttribute::Implementation implementation = KactusAttribute::HW;
+    if (library_->getDocumentType(vlnv) == VLNV::DESIGN)
+    {
+        QSharedPointer<DocumentSummary const> design = library_->getSummary(vlnv);
+        if (design)
+        {
+            implementation = design->implementation;
+        }
+    }
+
+    childItems_.insert(row, new HierarchyItem(library_, this, vlnv, implementation, viewName));
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyItem::takeChild()
+//-----------------------------------------------------------------------------
+HierarchyItem* HierarchyItem::takeChild(int row)
+{
+    return childItems_.takeAt(row);
+}
+
 //-----------------------------------------------------------------------------
 // Function: HierarchyItem::parent()
 //-----------------------------------------------------------------------------
@@ -231,7 +254,7 @@ bool HierarchyItem::contains(VLNV const& vlnv) const
 void HierarchyItem::cleanUp()
 {
 	// make sure this is called only for root item
-	Q_ASSERT_X(!component_, "HierarchyItem::cleanUp", "Function was called for non-root item");
+	Q_ASSERT_X(!summary_, "HierarchyItem::cleanUp", "Function was called for non-root item");
 
 	for (auto item = childItems_.begin(); item != childItems_.end(); ++item)
     {
@@ -251,11 +274,11 @@ void HierarchyItem::cleanUp()
 }
 
 //-----------------------------------------------------------------------------
-// Function: HierarchyItem::component()
+// Function: HierarchyItem::summary()
 //-----------------------------------------------------------------------------
-QSharedPointer<Component const> HierarchyItem::component() const
+QSharedPointer<DocumentSummary const> HierarchyItem::summary() const
 {
-	return component_;
+	return summary_;
 }
 
 //-----------------------------------------------------------------------------
@@ -366,6 +389,25 @@ QVector<HierarchyItem*> HierarchyItem::findItems(const VLNV& vlnv)
 	return items;
 }
 
+//-----------------------------------------------------------------------------
+// Function: HierarchyItem::findAffectedItems()
+//-----------------------------------------------------------------------------
+void HierarchyItem::findAffectedItems(VLNV const& vlnv, QVector<HierarchyItem*>& items)
+{
+    for (HierarchyItem* item : childItems_)
+    {
+        // The subtree of an affected item is created again with the item, so it is not searched.
+        if (item->getVLNV() == vlnv || item->referencesDocument(vlnv))
+        {
+            items.append(item);
+        }
+        else
+        {
+            item->findAffectedItems(vlnv, items);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: HierarchyItem::updateItems()
 //-----------------------------------------------------------------------------
@@ -486,19 +528,19 @@ void HierarchyItem::clear()
 //-----------------------------------------------------------------------------
 bool HierarchyItem::isHierarchical() const
 {
-	Q_ASSERT(component_);
-    if (component_.isNull())
+	Q_ASSERT(summary_);
+    if (summary_.isNull())
     {
         return false;
     }
 
-    if (component_->getImplementation() == KactusAttribute::SW)
+    if (summary_->implementation == KactusAttribute::SW)
     {
-        return component_->hasViews();
+        return summary_->hasViews;
     }
     else
     {
-	    return component_->isHierarchical();
+	    return summary_->hierarchical;
     }
 }
 
@@ -507,10 +549,10 @@ bool HierarchyItem::isHierarchical() const
 //-----------------------------------------------------------------------------
 KactusAttribute::Implementation HierarchyItem::getImplementation() const
 {
-    Q_ASSERT(component_);
-    if (component_)
+    Q_ASSERT(summary_);
+    if (summary_)
     {
-        return component_->getImplementation();
+        return summary_->implementation;
     }
     else
     {
@@ -532,7 +574,7 @@ HierarchyItem::ObjectType HierarchyItem::type() const
 void HierarchyItem::getChildren(QList<VLNV>& childList, VLNV const& owner) const
 {
 	// make sure this is called only for root item
-	Q_ASSERT_X(!component_, "HierarchyItem::getChildren", "Function was called for non-root item");
+	Q_ASSERT_X(!summary_, "HierarchyItem::getChildren", "Function was called for non-root item");
 
 	// search each child item
 	for (HierarchyItem const* item : childItems_)
@@ -606,28 +648,70 @@ bool HierarchyItem::hasChild(VLNV const& vlnv)
         [&vlnv](HierarchyItem const* child) { return child->getVLNV() == vlnv; }) != childItems_.cend();
 }
 
+//-----------------------------------------------------------------------------
+// Function: HierarchyItem::referencesDocument()
+//-----------------------------------------------------------------------------
+bool HierarchyItem::referencesDocument(VLNV const& vlnv) const
+{
+    if (type_ == HierarchyItem::COMPONENT)
+    {
+        if (summary_.isNull())
+        {
+            return false;
+        }
+
+        for (DocumentSummary::HierarchicalView const& view : summary_->hierarchicalViews)
+        {
+            if (view.designReference == vlnv || view.configurationReference == vlnv)
+            {
+                return true;
+            }
+
+            if (view.configurationReference.isEmpty() == false)
+            {
+                QSharedPointer<DocumentSummary const> configuration =
+                    library_->getSummary(view.configurationReference);
+                if (configuration && configuration->designReference == vlnv)
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    else if (type_ == HierarchyItem::HW_DESIGN || type_ == HierarchyItem::SW_DESIGN ||
+        type_ == HierarchyItem::SYS_DESIGN)
+    {
+        QSharedPointer<DocumentSummary const> design = library_->getSummary(vlnv_);
+        return design && design->instantiatedComponents.contains(vlnv);
+    }
+    else if (type_ == HierarchyItem::CATALOG)
+    {
+        QSharedPointer<DocumentSummary const> catalog = library_->getSummary(vlnv_);
+        return catalog && catalog->catalogItems.contains(vlnv);
+    }
+
+    return false;
+}
+
 //-----------------------------------------------------------------------------
 // Function: HierarchyItem::parseComponent()
 //-----------------------------------------------------------------------------
 void HierarchyItem::parseComponent(VLNV const& vlnv)
 {
     type_ = HierarchyItem::COMPONENT;
-    component_ = library_->getModelReadOnly<Component>(vlnv);
+    summary_ = library_->getSummary(vlnv);
     isValid_ = library_->isValid(vlnv);
     
-    Q_ASSERT(component_);
-    if (component_.isNull())
+    Q_ASSERT(summary_);
+    if (summary_.isNull())
     {
         return;
     }
 
-    for (QSharedPointer<View> view : *component_->getViews())
+    for (DocumentSummary::HierarchicalView const& view : summary_->hierarchicalViews)
     {
-        if (view->isHierarchical())
-        {
-            VLNV designVLNV = findDesignReference(view);
-            createChildItemForDesign(designVLNV, view->name());
-        }
+        VLNV designVLNV = findDesignReference(view);
+        createChildItemForDesign(designVLNV, view.name);
     }
 }
 
@@ -637,84 +721,53 @@ void HierarchyItem::parseComponent(VLNV const& vlnv)
 void HierarchyItem::parseCatalog(VLNV const& vlnv)
 {
     type_ = HierarchyItem::CATALOG;
-    QSharedPointer<Catalog const> catalog = library_->getModelReadOnly<Catalog>(vlnv);
+    QSharedPointer<DocumentSummary const> catalog = library_->getSummary(vlnv);
     Q_ASSERT(catalog);
 
     isValid_ = library_->isValid(vlnv);
 
-    for (QSharedPointer<IpxactFile> catalogFile : *catalog->getCatalogs())
-    {
-        if (!hasParent(catalogFile->getVlnv())) //<! Avoid cyclic instantiations.
-        {
-             createChild(catalogFile->getVlnv());
-        }       
-    }
-
-    for (QSharedPointer<IpxactFile> const& busFile : *catalog->getBusDefinitions())
-    {
-        createChild(busFile->getVlnv());   
-    }
-
-    for (QSharedPointer<IpxactFile> const& abstractionFile : *catalog->getAbstractionDefinitions())
+    if (catalog.isNull())
     {
-        createChild(abstractionFile->getVlnv()); 
+        return;
     }
 
-    for (QSharedPointer<IpxactFile> const& componentFile : *catalog->getComponents())
+    for (VLNV const& itemVLNV : catalog->catalogItems)
     {
-        createChild(componentFile->getVlnv());
+        if (itemVLNV.getType() != VLNV::CATALOG || !hasParent(itemVLNV)) //<! Avoid cyclic instantiations.
+        {
+            createChild(itemVLNV);
+        }
     }
 }
 
 //-----------------------------------------------------------------------------
 // Function: HierarchyItem::findDesignReference()
 //-----------------------------------------------------------------------------
-VLNV HierarchyItem::findDesignReference(QSharedPointer<View> view)
+VLNV HierarchyItem::findDesignReference(DocumentSummary::HierarchicalView const& view)
 {
-    if (!view->getDesignInstantiationRef().isEmpty())
+    if (view.configurationReference.isEmpty())
     {
-        QString viewDesign = view->getDesignInstantiationRef();
+        return view.designReference;
+    }
 
-        for (QSharedPointer<DesignInstantiation> instantiation : *component_->getDesignInstantiations())
-        {
-            if (instantiation->name() == viewDesign)
-            {
-                return *instantiation->getDesignReference();
-            }
-        }
+    VLNV configurationVLNV = view.configurationReference;
+
+    if (!library_->contains(configurationVLNV))
+    {
+        isValid_ = false;
+        return configurationVLNV;
+    }
+    else if (library_->getDocumentType(configurationVLNV) != VLNV::DESIGNCONFIGURATION)
+    {
+        //emit errorMessage(tr("Design Configuration reference %1 was for wrong type of object.").arg(
+        //    configurationVLNV.toString()));
+        isValid_ = false;
+        return VLNV();
     }
     else
     {
-        QString viewConfiguration = view->getDesignConfigurationInstantiationRef();
-
-        for (QSharedPointer<DesignConfigurationInstantiation> instantiation : 
-            *component_->getDesignConfigurationInstantiations())
-        {
-            if (instantiation->name() == viewConfiguration)
-            {
-                VLNV configurationVLNV = *instantiation->getDesignConfigurationReference();
-
-                if (!library_->contains(configurationVLNV))
-                {
-                    isValid_ = false;
-                    return configurationVLNV;
-                }
-                else if (library_->getDocumentType(configurationVLNV) != VLNV::DESIGNCONFIGURATION)
-                {
-                    //emit errorMessage(tr("Design Configuration reference %1 was for wrong type of object.").arg(
-                    //    configurationVLNV.toString()));
-                    isValid_ = false;
-                    return VLNV();
-                }
-                else
-                {
-                    return library_->getModelReadOnly<DesignConfiguration>(configurationVLNV)->getDesignRef();                   
-                }
-            }
-        }
+        return library_->getSummary(configurationVLNV)->designReference;
     }
-
-    return VLNV();
 }
 
 //-----------------------------------------------------------------------------
@@ -731,7 +784,7 @@ void HierarchyItem::createChildItemForDesign(VLNV const& designVLNV, QString con
         }
         else if (!hasChild(designVLNV)) 
         {
-            KactusAttribute::Implementation implementation = library_->getModelReadOnly(designVLNV)->getImplementation();
+            KactusAttribute::Implementation implementation = library_->getSummary(designVLNV)->implementation;
             HierarchyItem* designItem = new HierarchyItem(library_, this, designVLNV, implementation, viewName);
 
             connect(designItem, SIGNAL(errorMessage(QString const&)),
@@ -789,7 +842,7 @@ void HierarchyItem::parseDesign(VLNV const& vlnv, KactusAttribute::Implementatio
     instanceCount_.clear();
 
     viewName_ = viewName;
-    QSharedPointer<Design const> design = library_->getModelReadOnly<Design>(vlnv);
+    QSharedPointer<DocumentSummary const> design = library_->getSummary(vlnv);
     isValid_ = library_->isValid(vlnv);
 
     if (implementation == KactusAttribute::HW)
@@ -810,7 +863,8 @@ void HierarchyItem::parseDesign(VLNV const& vlnv, KactusAttribute::Implementatio
     }
 
     // Take all valid components referenced by the design.
-    const QVector<VLNV> componentReferences = getValidComponentsInDesign(design);
+    const QVector<VLNV> componentReferences = design ?
+        getValidComponentsInDesign(design->instantiatedComponents) : QVector<VLNV>();
 
     for (VLNV const& componentVLNV : componentReferences)
     {
@@ -833,25 +887,20 @@ void HierarchyItem::parseDesign(VLNV const& vlnv, KactusAttribute::Implementatio
 //-----------------------------------------------------------------------------
 // Function: HierarchyItem::getValidComponentsInDesign()
 //-----------------------------------------------------------------------------
-QVector<VLNV> HierarchyItem::getValidComponentsInDesign(QSharedPointer<Design const> design)
+QVector<VLNV> HierarchyItem::getValidComponentsInDesign(QVector<VLNV> const& instantiatedComponents)
 {
     QVector<VLNV> componentReferences;
 
-    for (QSharedPointer<ComponentInstance> instance : *design->getComponentInstances())
+    for (VLNV const& componentVLNV : instantiatedComponents)
     {
-        if (!instance->isDraft())
+        if (isValidComponentInstanceVLNV(componentVLNV))
         {
-            VLNV componentVLNV = *instance->getComponentRef();
-
-            if (isValidComponentInstanceVLNV(componentVLNV))
-            {
-                componentReferences.append(componentVLNV);
-            }
-            else
-            {
-                // Mark this object as invalid because not all items were valid.
-                isValid_ = false;
-            }
+            componentReferences.append(componentVLNV);
+        }
+        else
+        {
+            // Mark this object as invalid because not all items were valid.
+            isValid_ = false;
         }
     }
 
@@ -11,6 +11,7 @@
 
 #include "hierarchymodel.h"
 
+#include <KactusAPI/include/DocumentSummary.h>
 #include <KactusAPI/include/LibraryInterface.h>
 
 #include <IPXACTmodels/Component/Component.h>
@@ -68,10 +69,13 @@ void HierarchyModel::onResetModel()
     // create the abstraction definitions
     for (VLNV const& absDefVlnv : absDefs) 
     {
-    	QSharedPointer<AbstractionDefinition const> absDef = 
-            handler_->getModelReadOnly(absDefVlnv).staticCast<AbstractionDefinition const>();
+    	QSharedPointer<DocumentSummary const> absDef = handler_->getSummary(absDefVlnv);
+        if (absDef.isNull())
+        {
+            continue;
+        }
 
-        for (HierarchyItem* busDefItem : rootItem_->findItems(absDef->getBusType()))
+        for (HierarchyItem* busDefItem : rootItem_->findItems(absDef->busType))
         {
     		busDefItem->createChild(absDefVlnv);
         }
@@ -288,13 +292,15 @@ QVariant HierarchyModel::data(QModelIndex const& index, int role) const
                        "<b>Name:</b> " % vlnv.getName() % "<br>" %
                        "<b>Version:</b> " % vlnv.getVersion() % "<br>";
 
-        QSharedPointer<Document const> document = handler_->getModelReadOnly(vlnv);
-        
-        text += "<br><b>Compatibility:</b> " + Document::toString(document->getRevision());
-
-        if (document != 0 && !document->getDescription().isEmpty())
+        QSharedPointer<DocumentSummary const> summary = handler_->getSummary(vlnv);
+        if (summary)
         {
-            text += "<br><b>Description:</b><br>" % document->getDescription();
+            text += "<br><b>Compatibility:</b> " + Document::toString(summary->revision);
+
+            if (!summary->description.isEmpty())
+            {
+                text += "<br><b>Description:</b><br>" % summary->description;
+            }
         }
 
         text += QString("<br><b>File Path:</b><br>%1").arg(handler_->getPath(vlnv));
@@ -627,9 +633,109 @@ void HierarchyModel::onRemoveVLNV(VLNV const& vlnv)
     	return;
     }
 
-    beginResetModel();
-    rootItem_->removeItems(vlnv);
-    endResetModel();
+    QList<VLNV> changedVLNVs;
+
+    // Removing the items in reverse order handles the nested items before the items containing them.
+    QVector<HierarchyItem*> removedItems = rootItem_->findItems(vlnv);
+    for (auto it = removedItems.crbegin(); it != removedItems.crend(); ++it)
+    {
+        HierarchyItem* removedItem = *it;
+        HierarchyItem* parentItem = removedItem->parent();
+        int row = removedItem->row();
+
+        removedItem->getChildItems(changedVLNVs);
+
+        beginRemoveRows(index(parentItem), row, row);
+        delete parentItem->takeChild(row);
+        endRemoveRows();
+
+        // The design of a component is no longer valid when it references items that are not in the library.
+        if (parentItem->type() == HierarchyItem::COMPONENT)
+        {
+            parentItem->setValidity(false);
+
+            QModelIndex parentIndex = index(parentItem);
+            emit dataChanged(parentIndex, parentIndex.siblingAtColumn(HierarchyModel::COLUMN_COUNT - 1));
+        }
+    }
+
+    updateDuplicates(changedVLNVs);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyModel::onAddVLNV()
+//-----------------------------------------------------------------------------
+void HierarchyModel::onAddVLNV(VLNV const& vlnv)
+{
+    if (!vlnv.isValid())
+    {
+        return;
+    }
+
+    QList<VLNV> changedVLNVs{ vlnv };
+
+    QVector<HierarchyItem*> affectedItems;
+    rootItem_->findAffectedItems(vlnv, affectedItems);
+    for (HierarchyItem* item : affectedItems)
+    {
+        recreateItem(item)->getChildItems(changedVLNVs);
+    }
+
+    VLNV::IPXactType documentType = vlnv.getType();
+
+    //! Add supported item types only. Designs and configurations will be created by their top-components.
+    if ((documentType == VLNV::ABSTRACTIONDEFINITION || documentType == VLNV::BUSDEFINITION ||
+        documentType == VLNV::CATALOG || documentType == VLNV::COMPONENT ||
+        documentType == VLNV::APIDEFINITION || documentType == VLNV::COMDEFINITION) &&
+        rootItem_->hasChild(vlnv) == false)
+    {
+        int row = rootItem_->getNumberOfChildren();
+
+        beginInsertRows(QModelIndex(), row, row);
+        rootItem_->createChild(vlnv);
+        endInsertRows();
+
+        rootItem_->child(row)->getChildItems(changedVLNVs);
+    }
+
+    if (documentType == VLNV::ABSTRACTIONDEFINITION)
+    {
+        insertAbstractionDefinition(vlnv);
+    }
+
+    updateDuplicates(changedVLNVs);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyModel::onDocumentChanged()
+//-----------------------------------------------------------------------------
+void HierarchyModel::onDocumentChanged(VLNV const& vlnv)
+{
+    if (!vlnv.isValid())
+    {
+        return;
+    }
+
+    // The bus type of an abstraction definition may have changed, so its items are placed again.
+    if (vlnv.getType() == VLNV::ABSTRACTIONDEFINITION)
+    {
+        onRemoveVLNV(vlnv);
+        onAddVLNV(vlnv);
+        return;
+    }
+
+    QList<VLNV> changedVLNVs{ vlnv };
+
+    QVector<HierarchyItem*> affectedItems;
+    rootItem_->findAffectedItems(vlnv, affectedItems);
+    for (HierarchyItem* item : affectedItems)
+    {
+        // The items no longer in the subtree may no longer be duplicates.
+        item->getChildItems(changedVLNVs);
+        recreateItem(item)->getChildItems(changedVLNVs);
+    }
+
+    updateDuplicates(changedVLNVs);
 }
 
 //-----------------------------------------------------------------------------
@@ -649,6 +755,9 @@ void HierarchyModel::onDocumentUpdated(VLNV const& vlnv)
     for (HierarchyItem* updatedItem : rootItem_->findItems(vlnv))
     {
         updatedItem->setValidity(isValid);
+
+        QModelIndex itemIndex = index(updatedItem);
+        emit dataChanged(itemIndex, itemIndex.siblingAtColumn(HierarchyModel::COLUMN_COUNT - 1));
     }
 }
 
@@ -669,6 +778,87 @@ void HierarchyModel::getChildren(QList<VLNV>& childList, VLNV const& owner) cons
     rootItem_->getChildren(childList, owner);
 }
 
+//-----------------------------------------------------------------------------
+// Function: HierarchyModel::recreateItem()
+//-----------------------------------------------------------------------------
+HierarchyItem* HierarchyModel::recreateItem(HierarchyItem* item)
+{
+    HierarchyItem* parentItem = item->parent();
+    QModelIndex parentIndex = index(parentItem);
+    int row = item->row();
+
+    VLNV vlnv = item->getVLNV();
+    QString viewName = item->getViewName();
+    bool isDuplicate = item->isDuplicate();
+
+    beginRemoveRows(parentIndex, row, row);
+    delete parentItem->takeChild(row);
+    endRemoveRows();
+
+    beginInsertRows(parentIndex, row, row);
+    parentItem->insertChild(row, vlnv, viewName);
+
+    HierarchyItem* newItem = parentItem->child(row);
+    newItem->setDuplicate(isDuplicate);
+    endInsertRows();
+
+    return newItem;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyModel::insertAbstractionDefinition()
+//-----------------------------------------------------------------------------
+void HierarchyModel::insertAbstractionDefinition(VLNV const& absDefVLNV)
+{
+    QSharedPointer<DocumentSummary const> absDef = handler_->getSummary(absDefVLNV);
+    if (absDef.isNull())
+    {
+        return;
+    }
+
+    for (HierarchyItem* busDefItem : rootItem_->findItems(absDef->busType))
+    {
+        if (busDefItem->hasChild(absDefVLNV) == false)
+        {
+            int row = busDefItem->getNumberOfChildren();
+
+            beginInsertRows(index(busDefItem), row, row);
+            busDefItem->createChild(absDefVLNV);
+            endInsertRows();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyModel::updateDuplicates()
+//-----------------------------------------------------------------------------
+void HierarchyModel::updateDuplicates(QList<VLNV> const& vlnvs)
+{
+    for (int row = 0; row < rootItem_->getNumberOfChildren(); ++row)
+    {
+        HierarchyItem* item = rootItem_->child(row);
+        if (vlnvs.contains(item->getVLNV()) == false)
+        {
+            continue;
+        }
+
+        bool isDuplicate = false;
+        for (int otherRow = 0; otherRow < rootItem_->getNumberOfChildren() && isDuplicate == false; ++otherRow)
+        {
+            HierarchyItem* other = rootItem_->child(otherRow);
+            isDuplicate = other != item && other->contains(item->getVLNV());
+        }
+
+        if (isDuplicate != item->isDuplicate())
+        {
+            item->setDuplicate(isDuplicate);
+
+            QModelIndex itemIndex = index(item);
+            emit dataChanged(itemIndex, itemIndex.siblingAtColumn(HierarchyModel::COLUMN_COUNT - 1));
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: HierarchyModel::onShowErrors()
 //-----------------------------------------------------------------------------
@@ -0,0 +1,529 @@
+//-----------------------------------------------------------------------------
+// File: RegisterMapImporter.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Imports memory maps, address blocks, registers and fields from tabular data.
+//-----------------------------------------------------------------------------
+
+#include "RegisterMapImporter.h"
+
+#include <IPXACTmodels/common/AccessTypes.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/Register.h>
+#include <IPXACTmodels/Component/Field.h>
+#include <IPXACTmodels/Component/FieldReset.h>
+
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextStream>
+
+namespace
+{
+    //! Separator for the names in the item keys.
+    const QChar KEY_SEPARATOR(0x1F);
+
+    //! Default width of created address blocks.
+    const QString DEFAULT_BLOCK_WIDTH = QStringLiteral("32");
+
+    //! Default range of created address blocks.
+    const QString DEFAULT_BLOCK_RANGE = QStringLiteral("4");
+
+    //! Default size of created registers.
+    const QString DEFAULT_REGISTER_SIZE = QStringLiteral("32");
+};
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::RegisterMapImporter()
+//-----------------------------------------------------------------------------
+RegisterMapImporter::RegisterMapImporter(QSharedPointer<Component> component):
+component_(component)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::importFile()
+//-----------------------------------------------------------------------------
+int RegisterMapImporter::importFile(QString const& filePath)
+{
+    QFile inputFile(filePath);
+    if (inputFile.open(QIODevice::ReadOnly | QIODevice::Text) == false)
+    {
+        addError(0, QStringLiteral("Could not open file %1 for reading.").arg(filePath));
+        return 0;
+    }
+
+    QString suffix = QFileInfo(filePath).suffix().toLower();
+    if (suffix == QLatin1String("jsonl") || suffix == QLatin1String("ndjson"))
+    {
+        return importData(inputFile, Format::JsonLines);
+    }
+
+    if (suffix == QLatin1String("json"))
+    {
+        return importData(inputFile, Format::Json);
+    }
+
+    return importData(inputFile, Format::CSV);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::importData()
+//-----------------------------------------------------------------------------
+int RegisterMapImporter::importData(QIODevice& input, Format format)
+{
+    if (component_.isNull())
+    {
+        addError(0, QStringLiteral("No component to import into."));
+        return 0;
+    }
+
+    if (indexed_ == false)
+    {
+        indexComponent();
+    }
+
+    if (format == Format::JsonLines)
+    {
+        return importJsonLines(input);
+    }
+
+    if (format == Format::Json)
+    {
+        return importJson(input);
+    }
+
+    return importCsv(input);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::getErrors()
+//-----------------------------------------------------------------------------
+QVector<RegisterMapImporter::RowError> RegisterMapImporter::getErrors() const
+{
+    return errors_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::importCsv()
+//-----------------------------------------------------------------------------
+int RegisterMapImporter::importCsv(QIODevice& input)
+{
+    QTextStream stream(&input);
+
+    QStringList columns;
+    QStringList values;
+    int importedRows = 0;
+    int line = 0;
+
+    while (stream.atEnd() == false)
+    {
+        QString record = stream.readLine();
+        ++line;
+        int const firstLine = line;
+
+        while (splitCsvRecord(record, values) == false && stream.atEnd() == false)
+        {
+            record.append(QLatin1Char('\n'));
+            record.append(stream.readLine());
+            ++line;
+        }
+
+        if (record.trimmed().isEmpty())
+        {
+            continue;
+        }
+
+        if (columns.isEmpty())
+        {
+            for (QString const& column : values)
+            {
+                columns.append(column.trimmed().toLower());
+            }
+
+            continue;
+        }
+
+        if (values.size() > columns.size())
+        {
+            addError(firstLine, QStringLiteral("The row has %1 values but there are only %2 columns.").arg(
+                QString::number(values.size()), QString::number(columns.size())));
+            continue;
+        }
+
+        Row row;
+        row.reserve(values.size());
+        for (int i = 0; i < values.size(); ++i)
+        {
+            row.insert(columns.at(i), values.at(i).trimmed());
+        }
+
+        if (importRow(row, firstLine))
+        {
+            ++importedRows;
+        }
+    }
+
+    return importedRows;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::importJsonLines()
+//-----------------------------------------------------------------------------
+int RegisterMapImporter::importJsonLines(QIODevice& input)
+{
+    int importedRows = 0;
+    int line = 0;
+
+    while (input.atEnd() == false)
+    {
+        QByteArray record = input.readLine().trimmed();
+        ++line;
+
+        if (record.isEmpty())
+        {
+            continue;
+        }
+
+        QJsonParseError parseError;
+        QJsonDocument document = QJsonDocument::fromJson(record, &parseError);
+        if (parseError.error != QJsonParseError::NoError || document.isObject() == false)
+        {
+            addError(line, QStringLiteral("The line is not a JSON object."));
+            continue;
+        }
+
+        if (importRow(rowFromJson(document.object()), line))
+        {
+            ++importedRows;
+        }
+    }
+
+    return importedRows;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::importJson()
+//-----------------------------------------------------------------------------
+int RegisterMapImporter::importJson(QIODevice& input)
+{
+    QJsonParseError parseError;
+    QJsonDocument document = QJsonDocument::fromJson(input.readAll(), &parseError);
+    if (parseError.error != QJsonParseError::NoError)
+    {
+        addError(0, QStringLiteral("The input is not a valid JSON document: %1.").arg(parseError.errorString()));
+        return 0;
+    }
+
+    QJsonArray objects;
+    if (document.isArray())
+    {
+        objects = document.array();
+    }
+    else if (document.isObject())
+    {
+        objects.append(document.object());
+    }
+
+    int importedRows = 0;
+    for (int i = 0; i < objects.size(); ++i)
+    {
+        if (objects.at(i).isObject() == false)
+        {
+            addError(i + 1, QStringLiteral("The array item is not a JSON object."));
+        }
+        else if (importRow(rowFromJson(objects.at(i).toObject()), i + 1))
+        {
+            ++importedRows;
+        }
+    }
+
+    return importedRows;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::rowFromJson()
+//-----------------------------------------------------------------------------
+RegisterMapImporter::Row RegisterMapImporter::rowFromJson(QJsonObject const& object)
+{
+    Row row;
+    row.reserve(object.size());
+    for (auto value = object.constBegin(); value != object.constEnd(); ++value)
+    {
+        row.insert(value.key().toLower(), value.value().toVariant().toString().trimmed());
+    }
+
+    return row;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::splitCsvRecord()
+//-----------------------------------------------------------------------------
+bool RegisterMapImporter::splitCsvRecord(QString const& record, QStringList& values)
+{
+    values.clear();
+
+    QString value;
+    bool quoted = false;
+
+    for (int i = 0; i < record.size(); ++i)
+    {
+        QChar const character = record.at(i);
+
+        if (quoted)
+        {
+            if (character == QLatin1Char('"'))
+            {
+                if (i + 1 < record.size() && record.at(i + 1) == QLatin1Char('"'))
+                {
+                    value.append(character);
+                    ++i;
+                }
+                else
+                {
+                    quoted = false;
+                }
+            }
+            else
+            {
+                value.append(character);
+            }
+        }
+        else if (character == QLatin1Char('"'))
+        {
+            quoted = true;
+        }
+        else if (character == QLatin1Char(','))
+        {
+            values.append(value);
+            value.clear();
+        }
+        else
+        {
+            value.append(character);
+        }
+    }
+
+    values.append(value);
+    return quoted == false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::importRow()
+//-----------------------------------------------------------------------------
+bool RegisterMapImporter::importRow(Row const& row, int line)
+{
+    QString const mapName = row.value(QStringLiteral("memorymap"));
+    QString const blockName = row.value(QStringLiteral("addressblock"));
+    QString const registerName = row.value(QStringLiteral("register"));
+    QString const fieldName = row.value(QStringLiteral("field"));
+
+    if (mapName.isEmpty() || blockName.isEmpty() || registerName.isEmpty())
+    {
+        addError(line, QStringLiteral("The row must name a memory map, an address block and a register."));
+        return false;
+    }
+
+    QString const blockKey = mapName + KEY_SEPARATOR + blockName;
+    QString const registerKey = blockKey + KEY_SEPARATOR + registerName;
+    QString const fieldKey = registerKey + KEY_SEPARATOR + fieldName;
+
+    QString const access = row.value(QStringLiteral("access"));
+    AccessTypes::Access fieldAccess = AccessTypes::ACCESS_COUNT;
+
+    if (fieldName.isEmpty() == false)
+    {
+        if (fields_.contains(fieldKey))
+        {
+            addError(line, QStringLiteral("Field %1 already exists in register %2.").arg(fieldName, registerName));
+            return false;
+        }
+
+        if (row.value(QStringLiteral("bitoffset")).isEmpty() || row.value(QStringLiteral("bitwidth")).isEmpty())
+        {
+            addError(line, QStringLiteral("Field %1 must have a bit offset and a bit width.").arg(fieldName));
+            return false;
+        }
+
+        fieldAccess = AccessTypes::str2Access(access, AccessTypes::ACCESS_COUNT);
+        if (access.isEmpty() == false && fieldAccess == AccessTypes::ACCESS_COUNT)
+        {
+            addError(line, QStringLiteral("Unknown access %1 in field %2.").arg(access, fieldName));
+            return false;
+        }
+    }
+
+    if (registers_.contains(registerKey) == false && row.value(QStringLiteral("registeroffset")).isEmpty())
+    {
+        addError(line, QStringLiteral("New register %1 must have a register offset.").arg(registerName));
+        return false;
+    }
+
+    QSharedPointer<AddressBlock> containingBlock = findOrCreateBlock(findOrCreateMap(mapName), blockKey, row);
+    QSharedPointer<Register> containingRegister = findOrCreateRegister(containingBlock, registerKey, row, line);
+    if (containingRegister.isNull())
+    {
+        return false;
+    }
+
+    if (fieldName.isEmpty())
+    {
+        return true;
+    }
+
+    QSharedPointer<Field> newField(new Field(fieldName));
+    newField->setBitOffset(row.value(QStringLiteral("bitoffset")));
+    newField->setBitWidth(row.value(QStringLiteral("bitwidth")));
+    newField->setDescription(row.value(QStringLiteral("description")));
+
+    if (fieldAccess != AccessTypes::ACCESS_COUNT)
+    {
+        newField->setAccess(fieldAccess);
+    }
+
+    if (QString const resetValue = row.value(QStringLiteral("resetvalue")); resetValue.isEmpty() == false)
+    {
+        QSharedPointer<FieldReset> newReset(new FieldReset());
+        newReset->setResetValue(resetValue);
+        newReset->setResetMask(row.value(QStringLiteral("resetmask")));
+        newField->getResets()->append(newReset);
+    }
+
+    containingRegister->getFields()->append(newField);
+    fields_.insert(fieldKey);
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::findOrCreateMap()
+//-----------------------------------------------------------------------------
+QSharedPointer<MemoryMap> RegisterMapImporter::findOrCreateMap(QString const& mapName)
+{
+    QSharedPointer<MemoryMap> memoryMap = maps_.value(mapName);
+    if (memoryMap.isNull())
+    {
+        memoryMap = QSharedPointer<MemoryMap>(new MemoryMap(mapName));
+        component_->getMemoryMaps()->append(memoryMap);
+        maps_.insert(mapName, memoryMap);
+    }
+
+    return memoryMap;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::findOrCreateBlock()
+//-----------------------------------------------------------------------------
+QSharedPointer<AddressBlock> RegisterMapImporter::findOrCreateBlock(QSharedPointer<MemoryMap> containingMap,
+    QString const& key, Row const& row)
+{
+    QSharedPointer<AddressBlock> block = blocks_.value(key);
+    if (block.isNull())
+    {
+        QString baseAddress = row.value(QStringLiteral("blockbaseaddress"));
+        QString range = row.value(QStringLiteral("blockrange"));
+        QString width = row.value(QStringLiteral("blockwidth"));
+
+        block = QSharedPointer<AddressBlock>(new AddressBlock(row.value(QStringLiteral("addressblock")),
+            baseAddress.isEmpty() ? QStringLiteral("0") : baseAddress));
+        block->setRange(range.isEmpty() ? DEFAULT_BLOCK_RANGE : range);
+        block->setWidth(width.isEmpty() ? DEFAULT_BLOCK_WIDTH : width);
+
+        containingMap->getMemoryBlocks()->append(block);
+        blocks_.insert(key, block);
+    }
+
+    return block;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::findOrCreateRegister()
+//-----------------------------------------------------------------------------
+QSharedPointer<Register> RegisterMapImporter::findOrCreateRegister(QSharedPointer<AddressBlock> containingBlock,
+    QString const& key, Row const& row, int line)
+{
+    QSharedPointer<Register> targetRegister = registers_.value(key);
+    if (targetRegister)
+    {
+        QString const offset = row.value(QStringLiteral("registeroffset"));
+        if (offset.isEmpty() == false && offset != targetRegister->getAddressOffset())
+        {
+            addError(line, QStringLiteral("Register %1 already has the offset %2.").arg(
+                targetRegister->name(), targetRegister->getAddressOffset()));
+            return QSharedPointer<Register>();
+        }
+
+        return targetRegister;
+    }
+
+    QString size = row.value(QStringLiteral("registersize"));
+
+    targetRegister = QSharedPointer<Register>(new Register(row.value(QStringLiteral("register")),
+        row.value(QStringLiteral("registeroffset")), size.isEmpty() ? DEFAULT_REGISTER_SIZE : size));
+    targetRegister->setDescription(row.value(QStringLiteral("registerdescription")));
+
+    containingBlock->getRegisterData()->append(targetRegister);
+    registers_.insert(key, targetRegister);
+
+    return targetRegister;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::indexComponent()
+//-----------------------------------------------------------------------------
+void RegisterMapImporter::indexComponent()
+{
+    for (QSharedPointer<MemoryMap> memoryMap : *component_->getMemoryMaps())
+    {
+        maps_.insert(memoryMap->name(), memoryMap);
+
+        for (QSharedPointer<MemoryBlockBase> blockItem : *memoryMap->getMemoryBlocks())
+        {
+            QSharedPointer<AddressBlock> block = blockItem.dynamicCast<AddressBlock>();
+            if (block.isNull())
+            {
+                continue;
+            }
+
+            QString const blockKey = memoryMap->name() + KEY_SEPARATOR + block->name();
+            blocks_.insert(blockKey, block);
+
+            for (QSharedPointer<RegisterBase> registerItem : *block->getRegisterData())
+            {
+                QSharedPointer<Register> blockRegister = registerItem.dynamicCast<Register>();
+                if (blockRegister.isNull())
+                {
+                    continue;
+                }
+
+                QString const registerKey = blockKey + KEY_SEPARATOR + blockRegister->name();
+                registers_.insert(registerKey, blockRegister);
+
+                for (QSharedPointer<Field> field : *blockRegister->getFields())
+                {
+                    fields_.insert(registerKey + KEY_SEPARATOR + field->name());
+                }
+            }
+        }
+    }
+
+    indexed_ = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterMapImporter::addError()
+//-----------------------------------------------------------------------------
+void RegisterMapImporter::addError(int line, QString const& message)
+{
+    errors_.append(RowError{ line, message });
+}
@@ -39,7 +39,10 @@ parentObject_(parentObject),
 componentDesign_(componentDesign),
 componentDesignConfig_(componentDesignConfig),
 operatedInterfaces_(),
-saveOptions_()
+saveOptions_(),
+shareRegisterLayouts_(false),
+registerLayouts_(),
+usedLayoutNames_()
 {
 
 }
@@ -113,6 +116,8 @@ void GlobalMemoryMapHeaderWriter::writeMemoryMapHeader(QSharedPointer<Component>
 
         writeTopOfHeaderFile(stream, headerOpt->fileInfo_.fileName(), headerGuard, description);
 
+        shareRegisterLayouts_ = headerOpt->shareRegisterLayouts_;
+
 		QSharedPointer<ActiveInterface> cpuMasterInterface(new ActiveInterface(headerOpt->instance_, 
             headerOpt->interface_));
 		operatedInterfaces_.append(cpuMasterInterface);
@@ -135,6 +140,8 @@ void GlobalMemoryMapHeaderWriter::writeMemoryMapHeader(QSharedPointer<Component>
 		// the list must be cleared when moving to completely new master interface so each header generation
         // starts from scratch.
 		operatedInterfaces_.clear();
+        registerLayouts_.clear();
+        usedLayoutNames_.clear();
 	}
 
 	if (changed)
@@ -260,7 +267,14 @@ void GlobalMemoryMapHeaderWriter::parseSlaveInterface(qint64 offset, QSharedPoin
         if (memMap->uniqueRegisterNames(regNames))
         {*/
 
-        writeRegisterFromMemoryMap(finder, memMap, stream, false, offset, interface->getComponentReference());
+        if (shareRegisterLayouts_)
+        {
+            writeSharedRegisterLayout(finder, component, memMap, stream, offset, interface);
+        }
+        else
+        {
+            writeRegisterFromMemoryMap(finder, memMap, stream, false, offset, interface->getComponentReference());
+        }
         
         /*}
         else
@@ -292,6 +306,87 @@ void GlobalMemoryMapHeaderWriter::parseSlaveInterface(qint64 offset, QSharedPoin
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: GlobalMemoryMapHeaderWriter::writeSharedRegisterLayout()
+//-----------------------------------------------------------------------------
+void GlobalMemoryMapHeaderWriter::writeSharedRegisterLayout(QSharedPointer<ListParameterFinder> finder,
+    QSharedPointer<Component> component, QSharedPointer<MemoryMap> memMap, QTextStream& stream, quint64 offset,
+    QSharedPointer<ActiveInterface> interface)
+{
+    QString signature = getRegisterLayoutSignature(component, memMap,
+        getInstanceID(interface->getComponentReference()));
+
+    if (!registerLayouts_.contains(signature))
+    {
+        // Differently configured instances of the same component get their own numbered layouts.
+        QString baseName = component->getVlnv().getName().toUpper() + "_" + memMap->name().toUpper();
+        QString uniqueName = baseName;
+
+        int suffix = 1;
+        while (usedLayoutNames_.contains(uniqueName))
+        {
+            uniqueName = baseName + "_" + QString::number(suffix);
+            ++suffix;
+        }
+
+        // The layout is written relative to the instance base address so that it can be shared.
+        QString layout;
+        QTextStream layoutStream(&layout);
+        writeRegisterFromMemoryMap(finder, memMap, layoutStream, false, 0, uniqueName);
+        layoutStream.flush();
+
+        if (layout.isEmpty())
+        {
+            uniqueName.clear();
+        }
+        else
+        {
+            stream << "/*" << Qt::endl;
+            stream << " * Register layout: " << uniqueName << Qt::endl;
+            stream << " * Register offsets are relative to the instance base address." << Qt::endl;
+            stream << "*/" << Qt::endl;
+            stream << layout;
+        }
+
+        registerLayouts_.insert(signature, uniqueName);
+        usedLayoutNames_.insert(uniqueName);
+    }
+
+    QString layoutName = registerLayouts_.value(signature);
+    if (layoutName.isEmpty())
+    {
+        return;
+    }
+
+    QString instanceName = interface->getComponentReference().toUpper();
+
+    stream << "/*" << Qt::endl;
+    stream << " * Registers of instance " << interface->getComponentReference() << " use the register layout " <<
+        layoutName << "." << Qt::endl;
+    stream << "*/" << Qt::endl;
+    stream << "#define " << instanceName << "_BASE 0x" << QString::number(offset, 16) << Qt::endl;
+    stream << "#define " << instanceName << "_REGISTER(name) (" << instanceName << "_BASE + " << layoutName <<
+        "_##name)" << Qt::endl;
+    stream << Qt::endl;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GlobalMemoryMapHeaderWriter::getRegisterLayoutSignature()
+//-----------------------------------------------------------------------------
+QString GlobalMemoryMapHeaderWriter::getRegisterLayoutSignature(QSharedPointer<Component> component,
+    QSharedPointer<MemoryMap> memMap, QString const& instanceID) const
+{
+    QStringList signature({ component->getVlnv().toString(), memMap->name() });
+
+    QMap<QString, QString> configurableElements = getConfigurableElementsFromInstance(instanceID);
+    for (auto i = configurableElements.cbegin(); i != configurableElements.cend(); ++i)
+    {
+        signature.append(i.key() + "=" + i.value());
+    }
+
+    return signature.join(QLatin1Char('\n'));
+}
+
 //-----------------------------------------------------------------------------
 // Function: GlobalMemoryMapHeaderWriter::parseMirroredSlaveInterface()
 //-----------------------------------------------------------------------------
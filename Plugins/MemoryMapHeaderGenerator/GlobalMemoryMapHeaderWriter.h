@@ -24,7 +24,9 @@
 
 #include <IPXACTmodels/DesignConfiguration/DesignConfiguration.h>
 
+#include <QHash>
 #include <QObject>
+#include <QSet>
 #include <QSharedPointer>
 #include <QString>
 #include <QFileInfo>
@@ -174,6 +176,33 @@ private:
      *    @return A list of interfaces connected to the selected interface.
      */
     QList<QSharedPointer<ActiveInterface> > getConnectedInterfaces(QSharedPointer<ActiveInterface> interface);
+
+    /*!
+     *  Write the registers of an instance using a register layout shared by all instances with the same
+     *  component and configurable element values. The layout is written only for the first such instance.
+     *
+     *    @param [in] finder      The parameter finder of the instance.
+     *    @param [in] component   The component of the instance.
+     *    @param [in] memMap      The memory map containing the registers.
+     *    @param [in] stream      The text stream to write into.
+     *    @param [in] offset      The base address of the instance.
+     *    @param [in] interface   The interface of the instance.
+     */
+    void writeSharedRegisterLayout(QSharedPointer<ListParameterFinder> finder, QSharedPointer<Component> component,
+        QSharedPointer<MemoryMap> memMap, QTextStream& stream, quint64 offset,
+        QSharedPointer<ActiveInterface> interface);
+
+    /*!
+     *  Get the signature identifying the register layout of a memory map in an instance.
+     *
+     *    @param [in] component   The component of the instance.
+     *    @param [in] memMap      The memory map of the instance.
+     *    @param [in] instanceID  The uuid of the instance.
+     *
+     *    @return The VLNV, memory map name and configurable element values of the instance combined.
+     */
+    QString getRegisterLayoutSignature(QSharedPointer<Component> component, QSharedPointer<MemoryMap> memMap,
+        QString const& instanceID) const;
     
     //-----------------------------------------------------------------------------
     // Data.
@@ -193,6 +222,15 @@ private:
 
     //! A list of save options for the writer.
     QList<GlobalHeaderSaveModel::SaveFileOptions*> saveOptions_;
+
+    //! If true, instances with the same component configuration share one register layout definition.
+    bool shareRegisterLayouts_;
+
+    //! The names of the register layouts written in the current header, keyed by layout signature.
+    QHash<QString, QString> registerLayouts_;
+
+    //! The names given to the register layouts written in the current header.
+    QSet<QString> usedLayoutNames_;
 };
 
 #endif // GLOBALMEMORYMAPHEADERWRITER_H
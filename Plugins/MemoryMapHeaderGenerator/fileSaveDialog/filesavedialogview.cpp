@@ -49,9 +49,10 @@ void FileSaveDialogView::mouseDoubleClickEvent( QMouseEvent* event ) {
 	pressedPoint_ = event->pos();
 	QTableView::mouseDoubleClickEvent(event);
 
-	// if the item is valid but not editable then double click works
+	// if the item is valid but not editable or checkable then double click works
 	QModelIndex selectedIndex = indexAt(pressedPoint_);
-	if (selectedIndex.isValid() && (selectedIndex.model()->flags(selectedIndex) & Qt::ItemIsEditable) == 0) {
+	if (selectedIndex.isValid() &&
+		(selectedIndex.model()->flags(selectedIndex) & (Qt::ItemIsEditable | Qt::ItemIsUserCheckable)) == 0) {
 		onChange();
 	}
 
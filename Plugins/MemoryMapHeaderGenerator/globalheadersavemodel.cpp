@@ -15,8 +15,15 @@
 #include <IPXACTmodels/Design/ComponentInstance.h>
 
 #include <QDir>
+#include <QSettings>
 #include <QStringList>
 
+namespace
+{
+    //! The settings key for remembering the selection of shared register layouts.
+    const QString SHARE_REGISTER_LAYOUTS_SETTING = QStringLiteral("MemoryMapHeaderGenerator/ShareRegisterLayouts");
+}
+
 //-----------------------------------------------------------------------------
 // Function: globalheadersavemodel::GlobalHeaderSaveModel()
 //-----------------------------------------------------------------------------
@@ -75,6 +82,11 @@ Qt::ItemFlags GlobalHeaderSaveModel::flags( const QModelIndex& index ) const
 		return Qt::NoItemFlags;
 	}
 
+    if (index.column() == GlobalHeaderSaveModel::SHARE_REGISTER_LAYOUTS)
+    {
+        return Qt::ItemIsEnabled | Qt::ItemIsSelectable | Qt::ItemIsUserCheckable;
+    }
+
 	return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
 }
 
@@ -97,6 +109,10 @@ QVariant GlobalHeaderSaveModel::headerData( int section, Qt::Orientation orienta
         {
             return tr("Interface\nname");
         }
+        else if (section == GlobalHeaderSaveModel::SHARE_REGISTER_LAYOUTS)
+        {
+            return tr("Shared register\nlayouts");
+        }
         else if (section == GlobalHeaderSaveModel::FILE_NAME)
         {
             return tr("File name");
@@ -175,6 +191,20 @@ QVariant GlobalHeaderSaveModel::data( const QModelIndex& index, int role) const
 			return handler_->getDirectoryPath(comp_->getVlnv());
 		}		
 	}
+    else if (Qt::CheckStateRole == role && index.column() == GlobalHeaderSaveModel::SHARE_REGISTER_LAYOUTS)
+    {
+        if (table_.at(index.row())->shareRegisterLayouts_)
+        {
+            return Qt::Checked;
+        }
+
+        return Qt::Unchecked;
+    }
+    else if (Qt::ToolTipRole == role && index.column() == GlobalHeaderSaveModel::SHARE_REGISTER_LAYOUTS)
+    {
+        return tr("Write the registers once for each component configuration and address them relative to "
+            "the instance base addresses.");
+    }
 	else
     {
 		return QVariant();
@@ -226,6 +256,17 @@ bool GlobalHeaderSaveModel::setData( const QModelIndex& index, const QVariant& v
             return false;
         }
 	}
+    else if (Qt::CheckStateRole == role && index.column() == GlobalHeaderSaveModel::SHARE_REGISTER_LAYOUTS)
+    {
+        bool shareRegisterLayouts = value.toInt() == Qt::Checked;
+        table_[index.row()]->shareRegisterLayouts_ = shareRegisterLayouts;
+
+        // The latest selection is the default for the next generation.
+        QSettings().setValue(SHARE_REGISTER_LAYOUTS_SETTING, shareRegisterLayouts);
+
+        emit dataChanged(index, index);
+        return true;
+    }
 	else if (Qt::UserRole == role)
     {
 		table_[index.row()]->fileInfo_.setFile(value.toString());
@@ -267,6 +308,8 @@ void GlobalHeaderSaveModel::setDesign( QSharedPointer<Component> topComp, QShare
 	qDeleteAll(table_);
 	table_.clear();
 
+    const bool shareRegisterLayouts = QSettings().value(SHARE_REGISTER_LAYOUTS_SETTING, false).toBool();
+
 	foreach (QSharedPointer<ComponentInstance> instance, *design_->getComponentInstances())
     {
 		// parse the component model for the instance
@@ -296,6 +339,7 @@ void GlobalHeaderSaveModel::setDesign( QSharedPointer<Component> topComp, QShare
 			options->interface_ = interfaceName;
 			options->comp_ = compVLNV;
 			options->instanceId_ = instance->getUuid();
+            options->shareRegisterLayouts_ = shareRegisterLayouts;
 
 			// the path to the directory containing the xml metadata
 			QString compPath(handler_->getDirectoryPath(topComp->getVlnv()));
@@ -50,6 +50,9 @@ public:
 
 		//! Contains the path for the header file to be saved.
 		QFileInfo fileInfo_;
+
+		//! If true, instances of the same component configuration share one register layout definition.
+		bool shareRegisterLayouts_ = false;
 	};
 
 	//! The column numbers for the table.
@@ -57,6 +60,7 @@ public:
     {
 		INSTANCE_NAME = 0,
 		INTERFACE_NAME,
+		SHARE_REGISTER_LAYOUTS,
 		FILE_NAME,
 		FILE_PATH,
 		COLUMN_COUNT
@@ -214,7 +214,8 @@ void MemoryMapHeaderGenerator::setLocalSaveFileOptions(QSharedPointer<MemoryMap>
 // Function: memorymapheadergenerator::setGlobalSaveFileOptions()
 //-----------------------------------------------------------------------------
 void MemoryMapHeaderGenerator::setGlobalSaveFileOptions(QSharedPointer<Component> component,
-    QString const& instanceName, QString const& instanceId, QString const& masterInterfaceName, QFileInfo fileInfo)
+    QString const& instanceName, QString const& instanceId, QString const& masterInterfaceName, QFileInfo fileInfo,
+    bool shareRegisterLayouts)
 {
     GlobalHeaderSaveModel::SaveFileOptions* newSaveOptions (new GlobalHeaderSaveModel::SaveFileOptions);
     newSaveOptions->comp_ = component->getVlnv();
@@ -222,6 +223,7 @@ void MemoryMapHeaderGenerator::setGlobalSaveFileOptions(QSharedPointer<Component
     newSaveOptions->instanceId_ = instanceId;
     newSaveOptions->interface_ = masterInterfaceName;
     newSaveOptions->fileInfo_ = fileInfo;
+    newSaveOptions->shareRegisterLayouts_ = shareRegisterLayouts;
 
     globalSaveOptions_.clear();
     globalSaveOptions_.append(newSaveOptions);
@@ -166,9 +166,12 @@ public:
       *    @param [in] instanceId             The id of the instance.
       *    @param [in] masterInterfaceName    The name of the master interface to create the header for.
       *    @param [in] fileInfo               The file information for the header file.
+      *    @param [in] shareRegisterLayouts   If true, instances of the same component configuration share
+      *                                       one register layout definition.
       */
      void setGlobalSaveFileOptions(QSharedPointer<Component> component, QString const& instanceName,
-         QString const& instanceId, QString const& masterInterfaceName, QFileInfo fileInfo);
+         QString const& instanceId, QString const& masterInterfaceName, QFileInfo fileInfo,
+         bool shareRegisterLayouts = false);
 
      /*!
       *  Set the save options for a system design writer.
@@ -5,7 +5,7 @@
 TEMPLATE = lib
 TARGET = MemoryViewGenerator
 
-QT += core xml widgets gui
+QT += core xml widgets gui concurrent
 CONFIG += c++11 plugin release
 
 DEFINES += MEMORYVIEWGENERATOR_LIB
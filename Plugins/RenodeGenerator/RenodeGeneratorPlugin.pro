@@ -5,7 +5,7 @@
 TEMPLATE = lib
 TARGET = RenodeGeneratorPlugin
 
-QT += core xml widgets gui
+QT += core xml widgets gui concurrent
 CONFIG += plugin release c++17
 DEFINES += QT_DLL QT_XML_LIB RENODEGENERATORPLUGIN_LIB QT_WIDGETS_LIB
 
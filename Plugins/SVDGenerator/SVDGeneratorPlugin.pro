@@ -5,7 +5,7 @@
 TEMPLATE = lib
 TARGET = SVDGeneratorPlugin
 
-QT += core xml widgets gui
+QT += core xml widgets gui concurrent
 CONFIG += c++11 release
 DEFINES += SVDGENERATORPLUGIN_LIB
 
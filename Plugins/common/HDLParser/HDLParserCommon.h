@@ -15,6 +15,7 @@
 #include <QSharedPointer>
 #include <QString>
 
+#include <QHash>
 #include <QMap>
 #include <QMultiMap>
 
@@ -28,6 +29,7 @@ class Design;
 class DesignConfiguration;
 class MessageMediator;
 class Port;
+class PortAbstraction;
 class RemapState;
 class View;
 
@@ -136,6 +138,8 @@ struct MetaInterface
     QSharedPointer<AbstractionDefinition> absDef_;
     //! The parsed ports of the component keyed with its physical name.
     QMap<QString, QSharedPointer<MetaPort> > ports_;
+    //! The logical ports of the abstraction definition keyed with their logical name.
+    QHash<QString, QSharedPointer<PortAbstraction> > logicalPorts_;
     //! The interconnection attached to the interface go upper level in hierarchy.
     QSharedPointer<MetaInterconnection> upInterconnection_;
     //! The interconnection attached to the interface go lower level in hierarchy.
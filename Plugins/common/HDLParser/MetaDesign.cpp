@@ -30,7 +30,9 @@
 #include <KactusAPI/include/MultipleParameterFinder.h>
 #include <KactusAPI/include/ComponentParameterFinder.h>
 
+#include <QSet>
 #include <QVector>
+#include <QtConcurrent/QtConcurrentMap>
 
 //-----------------------------------------------------------------------------
 // Function: MetaDesign::MetaDesign()
@@ -294,40 +296,62 @@ void MetaDesign::parseParameters(QSharedPointer<QList<QSharedPointer<Parameter>
 // Function: MetaDesign::parseInstances()
 //-----------------------------------------------------------------------------
 void MetaDesign::parseInstances()
-{    
+{
+    // Abstraction definitions of the interfaces are fetched from the library, which is not thread-safe.
     for (QSharedPointer<MetaInstance> mInstance : *instances_)
     {
-        // Parse parameters of the instance, which may be overridden by
-        // component instance CEVs, which may point to the design parameters.
-        parseParameters(mInstance->getParameters(), parameters_,
-            mInstance->getComponentInstance()->getConfigurableElementValues());
-
-        // Module parameters may refer to the component parameters.
-        QSharedPointer<QList<QSharedPointer<Parameter> > > topList(new QList<QSharedPointer<Parameter> >);
-      
-        topList->append(*mInstance->getParameters());
-        
-        QSharedPointer<QList<QSharedPointer<ConfigurableElementValue> > > cevs;
-
-        // Design configuration may have CEVs pointing to module parameters.
-        if (designConf_)
+        mInstance->parseInterfaces();
+    }
+
+    // The instances do not share any data to be modified, so they can be formatted concurrently.
+    QList<QSharedPointer<MetaInstance> > instanceList = instances_->values();
+    QtConcurrent::blockingMap(instanceList, [this](QSharedPointer<MetaInstance> const& mInstance)
         {
-            QSharedPointer<ViewConfiguration> viewConfig = designConf_->getViewConfiguration(
-                mInstance->getComponentInstance()->getInstanceName());
+            formatInstance(mInstance);
+        });
 
-            if (viewConfig)
-            {
-                // TODO: Use view configuration CEVs.
-                //cevs = viewConfig->getViewConfigurableElements();
-            }
-        }
+    // Report the errors in the instance order, as if the instances were formatted sequentially.
+    for (QSharedPointer<MetaInstance> mInstance : instanceList)
+    {
+        mInstance->showDeferredErrors();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MetaDesign::formatInstance()
+//-----------------------------------------------------------------------------
+void MetaDesign::formatInstance(QSharedPointer<MetaInstance> mInstance) const
+{
+    // Parse parameters of the instance, which may be overridden by
+    // component instance CEVs, which may point to the design parameters.
+    parseParameters(mInstance->getParameters(), parameters_,
+        mInstance->getComponentInstance()->getConfigurableElementValues());
+
+    // Module parameters may refer to the component parameters.
+    QSharedPointer<QList<QSharedPointer<Parameter> > > topList(new QList<QSharedPointer<Parameter> >);
+  
+    topList->append(*mInstance->getParameters());
+    
+    QSharedPointer<QList<QSharedPointer<ConfigurableElementValue> > > cevs;
 
-        // Parse module parameters of the instance, TODO: which may be overridden by view configuration CEVS,
-        // which may point to the design configuration parameters.
-        parseParameters(mInstance->getModuleParameters(), topList, cevs);
+    // Design configuration may have CEVs pointing to module parameters.
+    if (designConf_)
+    {
+        QSharedPointer<ViewConfiguration> viewConfig = designConf_->getViewConfiguration(
+            mInstance->getComponentInstance()->getInstanceName());
 
-        mInstance->parseInstance();
+        if (viewConfig)
+        {
+            // TODO: Use view configuration CEVs.
+            //cevs = viewConfig->getViewConfigurableElements();
+        }
     }
+
+    // Parse module parameters of the instance, TODO: which may be overridden by view configuration CEVS,
+    // which may point to the design configuration parameters.
+    parseParameters(mInstance->getModuleParameters(), topList, cevs);
+
+    mInstance->formatInstance();
 }
 
 //-----------------------------------------------------------------------------
@@ -460,20 +484,21 @@ void MetaDesign::wireInterfacePorts(QSharedPointer<MetaInterface> mInterface,
     // Associate the port assignments with the wires of the interconnect.
     for (QSharedPointer<MetaPort> mPort : mInterface->ports_)
     {
-        for (QSharedPointer<PortAbstraction> pAbs : *mInterface->absDef_->getLogicalPorts())
-        {
-            // ...get all port assignments in the interface utilizing its logical port...
-            QList<QSharedPointer<MetaPortAssignment> > assignments;
+        QMultiMap<QString, QSharedPointer<MetaPortAssignment> > const& portAssignments =
+            isHierarchical ? mPort->downAssignments_ : mPort->upAssignments_;
 
-            if (isHierarchical)
-            {
-                assignments = mPort->downAssignments_.values(pAbs->getLogicalName());
-            }
-            else
+        // Only the logical ports with assignments in the port need to be checked.
+        for (QString const& logicalName : portAssignments.uniqueKeys())
+        {
+            QSharedPointer<PortAbstraction> pAbs = mInterface->logicalPorts_.value(logicalName);
+            if (!pAbs)
             {
-                assignments = mPort->upAssignments_.values(pAbs->getLogicalName());
+                continue;
             }
 
+            // ...get all port assignments in the interface utilizing its logical port...
+            QList<QSharedPointer<MetaPortAssignment> > assignments = portAssignments.values(logicalName);
+
             QList<QSharedPointer<MetaWire> > connectedWires;
             QList<QSharedPointer<MetaTransactional> > connectedTransactionals;
 
@@ -813,32 +838,35 @@ void MetaDesign::removeUnconnectedInterfaceAssignments()
         }
     }
 
-    for (QSharedPointer<MetaInterface> mInterface : *topInstance_->getInterfaces())
+    // The down assignments exist only for the hierarchical interfaces, so nothing to remove without them.
+    if (topInstance_->getInterfaces()->isEmpty())
+    {
+        return;
+    }
+
+    for (QSharedPointer<MetaPort> mPort : *topInstance_->getPorts())
     {
-        for (QSharedPointer<MetaPort> mPort : *topInstance_->getPorts())
+        bool connected = false;
+        for (QSharedPointer<MetaPortAssignment> assignment : mPort->downAssignments_)
         {
-            bool connected = false;
-            for (QSharedPointer<MetaPortAssignment> assignment : mPort->downAssignments_)
+            if ((mPort->isWire_ && assignment->wire_ && assignment->wire_->refCount >= 2) ||
+                (mPort->isTransactional_ && assignment->transactional_ &&
+                    assignment->transactional_->refCount_ >= 2))
             {
-                if ((mPort->isWire_ && assignment->wire_ && assignment->wire_->refCount >= 2) ||
-                    (mPort->isTransactional_ && assignment->transactional_ &&
-                        assignment->transactional_->refCount_ >= 2))
-                {
-                    connected = true;
-                }
+                connected = true;
             }
+        }
 
-            // Don't remove down assignment if port has tied value.
-            bool hasTiedValue = std::any_of(mPort->downAssignments_.cbegin(), mPort->downAssignments_.cend(),
-                [](QSharedPointer<MetaPortAssignment> assignment)
-                {
-                    return !assignment->defaultValue_.isEmpty();
-                });
-
-            if (connected == false && hasTiedValue == false)
+        // Don't remove down assignment if port has tied value.
+        bool hasTiedValue = std::any_of(mPort->downAssignments_.cbegin(), mPort->downAssignments_.cend(),
+            [](QSharedPointer<MetaPortAssignment> assignment)
             {
-                mPort->downAssignments_.clear();
-            }
+                return !assignment->defaultValue_.isEmpty();
+            });
+
+        if (connected == false && hasTiedValue == false)
+        {
+            mPort->downAssignments_.clear();
         }
     }
 }
@@ -848,6 +876,8 @@ void MetaDesign::removeUnconnectedInterfaceAssignments()
 //-----------------------------------------------------------------------------
 void MetaDesign::removeUnconnectedAdHocAssignments()
 {
+    QSet<QSharedPointer<MetaWire> > adHocWires(adHocWires_->cbegin(), adHocWires_->cend());
+
     for (QSharedPointer<MetaInstance> mInstance : *instances_)
     {
         // Go through its ports.
@@ -859,7 +889,7 @@ void MetaDesign::removeUnconnectedAdHocAssignments()
             while (iter != end)
             {
                 QSharedPointer<MetaPortAssignment> assignment = *iter;
-                bool isAdHocWire = getAdHocWires()->contains(assignment->wire_);
+                bool isAdHocWire = adHocWires.contains(assignment->wire_);
 
                 // Wire does not have at least two users -> remove.
                 if (assignment->wire_ && assignment->wire_->refCount < 2)
@@ -890,7 +920,7 @@ void MetaDesign::removeUnconnectedAdHocAssignments()
         while (iter != end)
         {
             QSharedPointer<MetaPortAssignment> assignment = *iter;
-            bool isAdHocWire = getAdHocWires()->contains(assignment->wire_);
+            bool isAdHocWire = adHocWires.contains(assignment->wire_);
 
             // Wire does not have at least two users -> remove. Applies only to the ad hoc wires.
             if (assignment->wire_ && assignment->wire_->refCount < 2)
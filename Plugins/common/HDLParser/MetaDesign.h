@@ -115,6 +115,14 @@ private:
      */
     void parseInstances();
 
+    /*!
+     *  Parses the parameters, ports and port assignments of a single instance.
+     *  Does not access the library, so it may be called concurrently for different instances.
+     *
+     *    @param [in] mInstance   The instance to format.
+     */
+    void formatInstance(QSharedPointer<MetaInstance> mInstance) const;
+
     /*!
      *  Parses interconnections in the design_.
      */
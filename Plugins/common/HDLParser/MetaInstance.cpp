@@ -40,6 +40,16 @@ MetaComponent(messages, component, activeView),
 // Function:  MetaInstance::parseInstance()
 //-----------------------------------------------------------------------------
 void MetaInstance::parseInstance()
+{
+    parseInterfaces();
+    formatInstance();
+    showDeferredErrors();
+}
+
+//-----------------------------------------------------------------------------
+// Function:  MetaInstance::formatInstance()
+//-----------------------------------------------------------------------------
+void MetaInstance::formatInstance()
 {
     // Initialize the parameter parsing: Find parameters from both the instance and the top component.
     QSharedPointer<QList<QSharedPointer<Parameter> > > ilist(getParameters());
@@ -49,14 +59,26 @@ void MetaInstance::parseInstance()
     // Create parser using the applicable finders.
     IPXactSystemVerilogParser instanceParser(instanceFinder);
 
-    // Parse the interfaces and ports.
-    parseInterfaces();
+    // Parse the ports.
     parsePorts(instanceParser);
     parsePortAssignments(instanceParser);
 
     parseMetaParameters(); 
 }
 
+//-----------------------------------------------------------------------------
+// Function:  MetaInstance::showDeferredErrors()
+//-----------------------------------------------------------------------------
+void MetaInstance::showDeferredErrors()
+{
+    for (QString const& error : deferredErrors_)
+    {
+        messages_->showError(error);
+    }
+
+    deferredErrors_.clear();
+}
+
 //-----------------------------------------------------------------------------
 // Function: MetaInstance::parseExpression()
 //-----------------------------------------------------------------------------
@@ -121,6 +143,15 @@ void MetaInstance::parseInterfaces()
         mInterface->absType_ = absType;
         mInterface->absDef_ = absDef;
 
+        // Index the logical ports for lookups by name. The first port with a given name is used.
+        for (QSharedPointer<PortAbstraction> portAbstraction : *absDef->getLogicalPorts())
+        {
+            if (mInterface->logicalPorts_.contains(portAbstraction->getLogicalName()) == false)
+            {
+                mInterface->logicalPorts_.insert(portAbstraction->getLogicalName(), portAbstraction);
+            }
+        }
+
         // Insert to the interface to the list.
         interfaces_->insert(busInterface->name(), mInterface);
     }
@@ -180,11 +211,12 @@ void MetaInstance::parsePortAssignments(IPXactSystemVerilogParser const& parser)
             QSharedPointer<MetaPort> mPort = getPorts()->value(pMap->getPhysicalPort()->name_);
 
             // The abstraction definition must have a port abstraction with the same name.
-            QSharedPointer<PortAbstraction> portAbstraction = mInterface->absDef_->getPort(pMap->getLogicalPort()->name_);
+            QSharedPointer<PortAbstraction> portAbstraction =
+                mInterface->logicalPorts_.value(pMap->getLogicalPort()->name_);
 
             if (!portAbstraction)
             {
-                messages_->showError(QObject::tr("Component %1, Bus interface %2: Port abstraction"
+                deferredErrors_.append(QObject::tr("Component %1, Bus interface %2: Port abstraction"
                     " was not found for logical port %3 at abstraction definition %4.")
                     .arg(getComponent()->getVlnv().toString(),
                     mInterface->interface_->name(),
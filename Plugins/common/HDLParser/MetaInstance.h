@@ -57,6 +57,23 @@ public:
      */
     void parseInstance();
 
+    /*!
+     *  Parses the interfaces of the component instance using the abstraction definitions in the library.
+     */
+    void parseInterfaces();
+
+    /*!
+     *  Parses the ports and port assignments of the instance. The interfaces must be parsed beforehand.
+     *  Errors are not shown immediately, but collected until showDeferredErrors() is called.
+     *  Does not access the library, so different instances may be formatted concurrently.
+     */
+    void formatInstance();
+
+    /*!
+     *  Shows the errors collected while formatting the instance and clears them.
+     */
+    void showDeferredErrors();
+
     /*!
     *   Parses the expression using the parser and returns the result.
     */
@@ -74,11 +91,6 @@ public:
 
 private:
     
-    /*!
-     *  Parse the interfaces of the component instance.
-     */
-    void parseInterfaces();
-    
     /*!
      *  Culls and parses the ports of the component.
      *
@@ -127,6 +139,9 @@ private:
 
     //! The parsed interfaces of the instance, keyed with its name.
     QSharedPointer<QMap<QString, QSharedPointer<MetaInterface> > > interfaces_;
+
+    //! The errors found while formatting the instance, waiting to be shown.
+    QStringList deferredErrors_;
 };
 
 #endif // METAINSTANCE_H
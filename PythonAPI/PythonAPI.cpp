@@ -31,6 +31,7 @@
 #include <KactusAPI/include/FileSetInterface.h>
 #include <KactusAPI/include/FileInterface.h>
 #include <KactusAPI/include/FileBuilderInterface.h>
+#include <KactusAPI/include/RegisterMapImporter.h>
 
 #include <IPXACTmodels/common/ConfigurableVLNVReference.h>
 #include <IPXACTmodels/common/validators/ParameterValidator.h>
@@ -62,6 +63,29 @@
 
 #include <IPXACTmodels/DesignConfiguration/DesignConfiguration.h>
 
+#include <QHash>
+#include <QSet>
+
+namespace
+{
+    /*!
+     *  Get the monitored interface mode of a bus interface.
+     *
+     *    @param [in] busInterface    The selected bus interface.
+     *
+     *    @return The monitored interface mode, or INTERFACE_MODE_COUNT if the interface is not a monitor.
+     */
+    General::InterfaceMode monitorMode(QSharedPointer<BusInterface> busInterface)
+    {
+        if (QSharedPointer<BusInterface::MonitorInterface> monitor = busInterface->getMonitor(); monitor)
+        {
+            return monitor->interfaceMode_;
+        }
+
+        return General::INTERFACE_MODE_COUNT;
+    }
+};
+
 //-----------------------------------------------------------------------------
 // Function: PythonAPI::PythonAPI()
 //-----------------------------------------------------------------------------
@@ -445,7 +469,7 @@ bool PythonAPI::openComponent(std::string const& vlnvString)
             busInterface_->setBusInterfaces(component);
 
             activeComponent_ = component;
-            messager_->showMessage(QString("Component %1 is open").arg(componentVLNV));
+            showStatus(QString("Component %1 is open").arg(componentVLNV));
             return true;
         }
         else
@@ -484,7 +508,7 @@ void PythonAPI::closeOpenComponent()
 {
     if (activeComponent_)
     {
-        messager_->showMessage(QString("Component %1 is closed").arg(activeComponent_->getVlnv().toString()));
+        showStatus(QString("Component %1 is closed").arg(activeComponent_->getVlnv().toString()));
     }
 
     activeComponent_ = QSharedPointer<Component>();
@@ -893,6 +917,201 @@ void PythonAPI::setFileBuildersForInterface(std::string const& setName)
     builderInterface->setFileBuilders(containingFileSet->getDefaultFileBuilders());
 }
 
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::setPortValues()
+//-----------------------------------------------------------------------------
+int PythonAPI::setPortValues(std::string const& attribute, std::vector<std::string> const& portNames,
+    std::vector<std::string> const& values)
+{
+    PortsInterface* ports = portsInterface_;
+
+    std::map<std::string, ItemSetter> const setters = {
+        { "description",
+            [ports](auto const& name, auto const& value) { return ports->setDescription(name, value); } },
+        { "displayName",
+            [ports](auto const& name, auto const& value) { return ports->setDisplayName(name, value); } },
+        { "typeName",
+            [ports](auto const& name, auto const& value) { return ports->setTypeName(name, value); } },
+        { "arrayLeft",
+            [ports](auto const& name, auto const& value) { return ports->setArrayLeft(name, value); } },
+        { "arrayRight",
+            [ports](auto const& name, auto const& value) { return ports->setArrayRight(name, value); } },
+        { "tags",
+            [ports](auto const& name, auto const& value) { return ports->setTags(name, value); } },
+        { "direction",
+            [ports](auto const& name, auto const& value) { return ports->setDirection(name, value); } },
+        { "leftBound",
+            [ports](auto const& name, auto const& value) { return ports->setLeftBound(name, value); } },
+        { "rightBound",
+            [ports](auto const& name, auto const& value) { return ports->setRightBound(name, value); } },
+        { "width",
+            [ports](auto const& name, auto const& value) { return ports->setWidth(name, value); } },
+        { "defaultValue",
+            [ports](auto const& name, auto const& value) { return ports->setDefaultValue(name, value); } },
+        { "busWidth",
+            [ports](auto const& name, auto const& value) { return ports->setBusWidth(name, value); } },
+        { "initiative",
+            [ports](auto const& name, auto const& value) { return ports->setInitiative(name, value); } },
+        { "kind",
+            [ports](auto const& name, auto const& value) { return ports->setKind(name, value); } },
+        { "protocolType",
+            [ports](auto const& name, auto const& value) { return ports->setProtocolType(name, value); } },
+        { "maxConnections",
+            [ports](auto const& name, auto const& value) { return ports->setMaxConnections(name, value); } },
+        { "minConnections",
+            [ports](auto const& name, auto const& value) { return ports->setMinConnections(name, value); } }
+    };
+
+    return setItemValues(setters, QStringLiteral("port"), attribute, portNames, values);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::setRegisterValues()
+//-----------------------------------------------------------------------------
+int PythonAPI::setRegisterValues(std::string const& attribute, std::vector<std::string> const& registerNames,
+    std::vector<std::string> const& values)
+{
+    RegisterInterface* registers = mapInterface_->getAddressBlockInterface()->getSubInterface();
+
+    std::map<std::string, ItemSetter> const setters = {
+        { "description",
+            [registers](auto const& name, auto const& value) { return registers->setDescription(name, value); } },
+        { "displayName",
+            [registers](auto const& name, auto const& value) { return registers->setDisplayName(name, value); } },
+        { "offset",
+            [registers](auto const& name, auto const& value) { return registers->setOffset(name, value); } },
+        { "dimension",
+            [registers](auto const& name, auto const& value) { return registers->setDimension(name, value); } },
+        { "isPresent",
+            [registers](auto const& name, auto const& value) { return registers->setIsPresent(name, value); } },
+        { "size",
+            [registers](auto const& name, auto const& value) { return registers->setSize(name, value); } },
+        { "volatile",
+            [registers](auto const& name, auto const& value) { return registers->setVolatile(name, value); } },
+        { "access",
+            [registers](auto const& name, auto const& value) { return registers->setAccess(name, value); } }
+    };
+
+    return setItemValues(setters, QStringLiteral("register"), attribute, registerNames, values);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::setFieldValues()
+//-----------------------------------------------------------------------------
+int PythonAPI::setFieldValues(std::string const& attribute, std::vector<std::string> const& fieldNames,
+    std::vector<std::string> const& values)
+{
+    FieldInterface* fields = mapInterface_->getAddressBlockInterface()->getSubInterface()->getSubInterface();
+
+    std::map<std::string, ItemSetter> const setters = {
+        { "description",
+            [fields](auto const& name, auto const& value) { return fields->setDescription(name, value); } },
+        { "displayName",
+            [fields](auto const& name, auto const& value) { return fields->setDisplayName(name, value); } },
+        { "offset",
+            [fields](auto const& name, auto const& value) { return fields->setOffset(name, value); } },
+        { "width",
+            [fields](auto const& name, auto const& value) { return fields->setWidth(name, value); } },
+        { "volatile",
+            [fields](auto const& name, auto const& value) { return fields->setVolatile(name, value); } },
+        { "isPresent",
+            [fields](auto const& name, auto const& value) { return fields->setIsPresent(name, value); } },
+        { "access",
+            [fields](auto const& name, auto const& value) { return fields->setAccess(name, value); } },
+        { "readAction",
+            [fields](auto const& name, auto const& value) { return fields->setReadAction(name, value); } },
+        { "testable",
+            [fields](auto const& name, auto const& value) { return fields->setTestable(name, value); } },
+        { "reserved",
+            [fields](auto const& name, auto const& value) { return fields->setReserved(name, value); } },
+        { "id",
+            [fields](auto const& name, auto const& value) { return fields->setID(name, value); } }
+    };
+
+    return setItemValues(setters, QStringLiteral("field"), attribute, fieldNames, values);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::importRegisterMap()
+//-----------------------------------------------------------------------------
+int PythonAPI::importRegisterMap(std::string const& filePath)
+{
+    if (activeComponent_.isNull())
+    {
+        messager_->showError(QStringLiteral("No open component"));
+        return 0;
+    }
+
+    RegisterMapImporter importer(activeComponent_);
+    int importedRows = importer.importFile(QString::fromStdString(filePath));
+
+    QVector<RegisterMapImporter::RowError> const errors = importer.getErrors();
+    for (auto const& error : errors)
+    {
+        messager_->showError(QStringLiteral("Line %1: %2").arg(QString::number(error.line), error.message));
+    }
+
+    // The interfaces cache the memory map items by name, so they are refreshed after the import.
+    mapValidator_->componentChange(activeComponent_);
+    mapInterface_->setMemoryMaps(activeComponent_);
+
+    messager_->showMessage(QStringLiteral("Imported %1 rows with %2 errors").arg(
+        QString::number(importedRows), QString::number(errors.size())));
+    return importedRows;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::setItemValues()
+//-----------------------------------------------------------------------------
+int PythonAPI::setItemValues(std::map<std::string, ItemSetter> const& setters, QString const& itemType,
+    std::string const& attribute, std::vector<std::string> const& itemNames,
+    std::vector<std::string> const& values) const
+{
+    auto setter = setters.find(attribute);
+    if (setter == setters.cend())
+    {
+        QStringList knownAttributes;
+        for (auto const& [name, itemSetter] : setters)
+        {
+            knownAttributes.append(QString::fromStdString(name));
+        }
+
+        messager_->showError(QString("Unknown %1 attribute %2. Available attributes are %3.").arg(
+            itemType, QString::fromStdString(attribute), knownAttributes.join(QStringLiteral(", "))));
+        return 0;
+    }
+
+    if (itemNames.size() != values.size())
+    {
+        messager_->showError(QString("Got %1 %2 names but %3 values for %4.").arg(
+            QString::number(itemNames.size()), itemType, QString::number(values.size()),
+            QString::fromStdString(attribute)));
+        return 0;
+    }
+
+    int setCount = 0;
+    QStringList failedItems;
+    for (size_t i = 0; i < itemNames.size(); ++i)
+    {
+        if (setter->second(itemNames.at(i), values.at(i)))
+        {
+            ++setCount;
+        }
+        else
+        {
+            failedItems.append(QString::fromStdString(itemNames.at(i)));
+        }
+    }
+
+    if (failedItems.isEmpty() == false)
+    {
+        messager_->showError(QString("Could not set %1 of %2 %3(s): %4").arg(QString::fromStdString(attribute),
+            QString::number(failedItems.size()), itemType, failedItems.join(QStringLiteral(", "))));
+    }
+
+    return setCount;
+}
+
 //-----------------------------------------------------------------------------
 // Function: PythonAPI::createDesign()
 //-----------------------------------------------------------------------------
@@ -1037,8 +1256,11 @@ bool PythonAPI::openDesign(std::string const& vlnvString)
         QSharedPointer<Design> design = designDocument.dynamicCast<Design>();
         if (design)
         {
+            // The queued connections belong to the previous design.
+            createQueuedConnections();
+
             activeDesign_ = design;
-            messager_->showMessage(QString("Design %1 is open").arg(designVLNV));
+            showStatus(QString("Design %1 is open").arg(designVLNV));
 
             instanceInterface_->setComponentInstances(activeDesign_);
             connectionInterface_->setInterconnections(activeDesign_);
@@ -1064,9 +1286,11 @@ bool PythonAPI::openDesign(std::string const& vlnvString)
 //-----------------------------------------------------------------------------
 void PythonAPI::closeOpenDesign()
 {
+    createQueuedConnections();
+
     if (activeDesign_)
     {
-        messager_->showMessage(QString("Design %1 is closed").arg(activeDesign_->getVlnv().toString()));
+        showStatus(QString("Design %1 is closed").arg(activeDesign_->getVlnv().toString()));
     }
 
     activeDesign_ = QSharedPointer<Design>();
@@ -1077,6 +1301,9 @@ void PythonAPI::closeOpenDesign()
 //-----------------------------------------------------------------------------
 void PythonAPI::saveDesign()
 {
+    // The queued connections are saved with the design.
+    createQueuedConnections();
+
     if (activeDesign_)
     {
         messager_->showMessage(QString("Saving design %1 ...").arg(activeDesign_->getVlnv().toString()));
@@ -1134,6 +1361,74 @@ bool PythonAPI::addComponentInstance(std::string const& vlnvString, std::string
     return instanceInterface_->setComponentReference(instanceName, newVendor, newLibrary, newName, newVersion);
 }
 
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::addComponentInstances()
+//-----------------------------------------------------------------------------
+int PythonAPI::addComponentInstances(std::vector<std::string> const& vlnvStrings,
+    std::vector<std::string> const& instanceNames)
+{
+    if (!activeDesign_)
+    {
+        messager_->showMessage(QString("No open design"));
+        return 0;
+    }
+
+    if (vlnvStrings.size() != instanceNames.size())
+    {
+        messager_->showError(QString("Got %1 VLNVs but %2 instance names.").arg(
+            QString::number(vlnvStrings.size()), QString::number(instanceNames.size())));
+        return 0;
+    }
+
+    // Each referenced component is checked once, however many instances refer to it.
+    QHash<QString, QStringList> checkedReferences;
+    QSet<QString> invalidReferences;
+
+    int addedCount = 0;
+    for (size_t i = 0; i < vlnvStrings.size(); ++i)
+    {
+        QString combinedVLNV = QString::fromStdString(vlnvStrings.at(i));
+        if (invalidReferences.contains(combinedVLNV))
+        {
+            continue;
+        }
+
+        if (checkedReferences.contains(combinedVLNV) == false)
+        {
+            QStringList vlnvList = combinedVLNV.split(QLatin1Char(':'));
+            QSharedPointer<const Document> instanceDocument;
+            if (vlnvList.size() == 4)
+            {
+                instanceDocument = library_->getModelReadOnly(
+                    VLNV(VLNV::COMPONENT, vlnvList.at(0), vlnvList.at(1), vlnvList.at(2), vlnvList.at(3)));
+            }
+
+            if (!instanceDocument.dynamicCast<const Component>())
+            {
+                messager_->showMessage(QString("%1 is not a component in the library").arg(combinedVLNV));
+                invalidReferences.insert(combinedVLNV);
+                continue;
+            }
+
+            checkedReferences.insert(combinedVLNV, vlnvList);
+        }
+
+        QStringList const& vlnvList = checkedReferences[combinedVLNV];
+
+        instanceInterface_->addComponentInstance(instanceNames.at(i));
+
+        // The added instance may have been renamed to keep the instance names unique.
+        std::string addedName = instanceInterface_->getIndexedItemName(instanceInterface_->itemCount() - 1);
+        if (instanceInterface_->setComponentReference(addedName, vlnvList.at(0).toStdString(),
+            vlnvList.at(1).toStdString(), vlnvList.at(2).toStdString(), vlnvList.at(3).toStdString()))
+        {
+            ++addedCount;
+        }
+    }
+
+    return addedCount;
+}
+
 //-----------------------------------------------------------------------------
 // Function: PythonAPI::removeComponentInstance()
 //-----------------------------------------------------------------------------
@@ -1177,6 +1472,20 @@ bool PythonAPI::renameInstance(std::string const& currentName, std::string const
 //-----------------------------------------------------------------------------
 bool PythonAPI::createConnection(std::string const& startInstanceName, std::string const& startBus,
     std::string const& endInstanceName, std::string const& endBus)
+{
+    if (batchActive_)
+    {
+        return queueConnection({ startInstanceName, startBus, endInstanceName, endBus, false });
+    }
+
+    return connectBusInterfaces(startInstanceName, startBus, endInstanceName, endBus);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::connectBusInterfaces()
+//-----------------------------------------------------------------------------
+bool PythonAPI::connectBusInterfaces(std::string const& startInstanceName, std::string const& startBus,
+    std::string const& endInstanceName, std::string const& endBus)
 {
     QString startInstanceNameQ = QString::fromStdString(startInstanceName);
     QString endInstanceNameQ = QString::fromStdString(endInstanceName);
@@ -1194,6 +1503,33 @@ bool PythonAPI::createConnection(std::string const& startInstanceName, std::stri
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::createConnections()
+//-----------------------------------------------------------------------------
+int PythonAPI::createConnections(std::vector<std::string> const& startInstanceNames,
+    std::vector<std::string> const& startBuses, std::vector<std::string> const& endInstanceNames,
+    std::vector<std::string> const& endBuses)
+{
+    size_t const connectionCount = startInstanceNames.size();
+    if (startBuses.size() != connectionCount || endInstanceNames.size() != connectionCount ||
+        endBuses.size() != connectionCount)
+    {
+        messager_->showError(QString("The connection end lists have different lengths."));
+        return 0;
+    }
+
+    int createdCount = 0;
+    for (size_t i = 0; i < connectionCount; ++i)
+    {
+        if (createConnection(startInstanceNames.at(i), startBuses.at(i), endInstanceNames.at(i), endBuses.at(i)))
+        {
+            ++createdCount;
+        }
+    }
+
+    return createdCount;
+}
+
 //-----------------------------------------------------------------------------
 // Function: PythonAPI::createHierarchicalConnection()
 //-----------------------------------------------------------------------------
@@ -1297,31 +1633,24 @@ bool PythonAPI::endsCheckForAdHoc(QSharedPointer<const Component> startComponent
     QString const& startInstanceName, QSharedPointer<const Component> endComponent, QString const& endBus,
     QString const& endInstanceName)
 {
-    openComponent(startComponent->getVlnv().toString().toStdString());
-
-    DirectionTypes::Direction startDirection =
-        DirectionTypes::str2Direction(QString::fromStdString(portsInterface_->getDirection(
-            startBus.toStdString())), DirectionTypes::DIRECTION_INVALID);
-
-    if (!portsInterface_->portExists(startBus.toStdString()))
+    QSharedPointer<Port> startPort = startComponent->getPort(startBus);
+    if (!startPort)
     {
         messager_->showMessage(QString("Could not find port %1 within component instance %2.").
             arg(startBus, startInstanceName));
         return false;
     }
 
-    openComponent(endComponent->getVlnv().toString().toStdString());
-    DirectionTypes::Direction endDirection = DirectionTypes::str2Direction(QString::fromStdString(
-        portsInterface_->getDirection(endBus.toStdString())), DirectionTypes::DIRECTION_INVALID);
-
-    if (!portsInterface_->portExists(endBus.toStdString()))
+    QSharedPointer<Port> endPort = endComponent->getPort(endBus);
+    if (!endPort)
     {
         messager_->showMessage(QString("Could not find port %1 within component instance %2.").
             arg(endBus, endInstanceName));
         return false;
     }
 
-    closeOpenComponent();
+    DirectionTypes::Direction startDirection = startPort->getDirection();
+    DirectionTypes::Direction endDirection = endPort->getDirection();
 
     if (startDirection == DirectionTypes::DIRECTION_INVALID ||
         endDirection == DirectionTypes::DIRECTION_INVALID ||
@@ -1344,33 +1673,29 @@ bool PythonAPI::endsCheckForInterconnection(QSharedPointer<const Component> star
     QString const& startBus, QString const& startInstanceName, QSharedPointer<const Component> endComponent,
     QString const& endBus, QString const& endInstanceName)
 {
-    openComponent(startComponent->getVlnv().toString().toStdString());
-
-    ConfigurableVLNVReference startBusType = busInterface_->getBusType(startBus.toStdString());
-    General::InterfaceMode startMode = busInterface_->getMode(startBus.toStdString());
-    General::InterfaceMode startMonitor = busInterface_->getMonitorMode(startBus.toStdString());
-
-    if (!busInterface_->busInterfaceExists(startBus.toStdString()))
+    QSharedPointer<BusInterface> startInterface = startComponent->getBusInterface(startBus);
+    if (!startInterface)
     {
         messager_->showMessage(QString("Could not find bus interface %1 within component instance %2.").
             arg(startBus, startInstanceName));
         return false;
     }
 
-    openComponent(endComponent->getVlnv().toString().toStdString());
-
-    ConfigurableVLNVReference endBusType = busInterface_->getBusType(endBus.toStdString());
-    General::InterfaceMode endMode = busInterface_->getMode(endBus.toStdString());
-    General::InterfaceMode endMonitor = busInterface_->getMonitorMode(endBus.toStdString());
-
-    if (!busInterface_->busInterfaceExists(endBus.toStdString()))
+    QSharedPointer<BusInterface> endInterface = endComponent->getBusInterface(endBus);
+    if (!endInterface)
     {
         messager_->showMessage(QString("Could not find bus interface %1 within component instance %2.").
             arg(endBus, endInstanceName));
         return false;
     }
 
-    closeOpenComponent();
+    ConfigurableVLNVReference startBusType = startInterface->getBusType();
+    General::InterfaceMode startMode = startInterface->getInterfaceMode();
+    General::InterfaceMode startMonitor = monitorMode(startInterface);
+
+    ConfigurableVLNVReference endBusType = endInterface->getBusType();
+    General::InterfaceMode endMode = endInterface->getInterfaceMode();
+    General::InterfaceMode endMonitor = monitorMode(endInterface);
 
     if (!BusInterfaceUtilities::busDefinitionVLNVsMatch(startBusType, endBusType, library_))
     {
@@ -1459,6 +1784,20 @@ bool PythonAPI::renameConnection(std::string const& currentName, std::string con
 //-----------------------------------------------------------------------------
 bool PythonAPI::createAdHocConnection(std::string const& startInstanceName, std::string const& startPort,
     std::string const& endInstanceName, std::string const& endPort)
+{
+    if (batchActive_)
+    {
+        return queueConnection({ startInstanceName, startPort, endInstanceName, endPort, true });
+    }
+
+    return connectPorts(startInstanceName, startPort, endInstanceName, endPort);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::connectPorts()
+//-----------------------------------------------------------------------------
+bool PythonAPI::connectPorts(std::string const& startInstanceName, std::string const& startPort,
+    std::string const& endInstanceName, std::string const& endPort)
 {
     QString startInstanceNameQ = QString::fromStdString(startInstanceName);
     QString endInstanceNameQ = QString::fromStdString(endInstanceName);
@@ -1542,3 +1881,136 @@ bool PythonAPI::renameAdHocConnection(std::string const& currentName, std::strin
 {
     return adhocConnectionInterface_->setName(currentName, newName);
 }
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::beginBatch()
+//-----------------------------------------------------------------------------
+void PythonAPI::beginBatch()
+{
+    batchActive_ = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::commitBatch()
+//-----------------------------------------------------------------------------
+std::vector<std::string> PythonAPI::commitBatch()
+{
+    std::vector<std::string> failedConnections;
+    if (!batchActive_)
+    {
+        return failedConnections;
+    }
+
+    createQueuedConnections();
+    batchActive_ = false;
+
+    failedConnections.swap(failedConnections_);
+    return failedConnections;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::discardBatch()
+//-----------------------------------------------------------------------------
+void PythonAPI::discardBatch()
+{
+    batchActive_ = false;
+    queuedConnections_.clear();
+    failedConnections_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::isBatchActive()
+//-----------------------------------------------------------------------------
+bool PythonAPI::isBatchActive() const
+{
+    return batchActive_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::queueConnection()
+//-----------------------------------------------------------------------------
+bool PythonAPI::queueConnection(QueuedConnection const& connection)
+{
+    if (!activeDesign_)
+    {
+        messager_->showMessage(QString("No open design"));
+        return false;
+    }
+
+    // The queue is emptied whenever the design changes, so all the queued connections share the design.
+    queuedDesign_ = activeDesign_->getVlnv();
+    queuedConnections_.push_back(connection);
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::createQueuedConnections()
+//-----------------------------------------------------------------------------
+void PythonAPI::createQueuedConnections()
+{
+    std::vector<QueuedConnection> connections;
+    connections.swap(queuedConnections_);
+
+    if (connections.empty())
+    {
+        return;
+    }
+
+    bool const designIsOpen = activeDesign_ && activeDesign_->getVlnv() == queuedDesign_;
+    if (!designIsOpen)
+    {
+        messager_->showError(QString("Design %1 containing the queued connections is not open").
+            arg(queuedDesign_.toString()));
+    }
+
+    int createdCount = 0;
+    for (auto const& connection : connections)
+    {
+        bool created = false;
+        if (designIsOpen && connection.isAdHoc)
+        {
+            created = connectPorts(connection.startInstance, connection.startInterface,
+                connection.endInstance, connection.endInterface);
+        }
+        else if (designIsOpen)
+        {
+            created = connectBusInterfaces(connection.startInstance, connection.startInterface,
+                connection.endInstance, connection.endInterface);
+        }
+
+        if (created)
+        {
+            ++createdCount;
+        }
+        else
+        {
+            failedConnections_.push_back(describeConnection(connection));
+        }
+    }
+
+    messager_->showMessage(QString("Created %1 of %2 queued connections in design %3").arg(
+        QString::number(createdCount), QString::number(connections.size()), queuedDesign_.toString()));
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::describeConnection()
+//-----------------------------------------------------------------------------
+std::string PythonAPI::describeConnection(QueuedConnection const& connection)
+{
+    std::string const connectionType = connection.isAdHoc ? "Ad hoc connection " : "Interconnection ";
+
+    return connectionType + connection.startInstance + "." + connection.startInterface + " - " +
+        connection.endInstance + "." + connection.endInterface;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::showStatus()
+//-----------------------------------------------------------------------------
+void PythonAPI::showStatus(QString const& message) const
+{
+    if (!batchActive_)
+    {
+        messager_->showMessage(message);
+    }
+}
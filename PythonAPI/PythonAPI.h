@@ -16,6 +16,8 @@
 
 #include <KactusAPI/KactusAPI.h>
 
+#include <functional>
+#include <map>
 #include <string>
 #include <vector>
 #include <QSharedPointer>
@@ -371,6 +373,53 @@ public:
      *    @param [in] setName     Name of the file set containing the available file builders.
      */
     void setFileBuildersForInterface(std::string const& setName);
+
+    /*!
+     *  Set an attribute of several ports of the active component in one call.
+     *
+     *    @param [in] attribute   Name of the attribute, for example direction, leftBound or description.
+     *    @param [in] portNames   Names of the selected ports.
+     *    @param [in] values      The new attribute values in the order of the port names.
+     *
+     *    @return The number of ports whose attribute was set.
+     */
+    int setPortValues(std::string const& attribute, std::vector<std::string> const& portNames,
+        std::vector<std::string> const& values);
+
+    /*!
+     *  Set an attribute of several registers of the register interface in one call.
+     *
+     *    @param [in] attribute       Name of the attribute, for example offset, size or description.
+     *    @param [in] registerNames   Names of the selected registers.
+     *    @param [in] values          The new attribute values in the order of the register names.
+     *
+     *    @return The number of registers whose attribute was set.
+     */
+    int setRegisterValues(std::string const& attribute, std::vector<std::string> const& registerNames,
+        std::vector<std::string> const& values);
+
+    /*!
+     *  Set an attribute of several fields of the field interface in one call.
+     *
+     *    @param [in] attribute   Name of the attribute, for example offset, width or access.
+     *    @param [in] fieldNames  Names of the selected fields.
+     *    @param [in] values      The new attribute values in the order of the field names.
+     *
+     *    @return The number of fields whose attribute was set.
+     */
+    int setFieldValues(std::string const& attribute, std::vector<std::string> const& fieldNames,
+        std::vector<std::string> const& values);
+
+    /*!
+     *  Import memory maps, address blocks, registers and fields to the active component from a file. Files
+     *  ending in .jsonl or .ndjson are read as one JSON object per line, files ending in .json as a JSON array
+     *  of objects and all the other files as CSV with a header row. Rows with errors are skipped and reported.
+     *
+     *    @param [in] filePath    Path to the imported file.
+     *
+     *    @return The number of imported rows.
+     */
+    int importRegisterMap(std::string const& filePath);
         
     /*!
      *  Create a new design with the selected VLNV. Defaults to IP-XACT 2022.
@@ -420,6 +469,17 @@ public:
      */
     bool addComponentInstance(std::string const& vlnvString, std::string const& instanceName);
 
+    /*!
+     *  Add several component instances to the active design.
+     *
+     *    @param [in] vlnvStrings     VLNVs of the components within the new component instances.
+     *    @param [in] instanceNames   Names for the new component instances in the order of the VLNVs.
+     *
+     *    @return The number of added component instances.
+     */
+    int addComponentInstances(std::vector<std::string> const& vlnvStrings,
+        std::vector<std::string> const& instanceNames);
+
     /*!
      *  Remove the selected component instance from the active design.
      *
@@ -465,11 +525,26 @@ public:
      *    @param [in] endInstanceName     Name of the component instance containing the second bus interface.
      *    @param [in] endBus              Name of the second bus interface.
      *
-     *    @return True, if the connection was created, false otherwise.
+     *    @return True, if the connection was created, false otherwise. Within a batch, true only means the
+     *            connection was queued; commitBatch() reports the queued connections that could not be created.
      */
     bool createConnection(std::string const& startInstanceName, std::string const& startBus,
         std::string const& endInstanceName, std::string const& endBus);
 
+    /*!
+     *  Create several interconnections between bus interfaces.
+     *
+     *    @param [in] startInstanceNames  Names of the component instances containing the first bus interfaces.
+     *    @param [in] startBuses          Names of the first bus interfaces.
+     *    @param [in] endInstanceNames    Names of the component instances containing the second bus interfaces.
+     *    @param [in] endBuses            Names of the second bus interfaces.
+     *
+     *    @return The number of created (or, within a batch, queued) connections.
+     */
+    int createConnections(std::vector<std::string> const& startInstanceNames,
+        std::vector<std::string> const& startBuses, std::vector<std::string> const& endInstanceNames,
+        std::vector<std::string> const& endBuses);
+
     /*!
      *  Create a hierarchical interconnection between two bus interfaces.
      *
@@ -525,7 +600,8 @@ public:
      *    @param [in] endInstanceName     Name of the component instance containing the second port.
      *    @param [in] endPort             Name of the second port.
      *
-     *    @return True, if the connection was created, false otherwise.
+     *    @return True, if the connection was created, false otherwise. Within a batch, true only means the
+     *            connection was queued; commitBatch() reports the queued connections that could not be created.
      */
     bool createAdHocConnection(std::string const& startInstanceName, std::string const& startPort,
         std::string const& endInstanceName, std::string const& endPort);
@@ -577,8 +653,130 @@ public:
      */
     bool renameAdHocConnection(std::string const& currentName, std::string const& newName);
 
+    /*!
+     *  Start a batch of operations. Within a batch, status messages are not shown and the interconnections and
+     *  ad hoc connections are queued. The queued connections are checked and created when the batch is committed.
+     *  The queued connections belong to the design that was active when they were queued, so they are created
+     *  before the active design is saved or closed, or another design is opened or created.
+     */
+    void beginBatch();
+
+    /*!
+     *  End the active batch and create the queued connections.
+     *
+     *    @return The queued connections that could not be created, including those created when the active
+     *            design changed within the batch. Empty, if all the connections were created.
+     */
+    std::vector<std::string> commitBatch();
+
+    /*!
+     *  End the active batch and discard the queued connections.
+     */
+    void discardBatch();
+
+    /*!
+     *  Check if a batch of operations is active.
+     *
+     *    @return True, if a batch is active, false otherwise.
+     */
+    bool isBatchActive() const;
+
 private:
 
+    //! Setter for a single attribute of a named item.
+    using ItemSetter = std::function<bool(std::string const&, std::string const&)>;
+
+    //! A connection queued within a batch.
+    struct QueuedConnection
+    {
+        //! Name of the component instance containing the first interface.
+        std::string startInstance;
+
+        //! Name of the first bus interface or port.
+        std::string startInterface;
+
+        //! Name of the component instance containing the second interface.
+        std::string endInstance;
+
+        //! Name of the second bus interface or port.
+        std::string endInterface;
+
+        //! Flag for ad hoc connections.
+        bool isAdHoc = false;
+    };
+
+    /*!
+     *  Set an attribute of several items.
+     *
+     *    @param [in] setters     The available attribute setters keyed by the attribute names.
+     *    @param [in] itemType    Type of the items for messages.
+     *    @param [in] attribute   Name of the selected attribute.
+     *    @param [in] itemNames   Names of the selected items.
+     *    @param [in] values      The new attribute values in the order of the item names.
+     *
+     *    @return The number of items whose attribute was set.
+     */
+    int setItemValues(std::map<std::string, ItemSetter> const& setters, QString const& itemType,
+        std::string const& attribute, std::vector<std::string> const& itemNames,
+        std::vector<std::string> const& values) const;
+
+    /*!
+     *  Create an interconnection between two bus interfaces in the active design.
+     *
+     *    @param [in] startInstanceName   Name of the component instance containing the first bus interface.
+     *    @param [in] startBus            Name of the first bus interface.
+     *    @param [in] endInstanceName     Name of the component instance containing the second bus interface.
+     *    @param [in] endBus              Name of the second bus interface.
+     *
+     *    @return True, if the connection was created, false otherwise.
+     */
+    bool connectBusInterfaces(std::string const& startInstanceName, std::string const& startBus,
+        std::string const& endInstanceName, std::string const& endBus);
+
+    /*!
+     *  Create an ad hoc connection between two ports in the active design.
+     *
+     *    @param [in] startInstanceName   Name of the component instance containing the first port.
+     *    @param [in] startPort           Name of the first port.
+     *    @param [in] endInstanceName     Name of the component instance containing the second port.
+     *    @param [in] endPort             Name of the second port.
+     *
+     *    @return True, if the connection was created, false otherwise.
+     */
+    bool connectPorts(std::string const& startInstanceName, std::string const& startPort,
+        std::string const& endInstanceName, std::string const& endPort);
+
+    /*!
+     *  Queue a connection to the active design within the active batch.
+     *
+     *    @param [in] connection  The connection to queue.
+     *
+     *    @return True, if the connection was queued, false if there is no open design.
+     */
+    bool queueConnection(QueuedConnection const& connection);
+
+    /*!
+     *  Create the connections queued in the active batch into the design they were queued for. The connections
+     *  that could not be created are added to the failed connections of the batch.
+     */
+    void createQueuedConnections();
+
+    /*!
+     *  Get a description of a queued connection for reporting.
+     *
+     *    @param [in] connection  The queued connection.
+     *
+     *    @return The description of the connection.
+     */
+    static std::string describeConnection(QueuedConnection const& connection);
+
+    /*!
+     *  Show a status message, unless a batch is active.
+     *
+     *    @param [in] message     The message to show.
+     */
+    void showStatus(QString const& message) const;
+
     /*!
      *  Check if the connection end points exist.
      *
@@ -833,6 +1031,18 @@ private:
     ComponentInstanceInterface* instanceInterface_{ new ComponentInstanceInterface(connectionInterface_, 
         adhocConnectionInterface_) };
 
+    //! Flag for an active batch of operations.
+    bool batchActive_{ false };
+
+    //! The connections queued within the active batch.
+    std::vector<QueuedConnection> queuedConnections_;
+
+    //! The design containing the queued connections.
+    VLNV queuedDesign_;
+
+    //! The queued connections of the active batch that could not be created.
+    std::vector<std::string> failedConnections_;
+
 };
 
 #endif // !PYTHON_API_H
\ No newline at end of file
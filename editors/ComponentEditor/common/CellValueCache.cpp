@@ -0,0 +1,98 @@
+//-----------------------------------------------------------------------------
+// File: CellValueCache.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Row-indexed cache for the values shown in the cells of a table model.
+//-----------------------------------------------------------------------------
+
+#include "CellValueCache.h"
+
+#include <QAbstractItemModel>
+
+//-----------------------------------------------------------------------------
+// Function: CellValueCache::followModel()
+//-----------------------------------------------------------------------------
+void CellValueCache::followModel(QAbstractItemModel* model)
+{
+    QObject::connect(model, &QAbstractItemModel::dataChanged, model,
+        [this](QModelIndex const& topLeft, QModelIndex const& bottomRight)
+        {
+            if (topLeft.isValid() && bottomRight.isValid())
+            {
+                invalidateRows(topLeft.row(), bottomRight.row());
+            }
+            else
+            {
+                clear();
+            }
+        });
+
+    QObject::connect(model, &QAbstractItemModel::rowsInserted, model, [this]() { clear(); });
+    QObject::connect(model, &QAbstractItemModel::rowsRemoved, model, [this]() { clear(); });
+    QObject::connect(model, &QAbstractItemModel::rowsMoved, model, [this]() { clear(); });
+    QObject::connect(model, &QAbstractItemModel::layoutChanged, model, [this]() { clear(); });
+    QObject::connect(model, &QAbstractItemModel::modelReset, model, [this]() { clear(); });
+}
+
+//-----------------------------------------------------------------------------
+// Function: CellValueCache::value()
+//-----------------------------------------------------------------------------
+QVariant CellValueCache::value(int row, int column, int role) const
+{
+    if (row < 0 || row >= rows_.size())
+    {
+        return QVariant();
+    }
+
+    return rows_.at(row).value(cellKey(column, role));
+}
+
+//-----------------------------------------------------------------------------
+// Function: CellValueCache::insert()
+//-----------------------------------------------------------------------------
+void CellValueCache::insert(int row, int column, int role, QVariant const& value)
+{
+    if (row < 0 || value.isValid() == false)
+    {
+        return;
+    }
+
+    if (row >= rows_.size())
+    {
+        rows_.resize(row + 1);
+    }
+
+    rows_[row].insert(cellKey(column, role), value);
+}
+
+//-----------------------------------------------------------------------------
+// Function: CellValueCache::invalidateRows()
+//-----------------------------------------------------------------------------
+void CellValueCache::invalidateRows(int firstRow, int lastRow)
+{
+    const int last = qMin(lastRow, int(rows_.size()) - 1);
+    for (int row = qMax(firstRow, 0); row <= last; ++row)
+    {
+        rows_[row].clear();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: CellValueCache::clear()
+//-----------------------------------------------------------------------------
+void CellValueCache::clear()
+{
+    rows_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: CellValueCache::cellKey()
+//-----------------------------------------------------------------------------
+quint64 CellValueCache::cellKey(int column, int role)
+{
+    return (quint64(quint32(column)) << 32) | quint32(role);
+}
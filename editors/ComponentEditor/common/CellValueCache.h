@@ -0,0 +1,102 @@
+//-----------------------------------------------------------------------------
+// File: CellValueCache.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Row-indexed cache for the values shown in the cells of a table model.
+//-----------------------------------------------------------------------------
+
+#ifndef CELLVALUECACHE_H
+#define CELLVALUECACHE_H
+
+#include <QHash>
+#include <QVariant>
+#include <QVector>
+
+class QAbstractItemModel;
+
+//-----------------------------------------------------------------------------
+//! Row-indexed cache for the values shown in the cells of a table model.
+//!
+//! The cached values of a row are discarded when the model reports a change in the row. Any change in the
+//! row structure of the model discards all the values.
+//-----------------------------------------------------------------------------
+class CellValueCache
+{
+public:
+
+    //! The constructor.
+    CellValueCache() = default;
+
+    //! The destructor.
+    ~CellValueCache() = default;
+
+    // Disable copying.
+    CellValueCache(CellValueCache const& rhs) = delete;
+    CellValueCache& operator=(CellValueCache const& rhs) = delete;
+
+    /*!
+     *  Discard the cached values according to the change signals of the given model.
+     *
+     *    @param [in] model   The model whose values are cached.
+     */
+    void followModel(QAbstractItemModel* model);
+
+    /*!
+     *  Get the cached value of a cell.
+     *
+     *    @param [in] row     The row of the cell.
+     *    @param [in] column  The column of the cell.
+     *    @param [in] role    The role of the value.
+     *
+     *    @return The cached value, or an invalid value if the cell has no cached value.
+     */
+    QVariant value(int row, int column, int role) const;
+
+    /*!
+     *  Store the value of a cell. Invalid values are not stored.
+     *
+     *    @param [in] row     The row of the cell.
+     *    @param [in] column  The column of the cell.
+     *    @param [in] role    The role of the value.
+     *    @param [in] value   The value to store.
+     */
+    void insert(int row, int column, int role, QVariant const& value);
+
+    /*!
+     *  Discard the cached values of the given rows.
+     *
+     *    @param [in] firstRow    The first row to discard.
+     *    @param [in] lastRow     The last row to discard.
+     */
+    void invalidateRows(int firstRow, int lastRow);
+
+    /*!
+     *  Discard all the cached values.
+     */
+    void clear();
+
+private:
+
+    /*!
+     *  Get the key of a cell value within its row.
+     *
+     *    @param [in] column  The column of the cell.
+     *    @param [in] role    The role of the value.
+     *
+     *    @return The key of the value.
+     */
+    static quint64 cellKey(int column, int role);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The cached values of each row keyed by the column and the role.
+    QVector<QHash<quint64, QVariant> > rows_;
+};
+
+#endif // CELLVALUECACHE_H
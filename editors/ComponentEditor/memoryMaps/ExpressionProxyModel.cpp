@@ -17,7 +17,8 @@
 // Function: ExpressionProxyModel::ExpressionProxyModel()
 //-----------------------------------------------------------------------------
 ExpressionProxyModel::ExpressionProxyModel(QSharedPointer<ExpressionParser> expressionParser, QObject *parent):
-QSortFilterProxyModel(parent), expressionParser_(expressionParser), expressionColumns_()
+QSortFilterProxyModel(parent), expressionParser_(expressionParser), expressionColumns_(),
+evaluations_(expressionParser)
 {
 
 }
@@ -41,6 +42,40 @@ void ExpressionProxyModel::setColumnToAcceptExpressions(int column)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: ExpressionProxyModel::setSourceModel()
+//-----------------------------------------------------------------------------
+void ExpressionProxyModel::setSourceModel(QAbstractItemModel* sourceModel)
+{
+    if (QAbstractItemModel* previousModel = QSortFilterProxyModel::sourceModel(); previousModel != nullptr)
+    {
+        disconnect(previousModel, nullptr, this, SLOT(clearEvaluations()));
+    }
+
+    clearEvaluations();
+
+    // Connected before the base class connections, so that the values are cleared before any re-sorting.
+    if (sourceModel != nullptr)
+    {
+        connect(sourceModel, SIGNAL(dataChanged(QModelIndex const&, QModelIndex const&, QList<int> const&)),
+            this, SLOT(clearEvaluations()), Qt::UniqueConnection);
+        connect(sourceModel, SIGNAL(rowsRemoved(QModelIndex const&, int, int)),
+            this, SLOT(clearEvaluations()), Qt::UniqueConnection);
+        connect(sourceModel, SIGNAL(modelReset()), this, SLOT(clearEvaluations()), Qt::UniqueConnection);
+    }
+
+    QSortFilterProxyModel::setSourceModel(sourceModel);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ExpressionProxyModel::sort()
+//-----------------------------------------------------------------------------
+void ExpressionProxyModel::sort(int column, Qt::SortOrder order)
+{
+    clearEvaluations();
+    QSortFilterProxyModel::sort(column, order);
+}
+
 //-----------------------------------------------------------------------------
 // Function: ExpressionProxyModel::lessThan()
 //-----------------------------------------------------------------------------
@@ -52,11 +87,11 @@ bool ExpressionProxyModel::lessThan(QModelIndex const& left, QModelIndex const&
     {
         // convert the data on left index into number
         QString leftExpression = left.data(Qt::EditRole).toString();
-        quint64 leftValue = expressionParser_->parseExpression(leftExpression).toUInt();
+        quint64 leftValue = evaluations_.evaluate(leftExpression).value.toUInt();
 
         // convert data on right index into number
         QString rightExpression = right.data(Qt::EditRole).toString();
-        quint64 rightValue = expressionParser_->parseExpression(rightExpression).toUInt();
+        quint64 rightValue = evaluations_.evaluate(rightExpression).value.toUInt();
 
         return leftValue < rightValue;
     }
@@ -65,3 +100,11 @@ bool ExpressionProxyModel::lessThan(QModelIndex const& left, QModelIndex const&
         return QSortFilterProxyModel::lessThan(left, right);
     }
 }
+
+//-----------------------------------------------------------------------------
+// Function: ExpressionProxyModel::clearEvaluations()
+//-----------------------------------------------------------------------------
+void ExpressionProxyModel::clearEvaluations()
+{
+    evaluations_.clear();
+}
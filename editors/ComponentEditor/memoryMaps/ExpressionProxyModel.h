@@ -12,6 +12,8 @@
 #ifndef EXPRESSIONPROXYMODEL_H
 #define EXPRESSIONPROXYMODEL_H
 
+#include <KactusAPI/include/ExpressionEvaluationCache.h>
+
 #include <QSortFilterProxyModel>
 #include <QSharedPointer>
 
@@ -42,6 +44,21 @@ public:
      */
     void setColumnToAcceptExpressions(int column);
 
+    /*!
+     *  Sets the source model. The cached expression values are cleared whenever the source data changes.
+     *
+     *    @param [in] sourceModel     The new source model.
+     */
+    void setSourceModel(QAbstractItemModel* sourceModel) override;
+
+    /*!
+     *  Sorts the model by the given column.
+     *
+     *    @param [in] column  The column to sort by.
+     *    @param [in] order   The sort order.
+     */
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
 protected:
 
 	/*! Compares two items by value.
@@ -53,6 +70,11 @@ protected:
 	*/
 	virtual bool lessThan(QModelIndex const& left, QModelIndex const& right) const;
 
+private slots:
+
+    //! Clears the cached expression values.
+    void clearEvaluations();
+
 private:
 	
 	//! No copying
@@ -64,6 +86,9 @@ private:
 
     //! The columns accepting expressions.
     QList<int> expressionColumns_;
+
+    //! The evaluated expressions, so that each expression is parsed once per sort.
+    mutable ExpressionEvaluationCache evaluations_;
 };
 
 #endif // EXPRESSIONPROXYMODEL_H
@@ -133,6 +133,7 @@ registers_(registers)
 //-----------------------------------------------------------------------------
 void AddressBlockEditor::refresh()
 {
+    model_->clearCachedValues();
 	view_->update();
 
     interface_->setRegisters(registers_);
@@ -32,6 +32,8 @@ accessPolicyInterface_(registerInterface->getAccessPolicyInterface()),
 docRevision_(docRevision)
 {
     setExpressionParser(expressionParser);
+
+    cellCache_.followModel(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -150,7 +152,14 @@ QVariant AddressBlockModel::data(QModelIndex const& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return formattedExpressionForIndex(index);
+            QVariant formattedValue = cellCache_.value(index.row(), index.column(), role);
+            if (!formattedValue.isValid())
+            {
+                formattedValue = formattedExpressionForIndex(index);
+                cellCache_.insert(index.row(), index.column(), role, formattedValue);
+            }
+
+            return formattedValue;
         }
         else if (index.column() == AddressBlockColumns::DESCRIPTION)
         {
@@ -629,6 +638,15 @@ QMap<QString, int> AddressBlockModel::getReferencedParameters(QString const& reg
 void AddressBlockModel::addressUnitBitsChanged(int newAddressUnitbits)
 {
     registerInterface_->setAddressUnitBits(newAddressUnitbits);
+    cellCache_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockModel::clearCachedValues()
+//-----------------------------------------------------------------------------
+void AddressBlockModel::clearCachedValues()
+{
+    cellCache_.clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -15,6 +15,7 @@
 #include <IPXACTmodels/Component/AddressBlock.h>
 #include <IPXACTmodels/common/Document.h>
 
+#include <editors/ComponentEditor/common/CellValueCache.h>
 #include <editors/ComponentEditor/common/ParameterizableTable.h>
 #include <editors/ComponentEditor/common/ReferencingTableModel.h>
 #include <KactusAPI/include/ParameterFinder.h>
@@ -118,6 +119,11 @@ public:
      */
     virtual QStringList mimeTypes() const;
 
+    /*!
+     *  Discard the cached display values of the registers, e.g. when the registers have been edited elsewhere.
+     */
+    void clearCachedValues();
+
 protected:
 
     /*!
@@ -296,6 +302,9 @@ private:
     AccessPolicyInterface* accessPolicyInterface_;
 
     Document::Revision docRevision_;
+
+    //! The display values of the expression cells.
+    mutable CellValueCache cellCache_;
 };
 
 #endif // ADDRESSBLOCKMODEL_H
@@ -74,63 +74,81 @@ void ComponentParameterReferenceTree::setupTree()
 {
     if (!component_.isNull())
     {
-        if (referenceCounter_->countReferencesInFileSets(getTargetID()) > 0)
+        if (referenceCounter_->countReferencesInComponent(getTargetID()) == 0)
+        {
+            createTopItem("No references found.");
+            return;
+        }
+
+        if (referenceCounter_->countReferencesInArea(getTargetID(),
+            ComponentParameterReferenceCounter::FILE_SETS) > 0)
         {
             createReferencesForFileSets();
         }
 
-        if (referenceCounter_->countReferencesInParameters(getTargetID(), component_->getParameters()) > 0)
+        if (referenceCounter_->countReferencesInArea(getTargetID(),
+            ComponentParameterReferenceCounter::PARAMETERS) > 0)
         {
             QTreeWidgetItem* topParametersItem = createTopItem("Parameters");
             createParameterReferences(component_->getParameters(), topParametersItem);
         }
 
-        if (referenceCounter_->countReferencesInMemoryMaps(getTargetID()) > 0)
+        if (referenceCounter_->countReferencesInArea(getTargetID(),
+            ComponentParameterReferenceCounter::MEMORY_MAPS) > 0)
         {
             createReferencesForMemoryMaps();
         }
 
-        if (referenceCounter_->countReferencesInAddressSpaces(getTargetID()) > 0)
+        if (referenceCounter_->countReferencesInArea(getTargetID(),
+            ComponentParameterReferenceCounter::ADDRESS_SPACES) > 0)
         {
             createReferencesForAddressSpaces();
         }
 
-        if (referenceCounter_->countReferencesInInstantiations(getTargetID()) > 0)
+        if (referenceCounter_->countReferencesInArea(getTargetID(),
+            ComponentParameterReferenceCounter::INSTANTIATIONS) > 0)
         {
             createReferencesForInstantiations();
         }
 
-        if (referenceCounter_->countReferencesInPorts(getTargetID()) > 0)
+        if (referenceCounter_->countReferencesInArea(getTargetID(),
+            ComponentParameterReferenceCounter::PORTS) > 0)
         {
             createReferencesForPorts();
         }
 
-        if (referenceCounter_->countReferencesInBusInterfaces(getTargetID()) > 0)
+        if (referenceCounter_->countReferencesInArea(getTargetID(),
+            ComponentParameterReferenceCounter::BUS_INTERFACES) > 0)
         {
             createReferencesForBusInterfaces();
         }
 
-        if (referenceCounter_->countReferencesInRemapStates(getTargetID()) > 0)
+        if (referenceCounter_->countReferencesInArea(getTargetID(),
+            ComponentParameterReferenceCounter::REMAP_STATES) > 0)
         {
             createReferencesForRemapStates();
         }
 
-        if (referenceCounter_->countReferencesInModes(getTargetID()) > 0)
+        if (referenceCounter_->countReferencesInArea(getTargetID(),
+            ComponentParameterReferenceCounter::MODES) > 0)
         {
             createReferencesForModes();
         }
 
-        if (referenceCounter_->countReferencesInIndirectInterfaces(getTargetID()) > 0)
+        if (referenceCounter_->countReferencesInArea(getTargetID(),
+            ComponentParameterReferenceCounter::INDIRECT_INTERFACES) > 0)
         {
             createReferencesForIndirectInterfaces();
         }
 
-        if (referenceCounter_->countReferencesInCpus(getTargetID()) > 0)
+        if (referenceCounter_->countReferencesInArea(getTargetID(),
+            ComponentParameterReferenceCounter::CPUS) > 0)
         {
             createReferencesForCpus();
         }
 
-        if (referenceCounter_->countReferencesInPowerDomains(getTargetID()) > 0)
+        if (referenceCounter_->countReferencesInArea(getTargetID(),
+            ComponentParameterReferenceCounter::POWER_DOMAINS) > 0)
         {
             createReferencesForPowerDomains();
         }
@@ -695,7 +713,7 @@ void ComponentParameterReferenceTree::createReferencesForBusInterfaces()
                         }
                     }
 
-                    if (mirrorSlave->getRange().contains(targetID))
+                    if (referenceCounter_->countReferencesInExpression(targetID, mirrorSlave->getRange()) > 0)
                     {
                         createItem("Range", mirrorSlave->getRange(), mirroredInterfaceItem);
                     }
@@ -817,12 +835,12 @@ void ComponentParameterReferenceTree::createPortSliceItems(QString const& target
         {
             QTreeWidgetItem* sliceItem = createMiddleItem(portSlice->name(), parentItem);
 
-            if (portSlice->getLeftRange().contains(targetID))
+            if (referenceCounter_->countReferencesInExpression(targetID, portSlice->getLeftRange()) > 0)
             {
                 createItem(QStringLiteral("Left bound"), portSlice->getLeftRange(), sliceItem);
             }
 
-            if (portSlice->getRightRange().contains(targetID))
+            if (referenceCounter_->countReferencesInExpression(targetID, portSlice->getRightRange()) > 0)
             {
                 createItem(QStringLiteral("Right bound"), portSlice->getRightRange(), sliceItem);
             }
@@ -850,12 +868,12 @@ void ComponentParameterReferenceTree::createFieldSliceItems(QString const& targe
         {
             QTreeWidgetItem* sliceItem = createMiddleItem(fieldSlice->name(), parentItem);
 
-            if (fieldSlice->getLeft().contains(targetID))
+            if (referenceCounter_->countReferencesInExpression(targetID, fieldSlice->getLeft()) > 0)
             {
                 createItem(QStringLiteral("Leftmost bit"), fieldSlice->getLeft(), sliceItem);
             }
 
-            if (fieldSlice->getRight().contains(targetID))
+            if (referenceCounter_->countReferencesInExpression(targetID, fieldSlice->getRight()) > 0)
             {
                 createItem(QStringLiteral("Rightmost bit"), fieldSlice->getRight(), sliceItem);
             }
@@ -898,15 +916,15 @@ void ComponentParameterReferenceTree::createReferencesForCpus()
         {
             QTreeWidgetItem* cpuItem = createMiddleItem(cpu->name(), topCpusItem);
 
-            if (cpu->getWidth().contains(targetID))
+            if (referenceCounter_->countReferencesInExpression(targetID, cpu->getWidth()) > 0)
             {
                 createItem("Width", cpu->getWidth(), cpuItem);
             }
-            if (cpu->getRange().contains(targetID))
+            if (referenceCounter_->countReferencesInExpression(targetID, cpu->getRange()) > 0)
             {
                 createItem("Range", cpu->getRange(), cpuItem);
             }
-            if (cpu->getAddressUnitBits().contains(targetID))
+            if (referenceCounter_->countReferencesInExpression(targetID, cpu->getAddressUnitBits()) > 0)
             {
                 createItem("Address unit bits", cpu->getAddressUnitBits(), cpuItem);
             }
@@ -937,11 +955,11 @@ void ComponentParameterReferenceTree::createItemsForRegion(QSharedPointer<Region
 
     QTreeWidgetItem* regionItem = createMiddleItem(region->name(), parent);
 
-    if (region->getAddressOffset().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, region->getAddressOffset()) > 0)
     {
         createItem("Offset", region->getAddressOffset(), regionItem);
     }
-    if (region->getRange().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, region->getRange()) > 0)
     {
         createItem("Range", region->getRange(), regionItem);
     }
@@ -973,23 +991,23 @@ void ComponentParameterReferenceTree::createItemsForPort(QSharedPointer<Port> po
 {
     QString targetID = getTargetID();
 
-    if (port->getLeftBound().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, port->getLeftBound()) > 0)
     {
         createItem("Left Bound", port->getLeftBound(), parent);
     }
-    if (port->getRightBound().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, port->getRightBound()) > 0)
     {
         createItem("Right Bound", port->getRightBound(), parent);
     }
-    if (port->getDefaultValue().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, port->getDefaultValue()) > 0)
     {
         createItem("Default Value", port->getDefaultValue(), parent);
     }
-    if (port->getArrayLeft().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, port->getArrayLeft()) > 0)
     {
         createItem("Array Left", port->getArrayLeft(), parent);
     }
-    if (port->getArrayRight().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, port->getArrayRight()) > 0)
     {
         createItem("Array Right", port->getArrayRight(), parent);
     }
@@ -1004,7 +1022,7 @@ void ComponentParameterReferenceTree::createItemsForRegister(QSharedPointer<Regi
     QString targetID = getTargetID();
 
     createItemsForBaseRegister(targetRegister, parent);
-    if (targetRegister->getSize().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, targetRegister->getSize()) > 0)
     {
         createItem("Size", targetRegister->getSize(), parent);
     }
@@ -1018,15 +1036,15 @@ void ComponentParameterReferenceTree::createItemsForBaseRegister(QSharedPointer<
 {
     QString targetID = getTargetID();
 
-    if (baseRegister->getAddressOffset().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, baseRegister->getAddressOffset()) > 0)
     {
         createItem("Offset", baseRegister->getAddressOffset(), parent);
     }
-    if (baseRegister->getDimension().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, baseRegister->getDimension()) > 0)
     {
         createItem("Dimension", baseRegister->getDimension(), parent);
     }
-    if (baseRegister->getIsPresent().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, baseRegister->getIsPresent()) > 0)
     {
         createItem("Is present", baseRegister->getIsPresent(), parent);
     }
@@ -1041,7 +1059,7 @@ void ComponentParameterReferenceTree::createItemsForRegisterFile(QSharedPointer<
     QString targetID = getTargetID();
 
     createItemsForBaseRegister(targetFile, parent);
-    if (targetFile->getRange().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, targetFile->getRange()) > 0)
     {
         createItem("Range", targetFile->getRange(), parent);
     }
@@ -1055,7 +1073,7 @@ void ComponentParameterReferenceTree::createItemsForMemoryMap(QSharedPointer<Mem
 {
     QString targetID = getTargetID();
 
-    if (targetMap->getIsPresent().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, targetMap->getIsPresent()) > 0)
     {
         createItem("Is Present", targetMap->getIsPresent(), parent);
     }
@@ -1069,19 +1087,19 @@ void ComponentParameterReferenceTree::createItemsForAddressBlock(QSharedPointer<
 {
     QString targetID = getTargetID();
 
-    if (targetAddressBlock->getBaseAddress().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, targetAddressBlock->getBaseAddress()) > 0)
     {
         createItem("Base Address", targetAddressBlock->getBaseAddress(), parent);
     }
-    if (targetAddressBlock->getRange().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, targetAddressBlock->getRange()) > 0)
     {
         createItem("Range", targetAddressBlock->getRange(), parent);
     }
-    if (targetAddressBlock->getWidth().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, targetAddressBlock->getWidth()) > 0)
     {
         createItem("Width", targetAddressBlock->getWidth(), parent);
     }
-    if (targetAddressBlock->getIsPresent().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, targetAddressBlock->getIsPresent()) > 0)
     {
         createItem("Is Present", targetAddressBlock->getIsPresent(), parent);
     }
@@ -1094,15 +1112,15 @@ void ComponentParameterReferenceTree::createItemsForField(QSharedPointer<Field>
 {
     QString targetID = getTargetID();
 
-    if (targetField->getBitOffset().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, targetField->getBitOffset()) > 0)
     {
         createItem("Offset", targetField->getBitOffset(), parent);
     }
-    if (targetField->getBitWidth().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, targetField->getBitWidth()) > 0)
     {
         createItem("Width", targetField->getBitWidth(), parent);
     }
-    if (targetField->getIsPresent().contains(targetID))
+    if (referenceCounter_->countReferencesInExpression(targetID, targetField->getIsPresent()) > 0)
     {
         createItem("Is Present", targetField->getIsPresent(), parent);
     }
@@ -1113,11 +1131,13 @@ void ComponentParameterReferenceTree::createItemsForField(QSharedPointer<Field>
 
     if (targetField->getWriteConstraint())
     {
-        if (targetField->getWriteConstraint()->getMinimum().contains(targetID))
+        if (referenceCounter_->countReferencesInExpression(targetID,
+            targetField->getWriteConstraint()->getMinimum()) > 0)
         {
             createItem("Write constraint minimum", targetField->getWriteConstraint()->getMinimum(), parent);
         }
-        if (targetField->getWriteConstraint()->getMaximum().contains(targetID))
+        if (referenceCounter_->countReferencesInExpression(targetID,
+            targetField->getWriteConstraint()->getMaximum()) > 0)
         {
             createItem("Write constraint maximum", targetField->getWriteConstraint()->getMaximum(), parent);
         }
@@ -1145,11 +1165,11 @@ void ComponentParameterReferenceTree::createItemsForFieldResets(QString const& t
 
             QTreeWidgetItem* singleResetItem = createMiddleItem(resetType, resetsItem);
 
-            if (singleReset->getResetValue().contains(targetID))
+            if (referenceCounter_->countReferencesInExpression(targetID, singleReset->getResetValue()) > 0)
             {
                 createItem("Reset value", singleReset->getResetValue(), singleResetItem);
             }
-            if (singleReset->getResetMask().contains(targetID))
+            if (referenceCounter_->countReferencesInExpression(targetID, singleReset->getResetMask()) > 0)
             {
                 createItem("Reset mask", singleReset->getResetMask(), singleResetItem);
             }
@@ -126,23 +126,27 @@ QTreeWidgetItem* ParameterReferenceTree::createMiddleItem(QString const& itemnNa
 //-----------------------------------------------------------------------------
 void ParameterReferenceTree::createItemsForParameter(QSharedPointer<Parameter> parameter, QTreeWidgetItem* parent)
 {
-    if (parameter->getValue().contains(targetID_))
+    QSharedPointer<ParameterReferenceCounter> referenceCounter = getReferenceCounter();
+
+    if (referenceCounter->countReferencesInExpression(targetID_, parameter->getValue()) > 0)
     {
         createItem("Value", parameter->getValue(), parent);
     }
-    if (parameter->getVectorLeft().contains(targetID_))
+    if (referenceCounter->countReferencesInExpression(targetID_, parameter->getVectorLeft()) > 0)
     {
         createItem("Bit Width Left", parameter->getVectorLeft(), parent);
     }
-    if (parameter->getVectorRight().contains(targetID_))
+    if (referenceCounter->countReferencesInExpression(targetID_, parameter->getVectorRight()) > 0)
     {
         createItem("Bit Width Right", parameter->getVectorRight(), parent);
     }
-    if (parameter->getAttribute("kactus2:arrayLeft").contains(targetID_))
+    if (referenceCounter->countReferencesInExpression(targetID_,
+        parameter->getAttribute("kactus2:arrayLeft")) > 0)
     {
         createItem("Array Left", parameter->getAttribute("kactus2:arrayLeft"), parent);
     }
-    if (parameter->getAttribute("kactus2:arrayRight").contains(targetID_))
+    if (referenceCounter->countReferencesInExpression(targetID_,
+        parameter->getAttribute("kactus2:arrayRight")) > 0)
     {
         createItem("Array Right", parameter->getAttribute("kactus2:arrayRight"), parent);
     }
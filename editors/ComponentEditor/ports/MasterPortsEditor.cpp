@@ -133,6 +133,7 @@ bool MasterPortsEditor::isValid() const
 //-----------------------------------------------------------------------------
 void MasterPortsEditor::refresh()
 {
+    model_->clearCachedValues();
     proxy_->invalidate();
 }
 
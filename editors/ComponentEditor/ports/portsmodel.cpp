@@ -35,6 +35,16 @@ portsInterface_(portInterface),
 signalInterface_(signalInterface)
 {
     Q_ASSERT(portInterface);
+
+    cellCache_.followModel(this);
+
+    // The locked indexes move along with the rows.
+    auto invalidateLockedCells = [this]() { lockedCellsValid_ = false; };
+    connect(this, &QAbstractItemModel::rowsInserted, this, invalidateLockedCells);
+    connect(this, &QAbstractItemModel::rowsRemoved, this, invalidateLockedCells);
+    connect(this, &QAbstractItemModel::rowsMoved, this, invalidateLockedCells);
+    connect(this, &QAbstractItemModel::layoutChanged, this, invalidateLockedCells);
+    connect(this, &QAbstractItemModel::modelReset, this, invalidateLockedCells);
 }
 
 //-----------------------------------------------------------------------------
@@ -64,7 +74,14 @@ QVariant PortsModel::data(QModelIndex const& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return formattedExpressionForIndex(index);
+            QVariant formattedValue = cellCache_.value(index.row(), index.column(), role);
+            if (!formattedValue.isValid())
+            {
+                formattedValue = formattedExpressionForIndex(index);
+                cellCache_.insert(index.row(), index.column(), role, formattedValue);
+            }
+
+            return formattedValue;
         }
         else if (index.column() == descriptionColumn())
         {
@@ -500,13 +517,15 @@ void PortsModel::resetModelAndLockCurrentPorts()
 
     endResetModel();
 
-    for (auto const& portName : getInterface()->getItemNames())
+    const int portCount = portsInterface_->itemCount();
+    for (int row = 0; row < portCount; ++row)
     {
         DirectionTypes::Direction portDirection = DirectionTypes::str2Direction(QString::fromStdString(
-            portsInterface_->getDirection(portName)), DirectionTypes::DIRECTION_INVALID);
+            portsInterface_->getDirection(portsInterface_->getIndexedItemName(row))),
+            DirectionTypes::DIRECTION_INVALID);
         if (portDirection != DirectionTypes::DIRECTION_PHANTOM)
         {
-            lockPort(QString::fromStdString(portName));
+            lockPort(row);
         }
     }
 
@@ -514,12 +533,20 @@ void PortsModel::resetModelAndLockCurrentPorts()
     emit portCountChanged();
 }
 
+//-----------------------------------------------------------------------------
+// Function: portsmodel::clearCachedValues()
+//-----------------------------------------------------------------------------
+void PortsModel::clearCachedValues()
+{
+    cellCache_.clear();
+}
+
 //-----------------------------------------------------------------------------
 // Function: lockPort()
 //-----------------------------------------------------------------------------
-void PortsModel::lockPort(QString const& portName)
+void PortsModel::lockPort(int row)
 {
-    QModelIndex portIndex = index(portName);
+    QModelIndex portIndex = QAbstractTableModel::index(row, 0, QModelIndex());
     QModelIndexList lockedPortIndexes = getLockedPortIndexes(portIndex);
 
     for (auto const& index : lockedPortIndexes)
@@ -555,6 +582,7 @@ void PortsModel::lockIndex(QModelIndex const& index)
     if(!isLocked(index))
     {
         lockedIndexes_.append(QPersistentModelIndex(index));
+        lockedCells_.insert(qMakePair(index.row(), index.column()));
     }
 }
 
@@ -564,6 +592,7 @@ void PortsModel::lockIndex(QModelIndex const& index)
 void PortsModel::unlockIndex(QModelIndex const& index)
 {
     lockedIndexes_.removeAll(QPersistentModelIndex(index));
+    lockedCells_.remove(qMakePair(index.row(), index.column()));
 }
 
 //-----------------------------------------------------------------------------
@@ -571,7 +600,21 @@ void PortsModel::unlockIndex(QModelIndex const& index)
 //-----------------------------------------------------------------------------
 bool PortsModel::isLocked(QModelIndex const& index) const
 {
-    return lockedIndexes_.contains(QPersistentModelIndex(index));
+    if (!lockedCellsValid_)
+    {
+        lockedCells_.clear();
+        for (auto const& lockedIndex : lockedIndexes_)
+        {
+            if (lockedIndex.isValid())
+            {
+                lockedCells_.insert(qMakePair(lockedIndex.row(), lockedIndex.column()));
+            }
+        }
+
+        lockedCellsValid_ = true;
+    }
+
+    return index.model() == this && lockedCells_.contains(qMakePair(index.row(), index.column()));
 }
 
 //-----------------------------------------------------------------------------
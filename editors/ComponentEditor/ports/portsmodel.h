@@ -16,12 +16,14 @@
 #include <QString>
 #include <QList>
 
+#include <editors/ComponentEditor/common/CellValueCache.h>
 #include <editors/ComponentEditor/common/ParameterizableTable.h>
 #include <editors/ComponentEditor/common/ReferencingTableModel.h>
 
 #include <IPXACTmodels/generaldeclarations.h>
 #include <IPXACTmodels/common/DirectionTypes.h>
 
+#include <QSet>
 #include <QSortFilterProxyModel>
 
 class AbstractionDefinition;
@@ -126,6 +128,11 @@ public:
      */
     void resetModelAndLockCurrentPorts();
 
+    /*!
+     *  Discard the cached display values of the ports, e.g. when the referenced parameters may have changed.
+     */
+    void clearCachedValues();
+
     /*!
      *  Handle port creation from abstraction definition signals.
      *
@@ -403,9 +410,9 @@ private:
     /*!
      *   Locks the name, direction  and type columns of a port.
      *
-     *    @param [in] portName    Name of the selected port.
+     *    @param [in] row     The row of the selected port.
      */
-    void lockPort(QString const& portName);
+    void lockPort(int row);
 
     /*!
      *   Unlocks the name, direction and type columns of a port.
@@ -483,6 +490,15 @@ private:
 
     //! The locked indexes that cannot be edited.
     QList<QPersistentModelIndex> lockedIndexes_;
+
+    //! The row and column of the locked indexes for fast lookup.
+    mutable QSet<QPair<int, int> > lockedCells_;
+
+    //! Flag for the locked cells matching the current rows of the locked indexes.
+    mutable bool lockedCellsValid_ = false;
+
+    //! The display values of the expression cells.
+    mutable CellValueCache cellCache_;
 };
 
 #endif // PORTSMODEL_H
@@ -43,6 +43,348 @@
 
 #include <KactusAPI/include/AbstractParameterInterface.h>
 
+namespace
+{
+    using ReferenceIndex = ParameterReferenceCounter::ReferenceIndex;
+
+    //-----------------------------------------------------------------------------
+    // Function: decreaseInIndex()
+    //-----------------------------------------------------------------------------
+    void decreaseInIndex(QString const& id, ReferenceIndex& references)
+    {
+        auto entry = references.find(id);
+        if (entry != references.end() && --entry.value() <= 0)
+        {
+            references.erase(entry);
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferences()
+    //-----------------------------------------------------------------------------
+    void collectReferences(QString const& expression, ReferenceIndex& references)
+    {
+        ParameterReferenceCounter::collectReferencesInExpression(expression, references);
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInFileBuilders()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInFileBuilders(QSharedPointer<QList<QSharedPointer<FileBuilder> > > builders,
+        ReferenceIndex& references)
+    {
+        for (QSharedPointer<FileBuilder> fileBuilder : *builders)
+        {
+            collectReferences(fileBuilder->getReplaceDefaultFlags(), references);
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInFileSets()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInFileSets(QSharedPointer<QList<QSharedPointer<FileSet> > > fileSets,
+        ReferenceIndex& references)
+    {
+        for (QSharedPointer<FileSet> fileSet : *fileSets)
+        {
+            collectReferencesInFileBuilders(fileSet->getDefaultFileBuilders(), references);
+
+            for (QSharedPointer<File> singleFile : *fileSet->getFiles())
+            {
+                if (singleFile->getBuildCommand())
+                {
+                    collectReferences(singleFile->getBuildCommand()->getReplaceDefaultFlags(), references);
+                }
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInFields()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInFields(QSharedPointer<QList<QSharedPointer<Field> > > fields,
+        ReferenceIndex& references)
+    {
+        for (QSharedPointer<Field> registerField : *fields)
+        {
+            collectReferences(registerField->getBitOffset(), references);
+            collectReferences(registerField->getBitWidth(), references);
+            collectReferences(registerField->getIsPresent(), references);
+
+            for (auto const& fieldReset : *registerField->getResets())
+            {
+                collectReferences(fieldReset->getResetValue(), references);
+                collectReferences(fieldReset->getResetMask(), references);
+            }
+
+            if (auto writeConstraint = registerField->getWriteConstraint(); writeConstraint)
+            {
+                collectReferences(writeConstraint->getMinimum(), references);
+                collectReferences(writeConstraint->getMaximum(), references);
+            }
+
+            for (auto const& accessPolicy : *registerField->getFieldAccessPolicies())
+            {
+                collectReferences(accessPolicy->getReadResponse(), references);
+                collectReferences(accessPolicy->getReserved(), references);
+
+                if (auto writeValueConstraint = accessPolicy->getWriteValueConstraint(); writeValueConstraint)
+                {
+                    collectReferences(writeValueConstraint->getMinimum(), references);
+                    collectReferences(writeValueConstraint->getMaximum(), references);
+                }
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInRegisterData()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInRegisterData(QSharedPointer<QList<QSharedPointer<RegisterBase> > > registerData,
+        ReferenceIndex& references)
+    {
+        for (QSharedPointer<RegisterBase> baseRegister : *registerData)
+        {
+            collectReferences(baseRegister->getAddressOffset(), references);
+            collectReferences(baseRegister->getDimension(), references);
+            collectReferences(baseRegister->getIsPresent(), references);
+
+            if (QSharedPointer<Register> targetRegister = baseRegister.dynamicCast<Register>(); targetRegister)
+            {
+                collectReferences(targetRegister->getSize(), references);
+                collectReferencesInFields(targetRegister->getFields(), references);
+            }
+            else if (QSharedPointer<RegisterFile> targetFile = baseRegister.dynamicCast<RegisterFile>();
+                targetFile)
+            {
+                collectReferences(targetFile->getRange(), references);
+                collectReferencesInRegisterData(targetFile->getRegisterData(), references);
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInBaseMemoryMap()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInBaseMemoryMap(QSharedPointer<MemoryMapBase> memoryMap, ReferenceIndex& references)
+    {
+        collectReferences(memoryMap->getIsPresent(), references);
+
+        for (QSharedPointer<MemoryBlockBase> memoryBlock : *memoryMap->getMemoryBlocks())
+        {
+            if (QSharedPointer<AddressBlock> addressBlock = memoryBlock.dynamicCast<AddressBlock>(); addressBlock)
+            {
+                collectReferences(addressBlock->getBaseAddress(), references);
+                collectReferences(addressBlock->getRange(), references);
+                collectReferences(addressBlock->getWidth(), references);
+                collectReferences(addressBlock->getIsPresent(), references);
+                collectReferencesInRegisterData(addressBlock->getRegisterData(), references);
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInMemoryMaps()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInMemoryMaps(QSharedPointer<QList<QSharedPointer<MemoryMap> > > memoryMaps,
+        ReferenceIndex& references)
+    {
+        for (QSharedPointer<MemoryMap> memoryMap : *memoryMaps)
+        {
+            collectReferencesInBaseMemoryMap(memoryMap, references);
+
+            for (QSharedPointer<MemoryRemap> remap : *memoryMap->getMemoryRemaps())
+            {
+                collectReferencesInBaseMemoryMap(remap, references);
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInAddressSpaces()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInAddressSpaces(QSharedPointer<QList<QSharedPointer<AddressSpace> > > spaces,
+        ReferenceIndex& references)
+    {
+        for (QSharedPointer<AddressSpace> space : *spaces)
+        {
+            collectReferences(space->getWidth(), references);
+            collectReferences(space->getRange(), references);
+
+            if (space->getLocalMemoryMap())
+            {
+                collectReferencesInBaseMemoryMap(space->getLocalMemoryMap(), references);
+            }
+
+            for (QSharedPointer<Segment> segment : *space->getSegments())
+            {
+                collectReferences(segment->getAddressOffset(), references);
+                collectReferences(segment->getRange(), references);
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInVLNVReference()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInVLNVReference(QSharedPointer<ConfigurableVLNVReference> reference,
+        ReferenceIndex& references)
+    {
+        if (reference && reference->isValid())
+        {
+            ParameterReferenceCounter::collectReferencesInConfigurableElementValues(
+                reference->getConfigurableElementValues(), references);
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInInstantiations()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInInstantiations(QSharedPointer<Component> component, ReferenceIndex& references)
+    {
+        for (QSharedPointer<ComponentInstantiation> instantiation : *component->getComponentInstantiations())
+        {
+            for (QSharedPointer<ModuleParameter> moduleParameter : *instantiation->getModuleParameters())
+            {
+                ParameterReferenceCounter::collectReferencesInSingleParameter(moduleParameter, references);
+            }
+
+            ParameterReferenceCounter::collectReferencesInParameters(instantiation->getParameters(), references);
+            collectReferencesInFileBuilders(instantiation->getDefaultFileBuilders(), references);
+        }
+
+        for (QSharedPointer<DesignConfigurationInstantiation> instantiation :
+            *component->getDesignConfigurationInstantiations())
+        {
+            ParameterReferenceCounter::collectReferencesInParameters(instantiation->getParameters(), references);
+            collectReferencesInVLNVReference(instantiation->getDesignConfigurationReference(), references);
+        }
+
+        for (QSharedPointer<DesignInstantiation> instantiation : *component->getDesignInstantiations())
+        {
+            collectReferencesInVLNVReference(instantiation->getDesignReference(), references);
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInPorts()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInPorts(QSharedPointer<QList<QSharedPointer<Port> > > ports, ReferenceIndex& references)
+    {
+        for (QSharedPointer<Port> port : *ports)
+        {
+            collectReferences(port->getLeftBound(), references);
+            collectReferences(port->getRightBound(), references);
+            collectReferences(port->getArrayLeft(), references);
+            collectReferences(port->getArrayRight(), references);
+            collectReferences(port->getDefaultValue(), references);
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInBusInterfaces()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInBusInterfaces(QSharedPointer<QList<QSharedPointer<BusInterface> > > busInterfaces,
+        ReferenceIndex& references)
+    {
+        for (QSharedPointer<BusInterface> busInterface : *busInterfaces)
+        {
+            ParameterReferenceCounter::collectReferencesInParameters(busInterface->getParameters(), references);
+
+            if (QSharedPointer<MirroredTargetInterface> mirroredSlave = busInterface->getMirroredSlave();
+                mirroredSlave)
+            {
+                collectReferences(mirroredSlave->getRange(), references);
+
+                for (auto const& remapAddress : *mirroredSlave->getRemapAddresses())
+                {
+                    collectReferences(remapAddress->remapAddress_, references);
+                }
+            }
+
+            if (QSharedPointer<InitiatorInterface> master = busInterface->getMaster(); master)
+            {
+                collectReferences(master->getBaseAddress(), references);
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInRemapStates()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInRemapStates(QSharedPointer<QList<QSharedPointer<RemapState> > > remapStates,
+        ReferenceIndex& references)
+    {
+        for (QSharedPointer<RemapState> remapState : *remapStates)
+        {
+            for (QSharedPointer<RemapPort> port : *remapState->getRemapPorts())
+            {
+                collectReferences(port->getValue(), references);
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInModes()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInModes(QSharedPointer<QList<QSharedPointer<Mode> > > modes, ReferenceIndex& references)
+    {
+        for (auto const& mode : *modes)
+        {
+            collectReferences(mode->getCondition(), references);
+
+            for (auto const& slice : *mode->getPortSlices())
+            {
+                collectReferences(slice->getLeftRange(), references);
+                collectReferences(slice->getRightRange(), references);
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInIndirectInterfaces()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInIndirectInterfaces(
+        QSharedPointer<QList<QSharedPointer<IndirectInterface> > > indirectInterfaces, ReferenceIndex& references)
+    {
+        for (auto const& singleInterface : *indirectInterfaces)
+        {
+            ParameterReferenceCounter::collectReferencesInParameters(singleInterface->getParameters(), references);
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInCpus()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInCpus(QSharedPointer<QList<QSharedPointer<Cpu> > > cpus, ReferenceIndex& references)
+    {
+        for (auto const& singleCpu : *cpus)
+        {
+            collectReferences(singleCpu->getRange(), references);
+            collectReferences(singleCpu->getWidth(), references);
+            collectReferences(singleCpu->getAddressUnitBits(), references);
+
+            for (auto const& region : *singleCpu->getRegions())
+            {
+                collectReferences(region->getAddressOffset(), references);
+                collectReferences(region->getRange(), references);
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: collectReferencesInPowerDomains()
+    //-----------------------------------------------------------------------------
+    void collectReferencesInPowerDomains(QSharedPointer<QList<QSharedPointer<PowerDomain> > > powerDomains,
+        ReferenceIndex& references)
+    {
+        for (auto const& domain : *powerDomains)
+        {
+            collectReferences(domain->getAlwaysOn(), references);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentParameterReferenceCounter::ComponentParameterReferenceCounter()
 //-----------------------------------------------------------------------------
@@ -60,6 +402,125 @@ component_(component)
 void ComponentParameterReferenceCounter::setComponent(QSharedPointer<Component> newComponent)
 {
     component_ = newComponent;
+    invalidateReferenceIndex();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::invalidateReferenceIndex()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::invalidateReferenceIndex()
+{
+    referenceIndex_.clear();
+    areaIndexes_.clear();
+    referenceIndexValid_ = false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::rebuildReferenceIndex()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::rebuildReferenceIndex()
+{
+    invalidateReferenceIndex();
+
+    if (component_.isNull())
+    {
+        return;
+    }
+
+    // A single pass over every expression in the component, collecting all the referenced ids at once.
+    areaIndexes_.resize(AREA_COUNT);
+    for (int area = 0; area < AREA_COUNT; ++area)
+    {
+        collectReferencesInArea(static_cast<ReferenceArea>(area), areaIndexes_[area]);
+
+        for (auto reference = areaIndexes_.at(area).cbegin(); reference != areaIndexes_.at(area).cend();
+            ++reference)
+        {
+            referenceIndex_[reference.key()] += reference.value();
+        }
+    }
+
+    referenceIndexValid_ = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::countReferencesInComponent()
+//-----------------------------------------------------------------------------
+int ComponentParameterReferenceCounter::countReferencesInComponent(QString const& parameterID)
+{
+    if (referenceIndexValid_ == false)
+    {
+        rebuildReferenceIndex();
+    }
+
+    return referenceIndex_.value(parameterID);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::countReferencesInArea()
+//-----------------------------------------------------------------------------
+int ComponentParameterReferenceCounter::countReferencesInArea(QString const& parameterID, ReferenceArea area)
+{
+    if (referenceIndexValid_ == false)
+    {
+        rebuildReferenceIndex();
+    }
+
+    if (area < 0 || area >= areaIndexes_.size())
+    {
+        return 0;
+    }
+
+    return areaIndexes_.at(area).value(parameterID);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::increaseReferenceCount()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::increaseReferenceCount(QString const& id)
+{
+    ParameterReferenceCounter::increaseReferenceCount(id);
+
+    // The area of the change is not known, so the index is rebuilt on the next query.
+    invalidateReferenceIndex();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::decreaseReferenceCount()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::decreaseReferenceCount(QString const& id)
+{
+    ParameterReferenceCounter::decreaseReferenceCount(id);
+
+    invalidateReferenceIndex();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::increaseReferenceCountInArea()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::increaseReferenceCountInArea(QString const& id, ReferenceArea area)
+{
+    ParameterReferenceCounter::increaseReferenceCount(id);
+
+    if (referenceIndexValid_ && area >= 0 && area < areaIndexes_.size())
+    {
+        ++referenceIndex_[id];
+        ++areaIndexes_[area][id];
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::decreaseReferenceCountInArea()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::decreaseReferenceCountInArea(QString const& id, ReferenceArea area)
+{
+    ParameterReferenceCounter::decreaseReferenceCount(id);
+
+    if (referenceIndexValid_ && area >= 0 && area < areaIndexes_.size())
+    {
+        decreaseInIndex(id, referenceIndex_);
+        decreaseInIndex(id, areaIndexes_[area]);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -68,30 +529,68 @@ void ComponentParameterReferenceCounter::setComponent(QSharedPointer<Component>
 void ComponentParameterReferenceCounter::recalculateReferencesToParameters(QVector<QString> const& parameterList,
     AbstractParameterInterface* parameterInterface)
 {
+    // Recalculation is the point where the index is resynchronized with the component.
+    rebuildReferenceIndex();
+
     for (auto parameterName : parameterList)
     {
-        int referenceCount = 0;
         QString parameterID = QString::fromStdString(parameterInterface->getID(parameterName.toStdString()));
         if (!parameterID.isEmpty())
         {
-            referenceCount += countReferencesInFileSets(parameterID);
-            referenceCount += countReferencesInParameters(parameterID, component_->getParameters());
-            referenceCount += countReferencesInMemoryMaps(parameterID);
-            referenceCount += countReferencesInAddressSpaces(parameterID);
-            referenceCount += countReferencesInInstantiations(parameterID);
-            referenceCount += countReferencesInPorts(parameterID);
-            referenceCount += countReferencesInBusInterfaces(parameterID);
-            referenceCount += countReferencesInRemapStates(parameterID);
-            referenceCount += countReferencesInModes(parameterID);
-            referenceCount += countReferencesInIndirectInterfaces(parameterID);
-            referenceCount += countReferencesInCpus(parameterID);
-            referenceCount += countReferencesInPowerDomains(parameterID);
-
-            parameterInterface->setUsageCount(parameterName.toStdString(), referenceCount);
+            parameterInterface->setUsageCount(parameterName.toStdString(), referenceIndex_.value(parameterID));
         }
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectReferencesInArea()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectReferencesInArea(ReferenceArea area,
+    ReferenceIndex& references) const
+{
+    switch (area)
+    {
+    case FILE_SETS:
+        collectReferencesInFileSets(component_->getFileSets(), references);
+        break;
+    case PARAMETERS:
+        collectReferencesInParameters(component_->getParameters(), references);
+        break;
+    case MEMORY_MAPS:
+        collectReferencesInMemoryMaps(component_->getMemoryMaps(), references);
+        break;
+    case ADDRESS_SPACES:
+        collectReferencesInAddressSpaces(component_->getAddressSpaces(), references);
+        break;
+    case INSTANTIATIONS:
+        collectReferencesInInstantiations(component_, references);
+        break;
+    case PORTS:
+        collectReferencesInPorts(component_->getPorts(), references);
+        break;
+    case BUS_INTERFACES:
+        collectReferencesInBusInterfaces(component_->getBusInterfaces(), references);
+        break;
+    case REMAP_STATES:
+        collectReferencesInRemapStates(component_->getRemapStates(), references);
+        break;
+    case MODES:
+        collectReferencesInModes(component_->getModes(), references);
+        break;
+    case INDIRECT_INTERFACES:
+        collectReferencesInIndirectInterfaces(component_->getIndirectInterfaces(), references);
+        break;
+    case CPUS:
+        collectReferencesInCpus(component_->getCpus(), references);
+        break;
+    case POWER_DOMAINS:
+        collectReferencesInPowerDomains(component_->getPowerDomains(), references);
+        break;
+    default:
+        break;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentParameterReferenceCounter::countReferencesInFileSets()
 //-----------------------------------------------------------------------------
@@ -512,7 +1011,7 @@ int ComponentParameterReferenceCounter::countReferencesInSingleMode(QString cons
 int ComponentParameterReferenceCounter::countReferencesInModeCondition(QString const& parameterID,
     QString const& condition) const
 {
-    return condition.count(parameterID);
+    return countReferencesInExpression(parameterID, condition);
 }
 
 //-----------------------------------------------------------------------------
@@ -551,8 +1050,8 @@ int ComponentParameterReferenceCounter::countReferencesInSinglePortSlice(QString
     QSharedPointer<PortSlice> portSlice) const
 {
     int referenceCount = 0;
-    referenceCount += portSlice->getLeftRange().count(parameterID);
-    referenceCount += portSlice->getRightRange().count(parameterID);
+    referenceCount += countReferencesInExpression(parameterID, portSlice->getLeftRange());
+    referenceCount += countReferencesInExpression(parameterID, portSlice->getRightRange());
     return referenceCount;
 }
 
@@ -563,8 +1062,8 @@ int ComponentParameterReferenceCounter::countReferencesInSingleFieldSlice(QStrin
     QSharedPointer<FieldSlice> fieldSlice) const
 {
     int referenceCount = 0;
-    referenceCount += fieldSlice->getLeft().count(parameterID);
-    referenceCount += fieldSlice->getRight().count(parameterID);
+    referenceCount += countReferencesInExpression(parameterID, fieldSlice->getLeft());
+    referenceCount += countReferencesInExpression(parameterID, fieldSlice->getRight());
     return referenceCount;
 }
 
@@ -16,6 +16,8 @@
 
 #include <IPXACTmodels/Component/MirroredTargetInterface.h>
 
+#include <QVector>
+
 class Component;
 class Cpu;
 class FileBuilder;
@@ -60,6 +62,24 @@ class ComponentParameterReferenceCounter : public ParameterReferenceCounter
 
 public:
 
+    //! The areas of the component the references are indexed by.
+    enum ReferenceArea
+    {
+        FILE_SETS = 0,
+        PARAMETERS,
+        MEMORY_MAPS,
+        ADDRESS_SPACES,
+        INSTANTIATIONS,
+        PORTS,
+        BUS_INTERFACES,
+        REMAP_STATES,
+        MODES,
+        INDIRECT_INTERFACES,
+        CPUS,
+        POWER_DOMAINS,
+        AREA_COUNT
+    };
+
     /*!
      *  The constructor.
      *
@@ -85,6 +105,32 @@ public:
      */
     void setComponent(QSharedPointer<Component> newComponent);
 
+    /*!
+     *  Rebuild the index of references made in the component in a single pass over all its expressions.
+     */
+    void rebuildReferenceIndex();
+
+    /*!
+     *  Get the amount of references made to the selected parameter anywhere in the component.
+     *  The value is read from the reference index, which is built only if it has been invalidated.
+     *
+     *    @param [in] parameterID     ID of the selected parameter.
+     *
+     *    @return The amount of references made to the selected parameter in the component.
+     */
+    int countReferencesInComponent(QString const& parameterID);
+
+    /*!
+     *  Get the amount of references made to the selected parameter in the selected area of the component.
+     *  The value is read from the reference index, which is built only if it has been invalidated.
+     *
+     *    @param [in] parameterID     ID of the selected parameter.
+     *    @param [in] area            The selected component area.
+     *
+     *    @return The amount of references made to the selected parameter in the selected area.
+     */
+    int countReferencesInArea(QString const& parameterID, ReferenceArea area);
+
     /*!
      *  Count the references made to the selected parameter in the file sets.
      *
@@ -718,6 +764,20 @@ public:
 
 public slots:
 
+    /*!
+     *  Increase the reference count of the parameter matching the id.
+     *
+     *    @param [in] id      The id of the parameter which is being referenced.
+     */
+    virtual void increaseReferenceCount(QString const& id) override final;
+
+    /*!
+     *  Decrease the reference count of the parameter matching the id.
+     *
+     *    @param [in] id      The id of the parameter which was referenced.
+     */
+    virtual void decreaseReferenceCount(QString const& id) override final;
+
     /*!
      *  Recalculate references made to the selected parameters.
      *
@@ -727,8 +787,39 @@ public slots:
     virtual void recalculateReferencesToParameters(QVector<QString> const& parameterList,
         AbstractParameterInterface* parameterInterface) override final;
 
+    /*!
+     *  Invalidate the reference index, so that it is rebuilt from the component on the next query.
+     */
+    void invalidateReferenceIndex();
+
+    /*!
+     *  Increase the reference count of the parameter matching the id after a change in the selected area.
+     *  Only the references of the area are updated in the reference index.
+     *
+     *    @param [in] id      The id of the parameter which is being referenced.
+     *    @param [in] area    The component area containing the changed expression.
+     */
+    void increaseReferenceCountInArea(QString const& id, ReferenceArea area);
+
+    /*!
+     *  Decrease the reference count of the parameter matching the id after a change in the selected area.
+     *  Only the references of the area are updated in the reference index.
+     *
+     *    @param [in] id      The id of the parameter which was referenced.
+     *    @param [in] area    The component area containing the changed expression.
+     */
+    void decreaseReferenceCountInArea(QString const& id, ReferenceArea area);
+
 private:
 
+    /*!
+     *  Collect the references made in the selected area of the component.
+     *
+     *    @param [in] area            The selected component area.
+     *    @param [in/out] references  The index to add the references to.
+     */
+    void collectReferencesInArea(ReferenceArea area, ReferenceIndex& references) const;
+
     /*!
      *  Count the references made to the selected parameter in the selected write constraint.
      *
@@ -747,6 +838,14 @@ private:
     //! The containing component.
     QSharedPointer<Component> component_;
 
+    //! The references made in the component, kept up to date with the reference count changes.
+    ReferenceIndex referenceIndex_;
+
+    //! The references made in each area of the component, indexed by ReferenceArea.
+    QVector<ReferenceIndex> areaIndexes_;
+
+    //! Flag for the reference index being built for the current component.
+    bool referenceIndexValid_ = false;
 };
 
 #endif // COMPONENTPARAMETERREFERENCECOUNTER_H
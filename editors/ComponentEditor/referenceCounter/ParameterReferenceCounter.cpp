@@ -15,6 +15,7 @@
 #include <IPXACTmodels/common/ConfigurableElementValue.h>
 
 #include <KactusAPI/include/AbstractParameterInterface.h>
+#include <KactusAPI/include/SystemVerilogExpressionParser.h>
 
 //-----------------------------------------------------------------------------
 // Function: ParameterReferenceCounter::ParameterReferenceCounter()
@@ -117,7 +118,68 @@ int ParameterReferenceCounter::countReferencesInSingleConfigurableElementValue(Q
 int ParameterReferenceCounter::countReferencesInExpression(QString const& parameterID,
     QString const& expression) const
 {
-    return expression.count(parameterID);
+    // Only whole symbols are references, so that an id inside a longer identifier is not counted.
+    int referenceCount = 0;
+
+    for (QStringView const& symbol : SystemVerilogExpressionParser::findSymbols(expression))
+    {
+        if (symbol == parameterID)
+        {
+            ++referenceCount;
+        }
+    }
+
+    return referenceCount;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::collectReferencesInParameters()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::collectReferencesInParameters(
+    QSharedPointer<QList<QSharedPointer<Parameter> > > parameters, ReferenceIndex& references)
+{
+    for (QSharedPointer<Parameter> singleParameter : *parameters)
+    {
+        collectReferencesInSingleParameter(singleParameter, references);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::collectReferencesInSingleParameter()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::collectReferencesInSingleParameter(QSharedPointer<Parameter> parameter,
+    ReferenceIndex& references)
+{
+    collectReferencesInExpression(parameter->getValue(), references);
+    collectReferencesInExpression(parameter->getVectorLeft(), references);
+    collectReferencesInExpression(parameter->getVectorRight(), references);
+    collectReferencesInExpression(parameter->getAttribute(QLatin1String("kactus2:arrayLeft")), references);
+    collectReferencesInExpression(parameter->getAttribute(QLatin1String("kactus2:arrayRight")), references);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::collectReferencesInConfigurableElementValues()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::collectReferencesInConfigurableElementValues(
+    QSharedPointer<QList<QSharedPointer<ConfigurableElementValue> > > configurableElements,
+    ReferenceIndex& references)
+{
+    for (QSharedPointer<ConfigurableElementValue> element : *configurableElements)
+    {
+        collectReferencesInExpression(element->getConfigurableValue(), references);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::collectReferencesInExpression()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::collectReferencesInExpression(QString const& expression,
+    ReferenceIndex& references)
+{
+    for (QStringView const& symbol : SystemVerilogExpressionParser::findSymbols(expression))
+    {
+        ++references[symbol.toString()];
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -126,39 +188,36 @@ int ParameterReferenceCounter::countReferencesInExpression(QString const& parame
 void ParameterReferenceCounter::recalculateReferencesToParameters(QVector<QString> const& parameterList,
     AbstractParameterInterface* parameterInterface)
 {
+    ReferenceIndex references;
+    collectReferencesInInterfacedParameters(parameterInterface, references);
+
     for (auto parameterName : parameterList)
     {
         QString parameterID = QString::fromStdString(parameterInterface->getID(parameterName.toStdString()));
         if (!parameterID.isEmpty())
         {
-            int referenceCount = countReferencesInInterfacedParameters(parameterID, parameterInterface);
-
-            parameterInterface->setUsageCount(parameterName.toStdString(), referenceCount);
+            parameterInterface->setUsageCount(parameterName.toStdString(), references.value(parameterID));
         }
     }
 }
 
 //-----------------------------------------------------------------------------
-// Function: ParameterReferenceCounter::countReferencesInInterfacedParameters()
+// Function: ParameterReferenceCounter::collectReferencesInInterfacedParameters()
 //-----------------------------------------------------------------------------
-int ParameterReferenceCounter::countReferencesInInterfacedParameters(QString const& parameterID,
-    AbstractParameterInterface* parameterInterface) const
+void ParameterReferenceCounter::collectReferencesInInterfacedParameters(
+    AbstractParameterInterface* parameterInterface, ReferenceIndex& references)
 {
-    int referenceCount = 0;
-
     for (auto parameter : parameterInterface->getItemNames())
     {
-        referenceCount += countReferencesInExpression(
-            parameterID, QString::fromStdString(parameterInterface->getValueExpression(parameter)));
-        referenceCount += countReferencesInExpression(
-            parameterID, QString::fromStdString(parameterInterface->getBitWidthLeftExpression(parameter)));
-        referenceCount += countReferencesInExpression(
-            parameterID, QString::fromStdString(parameterInterface->getBitWidthRightExpression(parameter)));
-        referenceCount += countReferencesInExpression(
-            parameterID, QString::fromStdString(parameterInterface->getArrayLeftExpression(parameter)));
-        referenceCount += countReferencesInExpression(
-            parameterID, QString::fromStdString(parameterInterface->getArrayRightExpression(parameter)));
+        collectReferencesInExpression(
+            QString::fromStdString(parameterInterface->getValueExpression(parameter)), references);
+        collectReferencesInExpression(
+            QString::fromStdString(parameterInterface->getBitWidthLeftExpression(parameter)), references);
+        collectReferencesInExpression(
+            QString::fromStdString(parameterInterface->getBitWidthRightExpression(parameter)), references);
+        collectReferencesInExpression(
+            QString::fromStdString(parameterInterface->getArrayLeftExpression(parameter)), references);
+        collectReferencesInExpression(
+            QString::fromStdString(parameterInterface->getArrayRightExpression(parameter)), references);
     }
-
-    return referenceCount;
 }
@@ -17,6 +17,8 @@
 #include <KactusAPI/include/ComponentParameterFinder.h>
 #include <KactusAPI/include/ParameterFinder.h>
 
+#include <QHash>
+
 class ConfigurableElementValue;
 class AbstractParameterInterface;
 
@@ -29,6 +31,9 @@ class ParameterReferenceCounter : public ReferenceCounter
 
 public:
 
+    //! Reference counts keyed by the referenced id.
+    using ReferenceIndex = QHash<QString, int>;
+
     /*!
      *  The constructor.
      *
@@ -93,7 +98,8 @@ public:
         QSharedPointer<ConfigurableElementValue> element) const;
     
     /*!
-     *  Count the references made to the selected parameter in the selected expression.
+     *  Count the references made to the selected parameter in the selected expression. Only whole ids are
+     *  counted, so the ID is not found inside a longer identifier.
      *
      *    @param [in] parameterID     ID of the selected parameter.
      *    @param [in] expression      The selected expression.
@@ -102,6 +108,41 @@ public:
      */
     int countReferencesInExpression(QString const& parameterID, QString const& expression) const;
 
+    /*!
+     *  Collect the references made in the selected parameters.
+     *
+     *    @param [in] parameters      The selected parameters.
+     *    @param [in/out] references  The index to add the references to.
+     */
+    static void collectReferencesInParameters(QSharedPointer<QList<QSharedPointer<Parameter> > > parameters,
+        ReferenceIndex& references);
+
+    /*!
+     *  Collect the references made in the selected parameter.
+     *
+     *    @param [in] parameter       The selected parameter.
+     *    @param [in/out] references  The index to add the references to.
+     */
+    static void collectReferencesInSingleParameter(QSharedPointer<Parameter> parameter, ReferenceIndex& references);
+
+    /*!
+     *  Collect the references made in the selected configurable element values.
+     *
+     *    @param [in] configurableElements    The selected configurable element values.
+     *    @param [in/out] references          The index to add the references to.
+     */
+    static void collectReferencesInConfigurableElementValues(
+        QSharedPointer<QList<QSharedPointer<ConfigurableElementValue> > > configurableElements,
+        ReferenceIndex& references);
+
+    /*!
+     *  Collect the ids referenced in the selected expression.
+     *
+     *    @param [in] expression      The selected expression.
+     *    @param [in/out] references  The index to add the references to.
+     */
+    static void collectReferencesInExpression(QString const& expression, ReferenceIndex& references);
+
 public slots:
 
     /*!
@@ -130,15 +171,13 @@ public slots:
 private:
 
     /*!
-     *  Count references made in the selected parameter interface to the selected ID.
+     *  Collect the references made in the parameters of the selected parameter interface.
      *
-     *    @param [in] parameterID         The selected parameter ID.
      *    @param [in] parameterInterface  Interface for accessing parameters.
-     *
-     *    @return The number of references made.
+     *    @param [in/out] references      The index to add the references to.
      */
-    int countReferencesInInterfacedParameters(QString const& parameterID,
-        AbstractParameterInterface* parameterInterface) const;
+    static void collectReferencesInInterfacedParameters(AbstractParameterInterface* parameterInterface,
+        ReferenceIndex& references);
 
     //-----------------------------------------------------------------------------
     // Data.
@@ -41,6 +41,7 @@ busInterface_(busInterface)
     setParameterFinder(parameterFinder);
     setExpressionFormatter(expressionFormatter);
     setReferenceCounter(referenceCounter);
+    setReferenceArea(ComponentParameterReferenceCounter::INDIRECT_INTERFACES);
 
     for (QSharedPointer<IndirectInterface> indirectInterface : *indirectInterfaces_)
     {
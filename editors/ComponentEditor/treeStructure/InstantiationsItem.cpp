@@ -60,6 +60,7 @@ componentInstantiationInterface_()
     setObjectName(tr("InstantiationsItem"));
 
     setReferenceCounter(referenceCounter);
+    setReferenceArea(ComponentParameterReferenceCounter::INSTANTIATIONS);
 
     constructInterfaces();
 
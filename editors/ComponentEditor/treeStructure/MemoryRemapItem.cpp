@@ -267,6 +267,12 @@ void MemoryRemapItem::removeChild(int index)
 //-----------------------------------------------------------------------------
 ItemVisualizer* MemoryRemapItem::visualizer()
 {
+    // The graphics for the whole remap are created only when the remap or its contents are first shown.
+    if (!visualizer_)
+    {
+        setVisualizer(new MemoryMapsVisualizer());
+    }
+
     return visualizer_;
 }
 
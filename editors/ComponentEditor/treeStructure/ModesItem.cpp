@@ -40,6 +40,7 @@ modesValidator_(new HierarchicalValidator())
     setParameterFinder(expressions.finder);
     setExpressionFormatter(expressions.formatter);
     setReferenceCounter(referenceCounter);
+    setReferenceArea(ComponentParameterReferenceCounter::MODES);
 
     modesValidator_->setChildValidator(modeValidator_);
 
@@ -31,6 +31,7 @@ ComponentEditorItem(model, libHandler, component, parent),
 {
 
     setReferenceCounter(referenceCounter);
+    setReferenceArea(ComponentParameterReferenceCounter::POWER_DOMAINS);
 }
 
 
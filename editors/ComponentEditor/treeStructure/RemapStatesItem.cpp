@@ -34,6 +34,7 @@ validator_(new RemapStateValidator(expressionParser, component->getPorts()))
     setParameterFinder(parameterFinder);
     setExpressionFormatter(expressionFormatter);
     setReferenceCounter(referenceCounter);
+    setReferenceArea(ComponentParameterReferenceCounter::REMAP_STATES);
 
     for (QSharedPointer<RemapState> remapState : *remapStates_)
     {
@@ -127,6 +127,11 @@ void SubspaceMapItem::onAddressingChanged()
 //-----------------------------------------------------------------------------
 ItemVisualizer* SubspaceMapItem::visualizer()
 {
+    if (!visualizer_ && parent())
+    {
+        parent()->visualizer();
+    }
+
 	return visualizer_;
 }
 
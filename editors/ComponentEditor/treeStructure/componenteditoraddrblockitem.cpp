@@ -53,12 +53,6 @@ blockInterface_(blockInterface)
     setExpressionFormatter(expressionFormatter);
 
 	setObjectName(tr("ComponentEditorAddrBlockItem"));
-
-    const int registerCount = addrBlock_->getRegisterData()->count();
-    for (int i = 0; i < registerCount; ++i)
-    {
-        createChild(i);
-    }
 }
 
 //-----------------------------------------------------------------------------
@@ -123,11 +117,54 @@ ItemEditor* ComponentEditorAddrBlockItem::editor()
 	return editor_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::pendingChildCount()
+//-----------------------------------------------------------------------------
+int ComponentEditorAddrBlockItem::pendingChildCount() const
+{
+    if (registersFetched_)
+    {
+        return 0;
+    }
+
+    return addrBlock_->getRegisterData()->count();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::fetchChildren()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::fetchChildren()
+{
+    if (registersFetched_)
+    {
+        return;
+    }
+
+    registersFetched_ = true;
+
+    const int registerCount = addrBlock_->getRegisterData()->count();
+    for (int i = 0; i < registerCount; ++i)
+    {
+        createChild(i);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorAddrBlockItem::createChild()
 //-----------------------------------------------------------------------------
 void ComponentEditorAddrBlockItem::createChild( int index )
 {
+    // The register is created with the other deferred registers.
+    if (!registersFetched_)
+    {
+        if (graphItem_)
+        {
+            graphItem_->setChildrenPending(true);
+        }
+
+        return;
+    }
+
     QSharedPointer<RegisterBase> regmodel = addrBlock_->getRegisterData()->at(index);
 	QSharedPointer<Register> reg = regmodel.dynamicCast<Register>();
 	if (reg)
@@ -197,6 +234,11 @@ void ComponentEditorAddrBlockItem::createChild( int index )
 //-----------------------------------------------------------------------------
 void ComponentEditorAddrBlockItem::removeChild(int index)
 {
+    if (!registersFetched_)
+    {
+        return;
+    }
+
     if (visualizer_)
     {
         auto childItem = static_cast<MemoryVisualizationItem*>(childItems_.at(index)->getGraphicsItem());
@@ -226,7 +268,23 @@ void ComponentEditorAddrBlockItem::onGraphicsChanged()
 //-----------------------------------------------------------------------------
 void ComponentEditorAddrBlockItem::onChildGraphicsChanged(int index)
 {
-    childItems_.at(index)->updateGraphics();
+    if (index < childItems_.count())
+    {
+        childItems_.at(index)->updateGraphics();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::onGraphicsExpanded()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::onGraphicsExpanded()
+{
+    if (graphItem_->isExpanded() && registersFetched_ == false)
+    {
+        model_->fetchChildren(this);
+        graphItem_->setChildrenPending(false);
+        graphItem_->redoChildLayout();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -252,7 +310,7 @@ void ComponentEditorAddrBlockItem::onAddressingChanged()
 //-----------------------------------------------------------------------------
 void ComponentEditorAddrBlockItem::onChildAddressingChanged(int index)
 {
-    if (graphItem_ != nullptr)
+    if (graphItem_ != nullptr && index < childItems_.count())
     {
         auto childRegister = childItems_.at(index).dynamicCast<ComponentEditorRegisterItem>();
 
@@ -278,6 +336,12 @@ void ComponentEditorAddrBlockItem::onChildAddressingChanged(int index)
 //-----------------------------------------------------------------------------
 ItemVisualizer* ComponentEditorAddrBlockItem::visualizer()
 {
+    // The visualizer of the memory map is created on first use.
+    if (!visualizer_ && parent())
+    {
+        parent()->visualizer();
+    }
+
 	return visualizer_;
 }
 
@@ -296,6 +360,11 @@ void ComponentEditorAddrBlockItem::setVisualizer( MemoryMapsVisualizer* visualiz
 	graphItem_ = new AddressBlockGraphItem(addrBlock_, expressionParser_, parentItem);
     graphItem_->setAddressableUnitBits(addressUnitBits_);
 
+    connect(graphItem_, SIGNAL(expandStateChanged()), this, SLOT(onGraphicsExpanded()), Qt::UniqueConnection);
+
+    // Registers not yet fetched are created when the address block is expanded in the visualizer.
+    graphItem_->setChildrenPending(pendingChildCount() > 0);
+
 	// update the visualizers for register items
 	for (auto child : childItems_)
     {        
@@ -357,6 +426,7 @@ void ComponentEditorAddrBlockItem::removeGraphicsItem()
 		graphItem_->setParent(nullptr);
 
 		disconnect(graphItem_, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()));
+		disconnect(graphItem_, SIGNAL(expandStateChanged()), this, SLOT(onGraphicsExpanded()));
 
 		// delete the graph item
 		delete graphItem_;
@@ -101,6 +101,16 @@ public:
 	 */
 	virtual ItemEditor* editor() override final;
 
+	/*!
+     *  Get the number of register items that have not been created yet.
+	 *
+	 *    @return The number of registers and register files without an item.
+	 */
+	virtual int pendingChildCount() const override final;
+
+	//! Create the register items on first expansion or visualization.
+	virtual void fetchChildren() override final;
+
 	/*!
      *  Add a new child to the item.
 	 * 
@@ -165,6 +175,9 @@ protected slots:
 
     void onChildGraphicsChanged(int index);    
 
+    //! Create the register items when the address block graphics are expanded for the first time.
+    void onGraphicsExpanded();
+
 signals:
     
     /*!
@@ -220,6 +233,9 @@ private:
 
     //! Interface for address blocks.
     AddressBlockInterface* blockInterface_;
+
+    //! Flag for register items having been created.
+    bool registersFetched_ = false;
 };
 
 #endif // COMPONENTEDITORADDRBLOCKITEM_H
@@ -58,6 +58,7 @@ blockInterface_()
     createAddressSpaceValidator();
 
     setReferenceCounter(referenceCounter);
+    setReferenceArea(ComponentParameterReferenceCounter::ADDRESS_SPACES);
     setParameterFinder(parameterFinder);
     setExpressionFormatter(expressionFormatter);
 
@@ -44,6 +44,7 @@ portMapInterface_(portMapInterface)
     setParameterFinder(expressions.finder);
     setExpressionFormatter(expressions.formatter);
     setReferenceCounter(referenceCounter);
+    setReferenceArea(ComponentParameterReferenceCounter::BUS_INTERFACES);
 
 	for (QSharedPointer<BusInterface> busif : *busifs_)
     {
@@ -41,6 +41,7 @@ ComponentEditorItem(model, libHandler, component, parent),
     setParameterFinder(expressions.finder);
     setExpressionFormatter(expressions.formatter);
     setReferenceCounter(referenceCounter);
+    setReferenceArea(ComponentParameterReferenceCounter::CPUS);
 
     const int CHILD_COUNT = cpus_->count();
     for (int i = 0; i < CHILD_COUNT; ++i)
@@ -103,6 +103,11 @@ ItemEditor* ComponentEditorFieldItem::editor()
 //-----------------------------------------------------------------------------
 ItemVisualizer* ComponentEditorFieldItem::visualizer()
 {
+    if (!visualizer_ && parent())
+    {
+        parent()->visualizer();
+    }
+
 	return visualizer_;
 }
 
@@ -44,6 +44,7 @@ fileSetsValidator_(new FileSetsValidator(fileSetValidator_)),
 fileSetInterface_(0)
 {
     setReferenceCounter(referenceCounter);
+    setReferenceArea(ComponentParameterReferenceCounter::FILE_SETS);
     setParameterFinder(parameterFinder);
     setExpressionFormatter(expressionFormatter);
 
@@ -138,7 +138,24 @@ int ComponentEditorItem::rowCount() const
 //-----------------------------------------------------------------------------
 bool ComponentEditorItem::hasChildren() const
 {
-	return !childItems_.isEmpty();
+	return !childItems_.isEmpty() || pendingChildCount() > 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditoritem::pendingChildCount()
+//-----------------------------------------------------------------------------
+int ComponentEditorItem::pendingChildCount() const
+{
+	// Normally all children are created with the item.
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditoritem::fetchChildren()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::fetchChildren()
+{
+	// Normally all children are created with the item.
 }
 
 //-----------------------------------------------------------------------------
@@ -465,12 +482,52 @@ void ComponentEditorItem::setExpressionFormatter(QSharedPointer<ExpressionFormat
 //-----------------------------------------------------------------------------
 void ComponentEditorItem::connectItemEditorToReferenceCounter()
 {
+	auto componentCounter = referenceCounter_.dynamicCast<ComponentParameterReferenceCounter>();
+	auto const area = getReferenceArea();
+
+	if (componentCounter && area != ComponentParameterReferenceCounter::AREA_COUNT)
+	{
+		// Reporting the area of the changed expressions keeps the rest of the reference index intact.
+		connect(editor_, &ItemEditor::increaseReferences, componentCounter.data(),
+			[counter = componentCounter.data(), area](QString const& id)
+			{
+				counter->increaseReferenceCountInArea(id, area);
+			});
+		connect(editor_, &ItemEditor::decreaseReferences, componentCounter.data(),
+			[counter = componentCounter.data(), area](QString const& id)
+			{
+				counter->decreaseReferenceCountInArea(id, area);
+			});
+		return;
+	}
+
 	connect(editor_, SIGNAL(increaseReferences(QString)),
 		referenceCounter_.data(), SLOT(increaseReferenceCount(QString)), Qt::UniqueConnection);
 	connect(editor_, SIGNAL(decreaseReferences(QString)),
 		referenceCounter_.data(), SLOT(decreaseReferenceCount(QString)), Qt::UniqueConnection);
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditoritem::setReferenceArea()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::setReferenceArea(ComponentParameterReferenceCounter::ReferenceArea area)
+{
+	referenceArea_ = area;
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditoritem::getReferenceArea()
+//-----------------------------------------------------------------------------
+ComponentParameterReferenceCounter::ReferenceArea ComponentEditorItem::getReferenceArea() const
+{
+	if (referenceArea_ == ComponentParameterReferenceCounter::AREA_COUNT && parent_ != nullptr)
+	{
+		return parent_->getReferenceArea();
+	}
+
+	return referenceArea_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditoritem::connectItemEditorToVendorExtensionsEditor()
 //-----------------------------------------------------------------------------
@@ -12,6 +12,7 @@
 #ifndef COMPONENTEDITORITEM_H
 #define COMPONENTEDITORITEM_H
 
+#include <editors/ComponentEditor/referenceCounter/ComponentParameterReferenceCounter.h>
 #include <editors/ComponentEditor/referenceCounter/ReferenceCounter.h>
 #include <KactusAPI/include/ParameterFinder.h>
 #include <KactusAPI/include/ExpressionFormatter.h>
@@ -92,10 +93,22 @@ public:
 	/*!
 	 *  Returns true if item contains child items.
 	 *
-	 *    @return True if child items exist.
+	 *    @return True if child items exist or are waiting to be created.
 	 */
 	bool hasChildren() const;
 
+	/*!
+	 *  Get the number of children whose items have not been created yet.
+	 *
+	 *    @return The number of deferred child items.
+	 */
+	virtual int pendingChildCount() const;
+
+	/*!
+	 *  Create the deferred child items.
+	 */
+	virtual void fetchChildren();
+
 	/*!
 	 *  Get pointer to the child in given index.
 	 *
@@ -378,6 +391,13 @@ protected:
 	 */
 	virtual void connectItemEditorToReferenceCounter();
 
+	/*!
+	 *  Set the area of the component containing the expressions edited in this item and its children.
+	 *
+	 *    @param [in] area    The component area.
+	 */
+	void setReferenceArea(ComponentParameterReferenceCounter::ReferenceArea area);
+
 	/*!
 	 *  Connects this component editor items item editor to the vendor extensions editor.
 	 */
@@ -462,8 +482,18 @@ private:
 	ComponentEditorItem(const ComponentEditorItem& other);
 	ComponentEditorItem& operator=(const ComponentEditorItem& other);
 
+	/*!
+	 *  Get the area of the component containing the expressions edited in this item.
+	 *
+	 *    @return The area set for this item or its closest ancestor, or AREA_COUNT if no area is set.
+	 */
+	ComponentParameterReferenceCounter::ReferenceArea getReferenceArea() const;
+
 	//! Pointer to the parent item.
 	ComponentEditorItem* parent_ = nullptr;
+
+	//! The area of the component containing the expressions edited in this item.
+	ComponentParameterReferenceCounter::ReferenceArea referenceArea_ = ComponentParameterReferenceCounter::AREA_COUNT;
 };
 
 #endif // COMPONENTEDITORITEM_H
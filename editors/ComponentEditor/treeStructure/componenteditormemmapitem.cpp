@@ -48,9 +48,6 @@ mapInterface_(mapInterface)
         mapInterface_, this));
     defaultRemapItem->setLocked(locked_);
 
-    MemoryMapsVisualizer* memoryRemapVisualizer = new MemoryMapsVisualizer();
-    defaultRemapItem->setVisualizer(memoryRemapVisualizer);
-
     connect(this, SIGNAL(memoryMapNameChanged(QString const&, QString const&)),
         defaultRemapItem.data(), SIGNAL(memoryMapNameChanged(QString const&, QString const&)),
         Qt::UniqueConnection);
@@ -115,9 +112,6 @@ void ComponentEditorMemMapItem::createChild( int index )
         memoryMapValidator_, mapInterface_, this));
     memoryRemapItem->setLocked(locked_);
 
-    MemoryMapsVisualizer* memoryRemapVisualizer = new MemoryMapsVisualizer();
-    memoryRemapItem->setVisualizer(memoryRemapVisualizer);
-
     childItems_.append(memoryRemapItem);
 
     connect(this, SIGNAL(memoryRemapNameChanged(QString const&, QString const&, QString const&)),
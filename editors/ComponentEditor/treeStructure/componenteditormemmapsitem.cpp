@@ -58,6 +58,7 @@ ComponentEditorItem(model, libHandler, component, parent),
     createValidators();
 
     setReferenceCounter(referenceCounter);
+    setReferenceArea(ComponentParameterReferenceCounter::MEMORY_MAPS);
     setParameterFinder(parameterFinder);
     setExpressionFormatter(expressionFormatter);
 
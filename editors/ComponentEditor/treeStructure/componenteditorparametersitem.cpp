@@ -34,6 +34,7 @@ parameterInterface_(new ParametersInterface(validator_, expressionParser, expres
     parameterInterface_->setChoices(component->getChoices());
 
     setReferenceCounter(refCounter);
+    setReferenceArea(ComponentParameterReferenceCounter::PARAMETERS);
     setParameterFinder(parameterFinder);
     setExpressionFormatter(expressionFormatter);
 }
@@ -39,6 +39,7 @@ ComponentEditorPortsItem::ComponentEditorPortsItem(ComponentEditorTreeModel* mod
     busInterface_(busInterface)
 {
     setReferenceCounter(refCounter);
+    setReferenceArea(ComponentParameterReferenceCounter::PORTS);
     setParameterFinder(expressions.finder);
     setExpressionFormatter(expressions.formatter);
 
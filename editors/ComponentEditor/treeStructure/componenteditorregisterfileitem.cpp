@@ -61,12 +61,6 @@ addressUnitBits_(addressUnitBits)
     setParameterFinder(parameterFinder);
     setExpressionFormatter(expressionFormatter);
     setObjectName(tr("ComponentEditorRegFileItem"));
-
-    const int registerCount = registerFile_->getRegisterData()->count();
-    for (int i = 0; i < registerCount; ++i)
-    {
-        createChild(i);
-    }
 }
 
 //-----------------------------------------------------------------------------
@@ -93,11 +87,54 @@ bool ComponentEditorRegisterFileItem::isValid() const
     return registerFileValidator_->validate(registerFile_, QString::number(addressUnitBits_), containingBlock_->getWidth());
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorRegisterFileItem::pendingChildCount()
+//-----------------------------------------------------------------------------
+int ComponentEditorRegisterFileItem::pendingChildCount() const
+{
+    if (registersFetched_)
+    {
+        return 0;
+    }
+
+    return registerFile_->getRegisterData()->count();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorRegisterFileItem::fetchChildren()
+//-----------------------------------------------------------------------------
+void ComponentEditorRegisterFileItem::fetchChildren()
+{
+    if (registersFetched_)
+    {
+        return;
+    }
+
+    registersFetched_ = true;
+
+    const int registerCount = registerFile_->getRegisterData()->count();
+    for (int i = 0; i < registerCount; ++i)
+    {
+        createChild(i);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorAddrBlockItem::createChild()
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterFileItem::createChild( int index )
 {
+    // The register is created with the other deferred registers.
+    if (!registersFetched_)
+    {
+        if (registerFileItem_)
+        {
+            registerFileItem_->setChildrenPending(true);
+        }
+
+        return;
+    }
+
     QSharedPointer<RegisterBase> regmodel = registerFile_->getRegisterData()->at(index);
 
     QSharedPointer<Register> reg = regmodel.dynamicCast<Register>();
@@ -165,6 +202,11 @@ void ComponentEditorRegisterFileItem::createChild( int index )
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterFileItem::removeChild(int index)
 {
+    if (!registersFetched_)
+    {
+        return;
+    }
+
     if (visualizer_)
     {
         auto childItem = static_cast<MemoryVisualizationItem*>(childItems_.at(index)->getGraphicsItem());
@@ -212,6 +254,11 @@ ItemEditor* ComponentEditorRegisterFileItem::editor()
 //-----------------------------------------------------------------------------
 ItemVisualizer* ComponentEditorRegisterFileItem::visualizer()
 {
+    if (!visualizer_ && parent())
+    {
+        parent()->visualizer();
+    }
+
     return visualizer_;
 }
 
@@ -228,6 +275,10 @@ void ComponentEditorRegisterFileItem::setVisualizer( MemoryMapsVisualizer* visua
     registerFileItem_ = new RegisterFileGraphItem(registerFile_, expressionParser_, parentItem);    
 
     connect(registerFileItem_, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()), Qt::UniqueConnection);
+    connect(registerFileItem_, SIGNAL(expandStateChanged()), this, SLOT(onGraphicsExpanded()), Qt::UniqueConnection);
+
+    // Registers not yet fetched are created when the register file is expanded in the visualizer.
+    registerFileItem_->setChildrenPending(pendingChildCount() > 0);
 
     // update the visualizers for field items
     for (QSharedPointer<ComponentEditorItem> child : childItems_)
@@ -299,7 +350,23 @@ void ComponentEditorRegisterFileItem::onGraphicsChanged()
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterFileItem::onChildGraphicsChanged(int index)
 {
-    childItems_.at(index)->updateGraphics();
+    if (index < childItems_.count())
+    {
+        childItems_.at(index)->updateGraphics();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorRegisterFileItem::onGraphicsExpanded()
+//-----------------------------------------------------------------------------
+void ComponentEditorRegisterFileItem::onGraphicsExpanded()
+{
+    if (registerFileItem_->isExpanded() && registersFetched_ == false)
+    {
+        model_->fetchChildren(this);
+        registerFileItem_->setChildrenPending(false);
+        registerFileItem_->redoChildLayout();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -320,7 +387,7 @@ void ComponentEditorRegisterFileItem::onAddressingChanged()
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterFileItem::onChildAddressingChanged(int index)
 {
-    if (registerFileItem_ != nullptr)
+    if (registerFileItem_ != nullptr && index < childItems_.count())
     {
         childItems_.at(index)->updateGraphics();
 
@@ -356,6 +423,7 @@ void ComponentEditorRegisterFileItem::removeGraphicsItem()
         registerFileItem_->setParent(nullptr);
 
         disconnect(registerFileItem_, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()));
+        disconnect(registerFileItem_, SIGNAL(expandStateChanged()), this, SLOT(onGraphicsExpanded()));
 
         delete registerFileItem_;
         registerFileItem_ = nullptr;
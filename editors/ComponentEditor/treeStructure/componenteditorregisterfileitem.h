@@ -101,6 +101,16 @@ public:
     */
     virtual ItemEditor* editor() override final;
 
+    /*!
+    *  Get the number of register items that have not been created yet.
+    *
+    *    @return The number of registers and register files without an item.
+    */
+    virtual int pendingChildCount() const override final;
+
+    //! Create the register items on first expansion or visualization.
+    virtual void fetchChildren() override final;
+
     /*!
     *  Add a new child to the item.
     *
@@ -172,6 +182,9 @@ protected slots:
 
     void onChildGraphicsChanged(int index);
 
+    //! Create the register items when the register file graphics are expanded for the first time.
+    void onGraphicsExpanded();
+
 private:
 
     //! The register file being edited.
@@ -197,6 +210,9 @@ private:
 
     //! The currently set address unit bits.
     unsigned int addressUnitBits_;
+
+    //! Flag for register items having been created.
+    bool registersFetched_ = false;
 };
 
 #endif // COMPONENTEDITORREGISTERFILEITEM_H
@@ -11,6 +11,7 @@
 
 #include "componenteditorregisteritem.h"
 #include "componenteditorfielditem.h"
+#include "componenteditortreemodel.h"
 
 #include <KactusAPI/include/ExpressionParser.h>
 
@@ -53,14 +54,6 @@ containingRegisterData_(containingRegisterData)
     setExpressionFormatter(expressionFormatter);
 
 	setObjectName(tr("ComponentEditorRegisterItem"));
-
-    const int fieldCount = reg_->getFields()->count();
-
-	for (int i = 0; i < fieldCount; ++i)
-    {
-        createChild(i);
-    }
-
 }
 
 //-----------------------------------------------------------------------------
@@ -120,11 +113,54 @@ ItemEditor* ComponentEditorRegisterItem::editor()
 	return editor_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditorregisteritem::pendingChildCount()
+//-----------------------------------------------------------------------------
+int ComponentEditorRegisterItem::pendingChildCount() const
+{
+    if (fieldsFetched_)
+    {
+        return 0;
+    }
+
+    return reg_->getFields()->count();
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditorregisteritem::fetchChildren()
+//-----------------------------------------------------------------------------
+void ComponentEditorRegisterItem::fetchChildren()
+{
+    if (fieldsFetched_)
+    {
+        return;
+    }
+
+    fieldsFetched_ = true;
+
+    const int fieldCount = reg_->getFields()->count();
+    for (int i = 0; i < fieldCount; ++i)
+    {
+        createChild(i);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditorregisteritem::createChild()
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterItem::createChild( int index )
 {
+    // The field is created with the other deferred fields.
+    if (!fieldsFetched_)
+    {
+        if (registerItem_)
+        {
+            registerItem_->setChildrenPending(true);
+        }
+
+        return;
+    }
+
 	QSharedPointer<ComponentEditorFieldItem> fieldItem(new ComponentEditorFieldItem(
 		reg_, reg_->getFields()->at(index), model_, libHandler_, component_, parameterFinder_, 
         referenceCounter_, expressionParser_, expressionFormatter_, registerValidator_->getFieldValidator(),
@@ -155,6 +191,11 @@ void ComponentEditorRegisterItem::createChild( int index )
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterItem::removeChild(int index)
 {
+    if (!fieldsFetched_)
+    {
+        return;
+    }
+
     auto fieldItem = childItems_.at(index).dynamicCast<ComponentEditorFieldItem>();
 
     if (visualizer_)
@@ -174,6 +215,11 @@ void ComponentEditorRegisterItem::removeChild(int index)
 //-----------------------------------------------------------------------------
 ItemVisualizer* ComponentEditorRegisterItem::visualizer()
 {
+    if (!visualizer_ && parent())
+    {
+        parent()->visualizer();
+    }
+
 	return visualizer_;
 }
 
@@ -190,6 +236,10 @@ void ComponentEditorRegisterItem::setVisualizer(MemoryMapsVisualizer* visualizer
     registerItem_ = new RegisterGraphItem(reg_, expressionParser_, parentItem);
     
     connect(registerItem_, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()), Qt::UniqueConnection);
+    connect(registerItem_, SIGNAL(expandStateChanged()), this, SLOT(onGraphicsExpanded()), Qt::UniqueConnection);
+
+    // Fields not yet fetched are created when the register is expanded in the visualizer.
+    registerItem_->setChildrenPending(pendingChildCount() > 0);
 
 	// update the visualizers for field items
 	for (auto& item : childItems_)
@@ -235,12 +285,28 @@ void ComponentEditorRegisterItem::onGraphicsChanged()
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorRegisterItem::onGraphicsExpanded()
+//-----------------------------------------------------------------------------
+void ComponentEditorRegisterItem::onGraphicsExpanded()
+{
+    if (registerItem_->isExpanded() && fieldsFetched_ == false)
+    {
+        model_->fetchChildren(this);
+        registerItem_->setChildrenPending(false);
+        registerItem_->redoChildLayout();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorRegisterItem::onChildGraphicsChanged()
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterItem::onChildGraphicsChanged(int index)
 {
-    childItems_.at(index)->updateGraphics();
+    if (index < childItems_.count())
+    {
+        childItems_.at(index)->updateGraphics();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -104,6 +104,15 @@ public:
 	 */
 	virtual ItemEditor* editor();
 
+	/*! Get the number of field items that have not been created yet.
+	 *
+	 *    @return The number of fields without an item.
+	 */
+	virtual int pendingChildCount() const override final;
+
+	//! Create the field items on first expansion or visualization.
+	virtual void fetchChildren() override final;
+
 	/*! Add a new child to the item.
 	 * 
 	 *    @param [in] index The index to add the child into.
@@ -180,6 +189,9 @@ protected slots:
 
     //! Handle the change in child item's graphics.
     void onChildGraphicsChanged(int index);
+
+    //! Create the field items when the register graphics are expanded for the first time.
+    void onGraphicsExpanded();
    
 private:
 	
@@ -197,6 +209,9 @@ private:
 	//! The graph item that visualizes the register and possible dimensions.
 	RegisterGraphItem* registerItem_ = nullptr;
 
+	//! Flag for field items having been created.
+	bool fieldsFetched_ = false;
+
     //! The expression parser to use.
     QSharedPointer<ExpressionParser> expressionParser_;
 
@@ -92,6 +92,58 @@ bool ComponentEditorTreeModel::hasChildren( const QModelIndex& parent /*= QModel
 	return parentItem->hasChildren();
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::canFetchMore()
+//-----------------------------------------------------------------------------
+bool ComponentEditorTreeModel::canFetchMore(const QModelIndex& parent) const
+{
+	if (!parent.isValid())
+	{
+		return false;
+	}
+
+	ComponentEditorItem* parentItem = static_cast<ComponentEditorItem*>(parent.internalPointer());
+	return parentItem->pendingChildCount() > 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::fetchMore()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::fetchMore(const QModelIndex& parent)
+{
+	if (parent.isValid())
+	{
+		fetchChildren(static_cast<ComponentEditorItem*>(parent.internalPointer()));
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::fetchChildren()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::fetchChildren(ComponentEditorItem* item)
+{
+	Q_ASSERT(item);
+
+	const int pendingCount = item->pendingChildCount();
+	if (pendingCount == 0)
+	{
+		return;
+	}
+
+	// items still under construction are not visible to the views yet
+	if (!isInTree(item))
+	{
+		item->fetchChildren();
+		return;
+	}
+
+	const int firstRow = item->rowCount();
+
+	beginInsertRows(index(item), firstRow, firstRow + pendingCount - 1);
+	item->fetchChildren();
+	endInsertRows();
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditortreemodel::columnCount()
 //-----------------------------------------------------------------------------
@@ -304,6 +356,14 @@ void ComponentEditorTreeModel::addItem( ComponentEditorItem* parentItem, int chi
 	// find the index of the parent item
 	QModelIndex parentIndex = index(parentItem);
 
+	// the deferred children already include the new child
+	if (parentItem->pendingChildCount() > 0)
+	{
+		fetchChildren(parentItem);
+		emit expandItem(parentIndex);
+		return;
+	}
+
 	beginInsertRows(parentIndex, childIndex, childIndex);
 	parentItem->createChild(childIndex);
 	endInsertRows();
@@ -319,6 +379,12 @@ void ComponentEditorTreeModel::removeItem( ComponentEditorItem* parentItem, int
 	Q_ASSERT(parentItem);
 	Q_ASSERT(childIndex >= 0);
 
+	// the item for a deferred child has not been created
+	if (childIndex >= parentItem->rowCount())
+	{
+		return;
+	}
+
 	// find the index of the parent item
 	QModelIndex parentIndex = index(parentItem);
 
@@ -336,8 +402,8 @@ void ComponentEditorTreeModel::moveItem( ComponentEditorItem* parentItem, int ch
 	Q_ASSERT(childSource >= 0);
 	Q_ASSERT(childtarget >= 0);
 
-	// if the location of the item does not change
-	if (childSource == childtarget)
+	// if the location of the item does not change or the item has not been created
+	if (childSource == childtarget || childSource >= parentItem->rowCount())
     {
 		return;
 	}
@@ -389,7 +455,7 @@ void ComponentEditorTreeModel::onSelectItem( ComponentEditorItem* item )
 //-----------------------------------------------------------------------------
 // Function: componenteditortreemodel::getIndexOfItem()
 //-----------------------------------------------------------------------------
-QModelIndex ComponentEditorTreeModel::getIndexOfItem(QVector<QString> itemIdentifierChain) const
+QModelIndex ComponentEditorTreeModel::getIndexOfItem(QVector<QString> itemIdentifierChain)
 {
     QModelIndex itemIndex;
 
@@ -413,8 +479,12 @@ void ComponentEditorTreeModel::clearItemsModified() const
 // Function: componenteditortreemodel::findIndexByItemIdentifier()
 //-----------------------------------------------------------------------------
 QModelIndex ComponentEditorTreeModel::findIndexByItemIdentifier(QString const& identifier, QModelIndex parentIndex)
-    const
 {
+    if (canFetchMore(parentIndex))
+    {
+        fetchMore(parentIndex);
+    }
+
     int numberOfRows = rowCount(parentIndex);
     int columnNumber = 0;
 
@@ -433,3 +503,21 @@ QModelIndex ComponentEditorTreeModel::findIndexByItemIdentifier(QString const& i
 
     return parentIndex;
 }
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::isInTree()
+//-----------------------------------------------------------------------------
+bool ComponentEditorTreeModel::isInTree(ComponentEditorItem* item) const
+{
+    while (item != rootItem_.data())
+    {
+        if (item->parent() == nullptr || item->row() == -1)
+        {
+            return false;
+        }
+
+        item = item->parent();
+    }
+
+    return true;
+}
@@ -68,6 +68,29 @@ public:
 	 */
 	virtual bool hasChildren(const QModelIndex& parent = QModelIndex()) const;
 
+	/*!
+	 *  Check if the item has child items that have not been created yet.
+	 *
+	 *    @param [in] parent  Model index of the item.
+	 *
+	 *    @return True if the item has deferred child items.
+	 */
+	virtual bool canFetchMore(const QModelIndex& parent) const override;
+
+	/*!
+	 *  Create the deferred child items of the item.
+	 *
+	 *    @param [in] parent  Model index of the item.
+	 */
+	virtual void fetchMore(const QModelIndex& parent) override;
+
+	/*!
+	 *  Create the deferred child items of the given item and inform the views of the new rows.
+	 *
+	 *    @param [in] item    Pointer to the item whose children are created.
+	 */
+	void fetchChildren(ComponentEditorItem* item);
+
 	/*!
 	 *  Get the number of columns the item has to be displayed.
 	 *
@@ -132,7 +155,7 @@ public:
 	 *
 	 *    @return The model index of the selected item.
 	 */
-	QModelIndex getIndexOfItem(QVector<QString> itemIdentifierChain) const;
+	QModelIndex getIndexOfItem(QVector<QString> itemIdentifierChain);
 
 	void clearItemsModified() const;
 
@@ -250,8 +273,16 @@ private:
 	 *
 	 *    @return The model index of the selected item.
 	 */
-	QModelIndex findIndexByItemIdentifier(QString const& identifier, QModelIndex parentIndex = QModelIndex())
-		const;
+	QModelIndex findIndexByItemIdentifier(QString const& identifier, QModelIndex parentIndex = QModelIndex());
+
+	/*!
+	 *  Check if the item and all of its ancestors are already part of the tree.
+	 *
+	 *    @param [in] item    Pointer to the item to check.
+	 *
+	 *    @return True if the item can be identified with a model index.
+	 */
+	bool isInTree(ComponentEditorItem* item) const;
 
 	//-----------------------------------------------------------------------------
 	// Data.
@@ -47,6 +47,7 @@ moduleParameterInterface_(0)
 	setObjectName(tr("ComponentEditorViewsItem"));
 
     setReferenceCounter(referenceCounter);
+    setReferenceArea(ComponentParameterReferenceCounter::INSTANTIATIONS);
 
 	for (QSharedPointer<View> view : *views_)
     {
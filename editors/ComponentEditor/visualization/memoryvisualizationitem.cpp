@@ -89,6 +89,16 @@ int MemoryVisualizationItem::getChildCount() const
     return childItems_.count();
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::setChildrenPending()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::setChildrenPending(bool pending)
+{
+    childrenPending_ = pending;
+
+    showExpandIconIfHasChildren();
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryVisualizationItem::setWidth()
 //-----------------------------------------------------------------------------
@@ -150,7 +160,7 @@ QSharedPointer<ExpressionParser> MemoryVisualizationItem::getExpressionParser()
 //-----------------------------------------------------------------------------
 void MemoryVisualizationItem::showExpandIconIfHasChildren()
 {    
-    ExpandableItem::setShowExpandableItem(childItems_.isEmpty() == false);
+    ExpandableItem::setShowExpandableItem(childrenPending_ || childItems_.isEmpty() == false);
 }
 
 //-----------------------------------------------------------------------------
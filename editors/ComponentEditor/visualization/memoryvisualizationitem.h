@@ -103,6 +103,13 @@ public:
 
     int getChildCount() const;
 
+    /*!
+     *  Set whether the item has children which do not yet have graphics items.
+     *
+     *    @param [in] pending     If true, the item is shown expandable even without child items.
+     */
+    void setChildrenPending(bool pending);
+
     /*!
      *  Set the width for the item.
 	 *
@@ -147,7 +154,8 @@ protected:
      */
     QSharedPointer<ExpressionParser> getExpressionParser() const;
 
-    //! Shows the expand/collapse icon if the item has any children. Otherwise the icon is hidden.
+    //! Shows the expand/collapse icon if the item has any children or children still pending creation.
+    //! Otherwise the icon is hidden.
     void showExpandIconIfHasChildren();
 
     //! Update the offsets of the child items in the map and fills the empty gaps between them.
@@ -206,6 +214,9 @@ private:
     //! Width for child items.
     qreal childWidth_ = VisualizerItem::DEFAULT_WIDTH;
 
+    //! Flag for children which will be created when the item is first expanded.
+    bool childrenPending_ = false;
+
     //! The used expression parser.
     QSharedPointer<ExpressionParser> expressionParser_;
 
@@ -17,11 +17,15 @@
 #include <IPXACTmodels/Component/MemoryMap.h>
 #include <IPXACTmodels/Component/Field.h>
 #include <IPXACTmodels/Component/BusInterface.h>
+#include <IPXACTmodels/Component/Port.h>
+
+#include <IPXACTmodels/common/ModuleParameter.h>
 
 #include <KactusAPI/include/ExpressionFormatter.h>
 #include <KactusAPI/include/LibraryInterface.h>
 #include <KactusAPI/include/ListParameterFinder.h>
 
+#include <QHash>
 #include <QList>
 #include <QString>
 #include <QSharedPointer>
@@ -447,3 +451,191 @@ void DocumentationWriter::writeInterfaceInfo(QTextStream& stream, QSharedPointer
 
     writeInfoParagraph(stream, interfaceInfoNames, interfaceInfoValues);
 }
+
+//-----------------------------------------------------------------------------
+// Function: DocumentationWriter::formatExpressionColumn()
+//-----------------------------------------------------------------------------
+QStringList DocumentationWriter::formatExpressionColumn(QStringList const& expressions,
+    ExpressionFormatter const* formatter)
+{
+    // Columns tend to repeat the same expressions (e.g. widths and bounds), so format each only once.
+    QHash<QString, QString> formattedExpressions;
+
+    QStringList column;
+    column.reserve(expressions.size());
+
+    for (auto const& expression : expressions)
+    {
+        auto formatted = formattedExpressions.constFind(expression);
+        if (formatted == formattedExpressions.constEnd())
+        {
+            formatted = formattedExpressions.insert(expression, formatter->formatReferringExpression(expression));
+        }
+
+        column.append(formatted.value());
+    }
+
+    return column;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentationWriter::createParameterColumns()
+//-----------------------------------------------------------------------------
+TableColumns DocumentationWriter::createParameterColumns(QList<QSharedPointer<Parameter> > const& parameters,
+    ExpressionFormatter const* formatter)
+{
+    TableColumns columns(PARAMETER_HEADERS.size());
+    for (auto& column : columns)
+    {
+        column.reserve(parameters.size());
+    }
+
+    for (auto const& parameter : parameters)
+    {
+        columns[0].append(parameter->name());
+        columns[1].append(parameter->getType());
+        columns[2].append(parameter->getValue());
+        columns[3].append(parameter->getValueResolve());
+        columns[4].append(parameter->getVectorLeft());
+        columns[5].append(parameter->getVectorRight());
+        columns[6].append(parameter->getArrayLeft());
+        columns[7].append(parameter->getArrayRight());
+        columns[8].append(parameter->description());
+    }
+
+    for (int i : { 2, 4, 5, 6, 7 })
+    {
+        columns[i] = formatExpressionColumn(columns.at(i), formatter);
+    }
+
+    return columns;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentationWriter::createModuleParameterColumns()
+//-----------------------------------------------------------------------------
+TableColumns DocumentationWriter::createModuleParameterColumns(
+    QList<QSharedPointer<Parameter> > const& moduleParameters, ExpressionFormatter const* formatter)
+{
+    TableColumns columns(MODULE_PARAMETER_HEADERS.size());
+    for (auto& column : columns)
+    {
+        column.reserve(moduleParameters.size());
+    }
+
+    for (auto const& parameter : moduleParameters)
+    {
+        QSharedPointer<ModuleParameter> moduleParameter = parameter.dynamicCast<ModuleParameter>();
+
+        columns[0].append(moduleParameter->name());
+        columns[1].append(moduleParameter->getType());
+        columns[2].append(moduleParameter->getValue());
+        columns[3].append(moduleParameter->getDataType());
+        columns[4].append(moduleParameter->getUsageType());
+        columns[5].append(moduleParameter->getValueResolve());
+        columns[6].append(moduleParameter->getVectorLeft());
+        columns[7].append(moduleParameter->getVectorRight());
+        columns[8].append(moduleParameter->getArrayLeft());
+        columns[9].append(moduleParameter->getArrayRight());
+        columns[10].append(moduleParameter->description());
+    }
+
+    for (int i : { 2, 6, 7, 8, 9 })
+    {
+        columns[i] = formatExpressionColumn(columns.at(i), formatter);
+    }
+
+    return columns;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentationWriter::createRegisterColumns()
+//-----------------------------------------------------------------------------
+TableColumns DocumentationWriter::createRegisterColumns(QList<QSharedPointer<Register> > const& registers) const
+{
+    TableColumns columns(REGISTER_HEADERS.size() + 1);
+    for (auto& column : columns)
+    {
+        column.reserve(registers.size());
+    }
+
+    for (auto const& currentRegister : registers)
+    {
+        columns[0].append(currentRegister->name());
+        columns[1].append(currentRegister->getAddressOffset());
+        columns[2].append(currentRegister->getSize());
+        columns[3].append(currentRegister->getDimension());
+        columns[4].append(currentRegister->getVolatile());
+        columns[5].append(AccessTypes::access2Str(currentRegister->getAccess()));
+    }
+
+    for (int i : { 1, 2, 3 })
+    {
+        columns[i] = formatExpressionColumn(columns.at(i), expressionFormatter_);
+    }
+
+    return columns;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentationWriter::createFieldColumns()
+//-----------------------------------------------------------------------------
+TableColumns DocumentationWriter::createFieldColumns(QList<QSharedPointer<Field> > const& fields) const
+{
+    TableColumns columns(FIELD_HEADERS.size());
+    for (auto& column : columns)
+    {
+        column.reserve(fields.size());
+    }
+
+    for (auto const& field : fields)
+    {
+        columns[0].append(field->name());
+        columns[1].append(field->getBitOffset());
+        columns[2].append(field->getBitWidth());
+        columns[3].append(field->getVolatile().toString());
+        columns[4].append(AccessTypes::access2Str(field->getAccess()));
+        columns[5].append(getFieldResetInfo(field));
+        columns[6].append(field->description());
+    }
+
+    for (int i : { 1, 2 })
+    {
+        columns[i] = formatExpressionColumn(columns.at(i), expressionFormatter_);
+    }
+
+    return columns;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentationWriter::createPortColumns()
+//-----------------------------------------------------------------------------
+TableColumns DocumentationWriter::createPortColumns(QList<QSharedPointer<Port> > const& ports) const
+{
+    TableColumns columns(PORT_HEADERS.size());
+    for (auto& column : columns)
+    {
+        column.reserve(ports.size());
+    }
+
+    for (auto const& port : ports)
+    {
+        columns[0].append(port->name());
+        columns[1].append(DirectionTypes::direction2Str(port->getDirection()));
+        columns[2].append(port->getLeftBound());
+        columns[3].append(port->getRightBound());
+        columns[4].append(port->getTypeName());
+        columns[5].append(port->getTypeDefinition(port->getTypeName()));
+        columns[6].append(port->getDefaultValue());
+        columns[7].append(port->getArrayLeft());
+        columns[8].append(port->getArrayRight());
+        columns[9].append(port->description());
+    }
+
+    for (int i : { 2, 3, 6, 7, 8 })
+    {
+        columns[i] = formatExpressionColumn(columns.at(i), expressionFormatter_);
+    }
+
+    return columns;
+}
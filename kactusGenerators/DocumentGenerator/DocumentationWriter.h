@@ -33,9 +33,13 @@ class DesignConfigurationInstantiation;
 class ConfigurableVLNVReference;
 class RegisterFile;
 class RegisterBase;
+class Port;
 
 using ParameterList = QSharedPointer<QList<QSharedPointer<Parameter> > >;
 
+//! Table cells stored column by column.
+using TableColumns = QList<QStringList>;
+
 class DocumentationWriter
 {
 public:
@@ -522,6 +526,65 @@ protected:
      */
     void writeInterfaceInfo(QTextStream& stream, QSharedPointer<BusInterface> interface, bool hasPorts);
 
+    /*!
+     *  Formats a column of expressions. Each distinct expression is formatted only once.
+     *
+     *    @param [in] expressions     The expressions in the column.
+     *    @param [in] formatter       The expression formatter to use.
+     *
+     *    @returns The formatted column.
+     */
+    static QStringList formatExpressionColumn(QStringList const& expressions, ExpressionFormatter const* formatter);
+
+    /*!
+     *  Creates the cells of a parameter table.
+     *
+     *    @param [in] parameters      The parameters in the table.
+     *    @param [in] formatter       The expression formatter for the parameters.
+     *
+     *    @returns The table cells in the order of PARAMETER_HEADERS.
+     */
+    static TableColumns createParameterColumns(QList<QSharedPointer<Parameter> > const& parameters,
+        ExpressionFormatter const* formatter);
+
+    /*!
+     *  Creates the cells of a module parameter table.
+     *
+     *    @param [in] moduleParameters    The module parameters in the table.
+     *    @param [in] formatter           The expression formatter for the module parameters.
+     *
+     *    @returns The table cells in the order of MODULE_PARAMETER_HEADERS.
+     */
+    static TableColumns createModuleParameterColumns(QList<QSharedPointer<Parameter> > const& moduleParameters,
+        ExpressionFormatter const* formatter);
+
+    /*!
+     *  Creates the cells of a register table.
+     *
+     *    @param [in] registers       The registers in the table.
+     *
+     *    @returns The table cells, register name followed by the columns of REGISTER_HEADERS.
+     */
+    TableColumns createRegisterColumns(QList<QSharedPointer<Register> > const& registers) const;
+
+    /*!
+     *  Creates the cells of a field table.
+     *
+     *    @param [in] fields          The fields in the table.
+     *
+     *    @returns The table cells in the order of FIELD_HEADERS.
+     */
+    TableColumns createFieldColumns(QList<QSharedPointer<Field> > const& fields) const;
+
+    /*!
+     *  Creates the cells of a port table.
+     *
+     *    @param [in] ports           The ports in the table.
+     *
+     *    @returns The table cells in the order of PORT_HEADERS.
+     */
+    TableColumns createPortColumns(QList<QSharedPointer<Port> > const& ports) const;
+
 private:
     //! The expression formatter, used to change parameter IDs into names.
     ExpressionFormatter* expressionFormatter_;
@@ -231,22 +231,7 @@ void HtmlWriter::writeParameters(QTextStream& stream, int subHeaderNumber)
     writeTableHeader(stream, DocumentationWriter::PARAMETER_HEADERS, 4);
 
     // Write parameters
-    for (auto const& parameter : *component_->getParameters())
-    {
-        QStringList paramFields(QStringList()
-            << parameter->name()
-            << parameter->getType()
-            << expressionFormatter_->formatReferringExpression(parameter->getValue())
-            << parameter->getValueResolve()
-            << expressionFormatter_->formatReferringExpression(parameter->getVectorLeft())
-            << expressionFormatter_->formatReferringExpression(parameter->getVectorRight())
-            << expressionFormatter_->formatReferringExpression(parameter->getArrayLeft())
-            << expressionFormatter_->formatReferringExpression(parameter->getArrayRight())
-            << parameter->description()
-        );
-
-        writeTableRow(stream, paramFields, 4);
-    }
+    writeTableRows(stream, createParameterColumns(*component_->getParameters(), expressionFormatter_), 4);
 
     stream << indent(3) << "</table>" << Qt::endl;
 }
@@ -731,19 +716,7 @@ void HtmlWriter::writeRegisterTable(QTextStream& stream, QList<QSharedPointer<Re
     stream << indent(3) << HTML::TABLE << "" << "\">" << Qt::endl;
     writeTableHeader(stream, allRegistersTableHeader, 4);
 
-    for (auto const& currentRegister : registers)
-    {
-        QStringList registerInfoTableRowCells(QStringList()
-            << currentRegister->name()
-            << expressionFormatter_->formatReferringExpression(currentRegister->getAddressOffset())
-            << expressionFormatter_->formatReferringExpression(currentRegister->getSize())
-            << expressionFormatter_->formatReferringExpression(currentRegister->getDimension())
-            << currentRegister->getVolatile()
-            << AccessTypes::access2Str(currentRegister->getAccess())
-        );
-
-        writeTableRow(stream, registerInfoTableRowCells, 4);
-    }
+    writeTableRows(stream, createRegisterColumns(registers), 4);
 
     stream << indent(3) << "</table>" << Qt::endl;
 }
@@ -761,21 +734,14 @@ void HtmlWriter::writeFieldTable(QTextStream& stream, QSharedPointer<Register> r
 
     writeTableHeader(stream, DocumentationWriter::FIELD_HEADERS, 4);
 
-    for (auto const& field : *reg->getFields())
+    TableColumns fieldColumns = createFieldColumns(*reg->getFields());
+    for (auto& name : fieldColumns.first())
     {
-        QStringList fieldTableCells(QStringList()
-            << "<a id=\"" + vlnvString_ + ".field." + field->name() + "\">" + field->name() + "</a>"
-            << expressionFormatter_->formatReferringExpression(field->getBitOffset())
-            << expressionFormatter_->formatReferringExpression(field->getBitWidth())
-            << field->getVolatile().toString()
-            << AccessTypes::access2Str(field->getAccess())
-            << getFieldResetInfo(field)
-            << field->description()
-        );
-
-        writeTableRow(stream, fieldTableCells, 4);
+        name = "<a id=\"" + vlnvString_ + ".field." + name + "\">" + name + "</a>";
     }
 
+    writeTableRows(stream, fieldColumns, 4);
+
     stream << indent(3) << "</table>" << Qt::endl;
 }
 
@@ -819,6 +785,54 @@ void HtmlWriter::writeTableRow(QTextStream& stream, QStringList const& cells, in
     stream << indent(indentation) << "</tr>" << Qt::endl;
 }
 
+//-----------------------------------------------------------------------------
+// Function: HtmlWriter::writeTableRows()
+//-----------------------------------------------------------------------------
+void HtmlWriter::writeTableRows(QTextStream& stream, TableColumns const& columns, int indentation) const
+{
+    if (columns.isEmpty())
+    {
+        return;
+    }
+
+    const int rowCount = columns.first().size();
+
+    const QString rowStart = indent(indentation) + QStringLiteral("<tr>\n");
+    const QString rowEnd = indent(indentation) + QStringLiteral("</tr>\n");
+    const QString cellStart = indent(indentation + 1) + QStringLiteral("<td>");
+    const QString cellEnd = QStringLiteral("</td>\n");
+
+    // Reserve the whole table at once to avoid reallocating while appending the rows.
+    qsizetype tableLength = rowCount * (rowStart.size() + rowEnd.size() +
+        columns.size() * (cellStart.size() + cellEnd.size()));
+    for (auto const& column : columns)
+    {
+        for (auto const& cell : column)
+        {
+            tableLength += cell.size();
+        }
+    }
+
+    QString table;
+    table.reserve(tableLength);
+
+    for (int row = 0; row < rowCount; ++row)
+    {
+        table.append(rowStart);
+
+        for (auto const& column : columns)
+        {
+            table.append(cellStart);
+            table.append(column.at(row));
+            table.append(cellEnd);
+        }
+
+        table.append(rowEnd);
+    }
+
+    stream << table;
+}
+
 //-----------------------------------------------------------------------------
 // Function: HtmlWriter::writeTableHeader()
 //-----------------------------------------------------------------------------
@@ -844,24 +858,14 @@ void HtmlWriter::writePortTable(QTextStream& stream, QString const& tableTitle,
 
     writeTableHeader(stream, DocumentationWriter::PORT_HEADERS, 4);
 
-    for (auto const& port : ports)
+    TableColumns portColumns = createPortColumns(ports);
+    for (auto& name : portColumns.first())
     {
-        QStringList portTableCells(QStringList()
-            << "<a id=\"" + vlnvString_ + ".port." + port->name() + "\">" + port->name() + "</a>"
-            << DirectionTypes::direction2Str(port->getDirection())
-            << expressionFormatter_->formatReferringExpression(port->getLeftBound())
-            << expressionFormatter_->formatReferringExpression(port->getRightBound())
-            << port->getTypeName()
-            << port->getTypeDefinition(port->getTypeName())
-            << expressionFormatter_->formatReferringExpression(port->getDefaultValue())
-            << expressionFormatter_->formatReferringExpression(port->getArrayLeft())
-            << expressionFormatter_->formatReferringExpression(port->getArrayRight())
-            << port->description()
-        );
-
-        writeTableRow(stream, portTableCells, 4);
+        name = "<a id=\"" + vlnvString_ + ".port." + name + "\">" + name + "</a>";
     }
 
+    writeTableRows(stream, portColumns, 4);
+
     stream << indent(3) << "</table>" << Qt::endl;
 }
 
@@ -1153,26 +1157,7 @@ void HtmlWriter::writeModuleParameterTable(QTextStream& stream, QString const& t
     stream << indent(3) << HTML::TABLE << "\">" << Qt::endl;
     writeTableHeader(stream, DocumentationWriter::MODULE_PARAMETER_HEADERS, 4);
 
-    for (auto const& parameter : *moduleParameters)
-    {
-        QSharedPointer<ModuleParameter> moduleParameter = parameter.dynamicCast<ModuleParameter>();
-
-        QStringList paramCells(QStringList()
-            << moduleParameter->name()
-            << moduleParameter->getType()
-            << formatter->formatReferringExpression(moduleParameter->getValue())
-            << moduleParameter->getDataType()
-            << moduleParameter->getUsageType()
-            << moduleParameter->getValueResolve()
-            << formatter->formatReferringExpression(moduleParameter->getVectorLeft())
-            << formatter->formatReferringExpression(moduleParameter->getVectorRight())
-            << formatter->formatReferringExpression(moduleParameter->getArrayLeft())
-            << formatter->formatReferringExpression(moduleParameter->getArrayRight())
-            << moduleParameter->description()
-        );
-
-        writeTableRow(stream, paramCells, 4);
-    }
+    writeTableRows(stream, createModuleParameterColumns(*moduleParameters, formatter.data()), 4);
 
     stream << indent(3) << "</table>" << Qt::endl;
 }
@@ -1236,22 +1221,7 @@ void HtmlWriter::writeParameterTable(QTextStream& stream, QString const& tableHe
 
     writeTableHeader(stream, DocumentationWriter::PARAMETER_HEADERS, 4);
 
-    for (auto const& parameter : *parameters)
-    {
-        QStringList paramCells(QStringList()
-            << parameter->name()
-            << parameter->getType()
-            << formatter->formatReferringExpression(parameter->getValue())
-            << parameter->getValueResolve()
-            << formatter->formatReferringExpression(parameter->getVectorLeft())
-            << formatter->formatReferringExpression(parameter->getVectorRight())
-            << formatter->formatReferringExpression(parameter->getArrayLeft())
-            << formatter->formatReferringExpression(parameter->getArrayRight())
-            << parameter->description()
-        );
-
-        writeTableRow(stream, paramCells, 4);
-    }
+    writeTableRows(stream, createParameterColumns(*parameters, formatter.data()), 4);
 
     stream << indent(3) << "</table>" << Qt::endl;
 }
@@ -294,6 +294,16 @@ private:
      */
     void writeTableRow(QTextStream& stream, QStringList const& cells, int indentation) const;
 
+    /*!
+     *  Writes the rows of a HTML table in one go with chosen indentation.
+     *  Indentation is the number of tabs for the parent element.
+     *
+     *    @param [in] stream          Text stream to write to.
+     *    @param [in] columns         The table cells, column by column.
+     *    @param [in] indentation     The table element indentation.
+     */
+    void writeTableRows(QTextStream& stream, TableColumns const& columns, int indentation) const;
+
     /*!
      *  Writes the table header row with chosen indentation. 
      *  Indentation should be one more than table element indentation.
@@ -198,23 +198,7 @@ void MarkdownWriter::writeParameters(QTextStream& stream, int subHeaderNumber)
     writeSubHeader(stream, subHeaderNumber, "General parameters", "parameters");
     
     writeTableHeader(stream, DocumentationWriter::PARAMETER_HEADERS);
-
-    for (auto const& parameter : *component_->getParameters())
-    {
-        QStringList paramCells(QStringList()
-            << parameter->name()
-            << parameter->getType()
-            << expressionFormatter_->formatReferringExpression(parameter->getValue())
-            << parameter->getValueResolve()
-            << expressionFormatter_->formatReferringExpression(parameter->getVectorLeft())
-            << expressionFormatter_->formatReferringExpression(parameter->getVectorRight())
-            << expressionFormatter_->formatReferringExpression(parameter->getArrayLeft())
-            << expressionFormatter_->formatReferringExpression(parameter->getArrayRight())
-            << parameter->description()
-        );
-
-        writeTableRow(stream, paramCells);
-    }
+    writeTableRows(stream, createParameterColumns(*component_->getParameters(), expressionFormatter_));
 }
 
 //-----------------------------------------------------------------------------
@@ -648,20 +632,7 @@ void MarkdownWriter::writeRegisterTable(QTextStream& stream, QList<QSharedPointe
     allRegistersTableHeader << DocumentationWriter::REGISTER_HEADERS;
 
     writeTableHeader(stream, allRegistersTableHeader);
-
-    for (auto const& currentRegister : registers)
-    {
-        QStringList registersTableRowCells(QStringList()
-            << currentRegister->name()
-            << expressionFormatter_->formatReferringExpression(currentRegister->getAddressOffset())
-            << expressionFormatter_->formatReferringExpression(currentRegister->getSize())
-            << expressionFormatter_->formatReferringExpression(currentRegister->getDimension())
-            << currentRegister->getVolatile()
-            << AccessTypes::access2Str(currentRegister->getAccess())
-        );
-
-        writeTableRow(stream, registersTableRowCells);
-    }
+    writeTableRows(stream, createRegisterColumns(registers));
 }
 
 //-----------------------------------------------------------------------------
@@ -676,20 +647,13 @@ void MarkdownWriter::writeFieldTable(QTextStream& stream, QSharedPointer<Registe
     writeSubHeader(stream, QList <int>(), headerTitle, 4);
     writeTableHeader(stream, DocumentationWriter::FIELD_HEADERS);
 
-    for (auto const& field : *reg->getFields())
+    TableColumns fieldColumns = createFieldColumns(*reg->getFields());
+    for (auto& name : fieldColumns.first())
     {
-        QStringList fieldTableCells(QStringList()
-            << field->name() + " <a id=\"" + vlnvString_ + ".field." + field->name() + "\">"
-            << expressionFormatter_->formatReferringExpression(field->getBitOffset())
-            << expressionFormatter_->formatReferringExpression(field->getBitWidth())
-            << field->getVolatile().toString()
-            << AccessTypes::access2Str(field->getAccess())
-            << getFieldResetInfo(field)
-            << field->description()
-        );
-
-        writeTableRow(stream, fieldTableCells);
+        name = name + " <a id=\"" + vlnvString_ + ".field." + name + "\">";
     }
+
+    writeTableRows(stream, fieldColumns);
 }
 
 //-----------------------------------------------------------------------------
@@ -727,6 +691,45 @@ void MarkdownWriter::writeTableRow(QTextStream& stream, QStringList const& cells
     stream << "|  " << Qt::endl;
 }
 
+//-----------------------------------------------------------------------------
+// Function: MarkdownWriter::writeTableRows()
+//-----------------------------------------------------------------------------
+void MarkdownWriter::writeTableRows(QTextStream& stream, TableColumns const& columns) const
+{
+    if (columns.isEmpty())
+    {
+        return;
+    }
+
+    const int rowCount = columns.first().size();
+
+    // Reserve the whole table at once: a separator per cell and a line ending per row.
+    qsizetype tableLength = rowCount * 4;
+    for (auto const& column : columns)
+    {
+        for (auto const& cell : column)
+        {
+            tableLength += cell.size() + 1;
+        }
+    }
+
+    QString table;
+    table.reserve(tableLength);
+
+    for (int row = 0; row < rowCount; ++row)
+    {
+        for (auto const& column : columns)
+        {
+            table.append(QLatin1Char('|'));
+            table.append(column.at(row));
+        }
+
+        table.append(QStringLiteral("|  \n"));
+    }
+
+    stream << table;
+}
+
 //-----------------------------------------------------------------------------
 // Function: MarkdownWriter::writeTableSeparator()
 //-----------------------------------------------------------------------------
@@ -753,23 +756,13 @@ void MarkdownWriter::writePortTable(QTextStream& stream, QList<QSharedPointer<Po
 {
     writeTableHeader(stream, DocumentationWriter::PORT_HEADERS);
 
-    for (auto const& port : ports)
+    TableColumns portColumns = createPortColumns(ports);
+    for (auto& name : portColumns.first())
     {
-        QStringList portTableCells(QStringList()
-            << port->name() + " <a id=\"" + vlnvString_ + ".port." + port->name() + "\">"
-            << DirectionTypes::direction2Str(port->getDirection())
-            << expressionFormatter_->formatReferringExpression(port->getLeftBound())
-            << expressionFormatter_->formatReferringExpression(port->getRightBound())
-            << port->getTypeName()
-            << port->getTypeDefinition(port->getTypeName())
-            << expressionFormatter_->formatReferringExpression(port->getDefaultValue())
-            << expressionFormatter_->formatReferringExpression(port->getArrayLeft())
-            << expressionFormatter_->formatReferringExpression(port->getArrayRight())
-            << port->description()
-        );
-
-        writeTableRow(stream, portTableCells);
+        name = name + " <a id=\"" + vlnvString_ + ".port." + name + "\">";
     }
+
+    writeTableRows(stream, portColumns);
 }
 
 //-----------------------------------------------------------------------------
@@ -998,23 +991,7 @@ void MarkdownWriter::writeParameterTable(QTextStream& stream, QString const& tab
     stream << "**" << tableHeading << "**  " << Qt::endl << Qt::endl;
 
     writeTableHeader(stream, DocumentationWriter::PARAMETER_HEADERS);
-
-    for (auto const& parameter : *parameters)
-    {
-        QStringList paramCells(QStringList()
-            << parameter->name()
-            << parameter->getType()
-            << formatter->formatReferringExpression(parameter->getValue())
-            << parameter->getValueResolve()
-            << formatter->formatReferringExpression(parameter->getVectorLeft())
-            << formatter->formatReferringExpression(parameter->getVectorRight())
-            << formatter->formatReferringExpression(parameter->getArrayLeft())
-            << formatter->formatReferringExpression(parameter->getArrayRight())
-            << parameter->description()
-        );
-
-        writeTableRow(stream, paramCells);
-    }
+    writeTableRows(stream, createParameterColumns(*parameters, formatter.data()));
 
     stream << Qt::endl;
 }
@@ -1031,27 +1008,7 @@ void MarkdownWriter::writeModuleParameterTable(QTextStream& stream, QString cons
     stream << "**" << tableHeading << "**  " << Qt::endl << Qt::endl;
 
     writeTableHeader(stream, DocumentationWriter::MODULE_PARAMETER_HEADERS);
-
-    for (auto const& parameter : *moduleParameters)
-    {
-        QSharedPointer<ModuleParameter> moduleParameter = parameter.dynamicCast<ModuleParameter>();
-
-        QStringList paramCells(QStringList()
-            << moduleParameter->name()
-            << moduleParameter->getType()
-            << formatter->formatReferringExpression(moduleParameter->getValue())
-            << moduleParameter->getDataType()
-            << moduleParameter->getUsageType()
-            << moduleParameter->getValueResolve()
-            << formatter->formatReferringExpression(moduleParameter->getVectorLeft())
-            << formatter->formatReferringExpression(moduleParameter->getVectorRight())
-            << formatter->formatReferringExpression(moduleParameter->getArrayLeft())
-            << formatter->formatReferringExpression(moduleParameter->getArrayRight())
-            << moduleParameter->description()
-        );
-
-        writeTableRow(stream, paramCells);
-    }
+    writeTableRows(stream, createModuleParameterColumns(*moduleParameters, formatter.data()));
 
     stream << Qt::endl;
 }
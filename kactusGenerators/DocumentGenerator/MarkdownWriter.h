@@ -295,6 +295,14 @@ private:
      */
     void writeTableRow(QTextStream& stream, QStringList const& cells) const;
 
+    /*!
+     *  Writes the rows of a MD table in one go.
+     *
+     *    @param [in] stream          Text stream to write to.
+     *    @param [in] columns         The table cells, column by column.
+     */
+    void writeTableRows(QTextStream& stream, TableColumns const& columns) const;
+
     /*!
      *  Writes a table separator to a MD table.
      *
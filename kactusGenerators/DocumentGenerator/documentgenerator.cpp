@@ -52,12 +52,13 @@
 #include <QMap>
 #include <QMessageBox>
 #include <QPainter>
-#include <QPixmap>
 #include <QRectF>
 #include <QPointF>
 #include <QBrush>
 #include <QSharedPointer>
 #include <QApplication>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtConcurrent/QtConcurrentRun>
 
 //-----------------------------------------------------------------------------
 // Function: documentgenerator::DocumentGenerator()
@@ -205,6 +206,14 @@ void DocumentGenerator::writeDocumentation(QTextStream& stream, QString targetPa
 
     parseChildItems(objects, currentComponentNumber);
 
+    // The sections not needing the library are written for all the components concurrently.
+    QList<DocumentGenerator*> generators;
+    collectGenerators(generators);
+    QtConcurrent::blockingMap(generators, [](DocumentGenerator* generator)
+        {
+            generator->prepareComponentSections();
+        });
+
     targetPath_ = targetPath;
 
     QFileInfo docInfo(targetPath_);
@@ -328,6 +337,16 @@ void DocumentGenerator::writeTableOfContents(QTextStream& stream)
 //-----------------------------------------------------------------------------
 void DocumentGenerator::writeDocumentation(QTextStream& stream, const QString& targetPath,
     QStringList& filesToInclude)
+{
+    writeComponentDocumentation(stream, targetPath);
+
+    waitForPictures(filesToInclude);
+}
+
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::writeComponentDocumentation()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::writeComponentDocumentation(QTextStream& stream, QString const& targetPath)
 {
     writer_->setTargetPath(targetPath);
     writer_->setImagesPath(imagesPath_);
@@ -336,25 +355,33 @@ void DocumentGenerator::writeDocumentation(QTextStream& stream, const QString& t
     // write the component header, picture and info
     writer_->writeComponentHeader(stream);
 
-    createComponentPicture(filesToInclude);
+    createComponentPicture();
 
     writer_->writeComponentInfo(stream);
 
     int subHeaderNumber = 1;
 
-    writeKactusAttributes(stream, subHeaderNumber);
-    writeParameters(stream, subHeaderNumber);
-    writeMemoryMaps(stream, subHeaderNumber);
-    writePorts(stream, subHeaderNumber);
-    writeInterfaces(stream, subHeaderNumber);
+    if (hasPreparedSections_)
+    {
+        stream << preparedSections_;
+        subHeaderNumber = preparedSubHeaderNumber_;
+
+        preparedSections_.clear();
+        hasPreparedSections_ = false;
+    }
+    else
+    {
+        writeComponentSections(stream, subHeaderNumber);
+    }
+
     writeFileSets(stream, subHeaderNumber);
-    writeViews(stream, subHeaderNumber, filesToInclude);
+    writeViews(stream, subHeaderNumber);
 
     // tell each child to write it's documentation
     for (auto const& generator : childInstances_)
     {
         generator->setImagesPath(imagesPath_);
-        generator->writeDocumentation(stream, targetPath, filesToInclude);
+        generator->writeComponentDocumentation(stream, targetPath);
     }
 }
 
@@ -458,7 +485,7 @@ void DocumentGenerator::writeFileSets(QTextStream& stream, int& subHeaderNumber)
 //-----------------------------------------------------------------------------
 // Function: documentgenerator::writeViews()
 //-----------------------------------------------------------------------------
-void DocumentGenerator::writeViews(QTextStream& stream, int& subHeaderNumber, QStringList& pictureList)
+void DocumentGenerator::writeViews(QTextStream& stream, int& subHeaderNumber)
 {
     if (!component_->hasViews())
     {
@@ -471,7 +498,7 @@ void DocumentGenerator::writeViews(QTextStream& stream, int& subHeaderNumber, QS
 
     for (auto const& view : *component_->getViews())
     {
-        writeSingleView(stream, view, subHeaderNumber, viewNumber, pictureList);
+        writeSingleView(stream, view, subHeaderNumber, viewNumber);
         ++viewNumber;
     }
 
@@ -498,7 +525,7 @@ void DocumentGenerator::setImagesPath(QString const& path)
 // Function: documentgenerator::writeSingleView()
 //-----------------------------------------------------------------------------
 void DocumentGenerator::writeSingleView(QTextStream& stream, QSharedPointer<View> view,
-    int const& subHeaderNumber, int const& viewNumber, QStringList& pictureList)
+    int const& subHeaderNumber, int const& viewNumber)
 {
     QList subHeaderNumbers({ componentNumber_, subHeaderNumber, viewNumber });
     writer_->writeSubHeader(stream, subHeaderNumbers, "View: " + view->name(), 3);
@@ -537,7 +564,7 @@ void DocumentGenerator::writeSingleView(QTextStream& stream, QSharedPointer<View
 
     if (view->isHierarchical())
     {
-        writeDesign(stream, view, pictureList);
+        writeDesign(stream, view);
     }
 }
 
@@ -701,7 +728,7 @@ void DocumentGenerator::writeReferencedDesignInstantiation(QTextStream& stream,
 //-----------------------------------------------------------------------------
 // Function: documentgenerator::writeDesign()
 //-----------------------------------------------------------------------------
-void DocumentGenerator::writeDesign(QTextStream& stream, QSharedPointer<View> view, QStringList& pictureList)
+void DocumentGenerator::writeDesign(QTextStream& stream, QSharedPointer<View> view)
 {
     QSharedPointer<DesignConfiguration> configuration = getDesignConfiguration(view);
     QSharedPointer<Design> design = getDesign(view, configuration);
@@ -721,7 +748,7 @@ void DocumentGenerator::writeDesign(QTextStream& stream, QSharedPointer<View> vi
         + view->name()
         + QStringLiteral(".png");
 
-    createDesignPicture(pictureList, view->name(), designPicPath);
+    createDesignPicture(view->name(), designPicPath);
 
     QString designDiagramTitle = QString("Diagram of design %1:").arg(design->getVlnv().toString());
     QString designDiagramAltText = QString("View: %1 preview picture").arg(view->name());
@@ -739,41 +766,28 @@ void DocumentGenerator::writeDesign(QTextStream& stream, QSharedPointer<View> vi
 //-----------------------------------------------------------------------------
 // Function: documentgenerator::createDesignPicture()
 //-----------------------------------------------------------------------------
-void DocumentGenerator::createDesignPicture(QStringList& pictureList,
-    QString const& viewName, QString const& designPicPath)
+void DocumentGenerator::createDesignPicture(QString const& viewName, QString const& designPicPath)
 {
     DesignWidget* designWidget(designWidgetFactory_->makeHWDesignWidget());
 
     designWidget->hide();
     designWidget->setDesign(component_->getVlnv(), viewName);
 
-    QFile designPicFile(designPicPath);
-
-    if (designPicFile.exists())
-    {
-        designPicFile.remove();
-    }
-
     // get the rect that bounds all items on box
     QRectF boundingRect = designWidget->getDiagram()->itemsBoundingRect();
     boundingRect.setHeight(boundingRect.height() + 2);
     boundingRect.setWidth(boundingRect.width() + 2);
 
     // set the size of the picture
-    QPixmap designPic(boundingRect.size().toSize());
+    QImage designPic(boundingRect.size().toSize(), QImage::Format_RGB32);
 
-    // create the picture for the component
+    // Scenes can only be rendered in the GUI thread, but an image can be saved in any thread.
     QPainter painter(&designPic);
     painter.fillRect(designPic.rect(), QBrush(Qt::white));
     designWidget->getDiagram()->render(&painter, designPic.rect(), boundingRect.toRect());
-    if (!designPic.save(&designPicFile, "PNG"))
-    {
-        emit errorMessage(tr("Could not save picture %1").arg(designPicPath));
-    }
-    else
-    {
-        pictureList.append(designPicPath);
-    }
+    painter.end();
+
+    savePicture(designPic, designPicPath);
 }
 
 //-----------------------------------------------------------------------------
@@ -916,7 +930,7 @@ QSharedPointer<Design> DocumentGenerator::getDesign(QSharedPointer<View> view,
 //-----------------------------------------------------------------------------
 // Function: documentgenerator::createComponentPicture()
 //-----------------------------------------------------------------------------
-void DocumentGenerator::createComponentPicture(QStringList& pictureList)
+void DocumentGenerator::createComponentPicture()
 {
     ComponentPreviewBox compBox(libraryHandler_);
     compBox.hide();
@@ -927,31 +941,110 @@ void DocumentGenerator::createComponentPicture(QStringList& pictureList)
         + component_->getVlnv().toString(".")
         + ".png";
 
-    QFile compPicFile(compPicPath);
-
-    if (compPicFile.exists())
-    {
-        compPicFile.remove();
-    }
-
     // get the rect that bounds all items on box
     QRectF boundingRect = compBox.itemsBoundingRect();
     boundingRect.setHeight(boundingRect.height() + 2);
     boundingRect.setWidth(boundingRect.width() + 2);
 
     // set the size of the picture
-    QPixmap compPic(boundingRect.size().toSize());
+    QImage compPic(boundingRect.size().toSize(), QImage::Format_RGB32);
 
     // create the picture for the component
     QPainter painter(&compPic);
     painter.fillRect(compPic.rect(), QBrush(Qt::white));
     compBox.scene()->render(&painter, compPic.rect(), boundingRect.toRect());
-    if (!compPic.save(&compPicFile, "PNG"))
+    painter.end();
+
+    savePicture(compPic, compPicPath);
+}
+
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::collectGenerators()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::collectGenerators(QList<DocumentGenerator*>& generators)
+{
+    generators.append(this);
+
+    for (auto const& generator : childInstances_)
     {
-        emit errorMessage(tr("Could not save picture %1").arg(compPicPath));
+        generator->collectGenerators(generators);
     }
-    else
+}
+
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::prepareComponentSections()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::prepareComponentSections()
+{
+    if (!component_)
+    {
+        return;
+    }
+
+    preparedSections_.clear();
+    QTextStream sectionStream(&preparedSections_);
+
+    int subHeaderNumber = 1;
+    writeComponentSections(sectionStream, subHeaderNumber);
+
+    sectionStream.flush();
+
+    preparedSubHeaderNumber_ = subHeaderNumber;
+    hasPreparedSections_ = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::writeComponentSections()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::writeComponentSections(QTextStream& stream, int& subHeaderNumber)
+{
+    writeKactusAttributes(stream, subHeaderNumber);
+    writeParameters(stream, subHeaderNumber);
+    writeMemoryMaps(stream, subHeaderNumber);
+    writePorts(stream, subHeaderNumber);
+    writeInterfaces(stream, subHeaderNumber);
+}
+
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::savePicture()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::savePicture(QImage const& picture, QString const& picturePath)
+{
+    QFuture<bool> saveResult = QtConcurrent::run([picture, picturePath]()
+        {
+            QFile pictureFile(picturePath);
+            if (pictureFile.exists())
+            {
+                pictureFile.remove();
+            }
+
+            return picture.save(&pictureFile, "PNG");
+        });
+
+    pendingPictures_.append(qMakePair(picturePath, saveResult));
+}
+
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::waitForPictures()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::waitForPictures(QStringList& pictureList)
+{
+    for (auto& pendingPicture : pendingPictures_)
+    {
+        if (pendingPicture.second.result())
+        {
+            pictureList.append(pendingPicture.first);
+        }
+        else
+        {
+            emit errorMessage(tr("Could not save picture %1").arg(pendingPicture.first));
+        }
+    }
+
+    pendingPictures_.clear();
+
+    for (auto const& generator : childInstances_)
     {
-        pictureList.append(compPicPath);
+        generator->waitForPictures(pictureList);
     }
 }
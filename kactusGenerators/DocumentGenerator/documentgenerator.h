@@ -27,6 +27,8 @@
 #include <IPXACTmodels/Component/Component.h>
 
 #include <QTextStream>
+#include <QFuture>
+#include <QImage>
 #include <QList>
 #include <QSharedPointer>
 #include <QStringList>
@@ -193,9 +195,8 @@ public:
      *
      *    @param [in] stream              The text stream to write the component views.
      *    @param [in] subHeaderNumber     The number that defines the sub header.
-     *    @param [in] pictureList         List of file names to add the pictures of the referenced designs to.
      */
-    void writeViews(QTextStream& stream, int& subHeaderNumber, QStringList& pictureList);
+    void writeViews(QTextStream& stream, int& subHeaderNumber);
     
     /*!
      *  Write the end of the document, if the format requires it.
@@ -239,10 +240,9 @@ private:
      *    @param [in] view                The selected view.
      *    @param [in] subHeaderNumber     Number for the sub header.
      *    @param [in] viewNumber          Number defining the selected view.
-     *    @param [in] pictureList         List of file names to add the pictures of the referenced designs to.
      */
     void writeSingleView(QTextStream& stream, QSharedPointer<View> view,
-        int const& subHeaderNumber, int const& viewNumber, QStringList& pictureList);
+        int const& subHeaderNumber, int const& viewNumber);
 
     /*!
      *  Write the referenced component instantiation.
@@ -286,17 +286,16 @@ private:
         *    @param [in] stream          Text stream to write the design diagram.
         *    @param [in] viewTabs        Design diagram indentation in the file.
         *    @param [in] view            View containing the design and design configuration references.
-        *    @param [in] pictureList     List of file names to add the pictures of the referenced designs to.
         */
-    void writeDesign(QTextStream& stream, QSharedPointer<View> view, QStringList& pictureList);
+    void writeDesign(QTextStream& stream, QSharedPointer<View> view);
 
     /*!
-    *  Create a picture for the design
+    *  Create a picture for the design. The picture is saved in the background.
     *
-    *    @param [in] pictureList     List of file names to add the path of the created picture to.
     *    @param [in] viewName        Name of the view to create the design picture for.
+    *    @param [in] designPicPath   Path of the file to save the picture into.
     */
-    void createDesignPicture(QStringList& pictureList, QString const& viewName, QString const& designPicPath);
+    void createDesignPicture(QString const& viewName, QString const& designPicPath);
 
     /*!
      *  Get the selected design instantiation.
@@ -364,11 +363,54 @@ private:
     void parseChildItems(QList<VLNV>& objects, int& currentComponentNumber);
 
     /*!
-     *  Create a picture for the component.
+     *  Create a picture for the component. The picture is saved in the background.
+     */
+    void createComponentPicture();
+
+    /*!
+     *  Write the documentation for the component and the components under it, without waiting for
+     *  the pictures to be saved.
+     *
+     *    @param [in] stream          The text stream to write the documentation into.
+     *    @param [in] targetPath      File path to the file to be written.
+     */
+    void writeComponentDocumentation(QTextStream& stream, QString const& targetPath);
+
+    /*!
+     *  Get this generator and all the generators under it in the document order.
+     *
+     *    @param [out] generators     List to add the generators to.
+     */
+    void collectGenerators(QList<DocumentGenerator*>& generators);
+
+    /*!
+     *  Write the sections of the component that do not need the library into a buffer.
+     *  Does not use any data shared with the other generators, so it may be called concurrently.
+     */
+    void prepareComponentSections();
+
+    /*!
+     *  Write the kactus2 attributes, parameters, memory maps, ports and interfaces of the component.
+     *
+     *    @param [in] stream              The text stream to write the sections into.
+     *    @param [in/out] subHeaderNumber The number of the first section, incremented for each written section.
+     */
+    void writeComponentSections(QTextStream& stream, int& subHeaderNumber);
+
+    /*!
+     *  Save a rendered picture as PNG in the background.
+     *
+     *    @param [in] picture         The rendered picture.
+     *    @param [in] picturePath     Path of the file to save the picture into.
+     */
+    void savePicture(QImage const& picture, QString const& picturePath);
+
+    /*!
+     *  Wait until the pictures of this generator and the generators under it have been saved.
      *
-     *    @param [in] pictureList     List of file names to add the path of the created picture to.
+     *    @param [in] pictureList     List of file names to add the paths of the saved pictures to.
      */
-    void createComponentPicture(QStringList& pictureList);
+    void waitForPictures(QStringList& pictureList);
 
     //-----------------------------------------------------------------------------
     // Data.
@@ -418,6 +460,18 @@ private:
 
     //! The image save path
     QString imagesPath_;
+
+    //! The kactus2 attributes, parameters, memory maps, ports and interfaces written in advance.
+    QString preparedSections_;
+
+    //! Flag for indicating that the sections have been written in advance.
+    bool hasPreparedSections_ = false;
+
+    //! The sub header number following the sections written in advance.
+    int preparedSubHeaderNumber_ = 0;
+
+    //! The pictures being saved in the background, with their file paths.
+    QList<QPair<QString, QFuture<bool> > > pendingPictures_;
 };
 
 #endif // DOCUMENTGENERATOR_H
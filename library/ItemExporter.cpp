@@ -67,6 +67,9 @@ void ItemExporter::onExportItems(const QList<VLNV> vlnvs)
 
     QString destinationPath = exportDialog->getTargetDirectory();
 
+    // The exported files are copied from the library, so any pending saves must be written first.
+    libraryAccess_->waitForSaves();
+
     DocumentStatistics exportStatistics = exportSelectedObjects(exportDialog->getSelectedItems(), destinationPath);
 
     emit noticeMessage(createExportMessage(exportStatistics, destinationPath));
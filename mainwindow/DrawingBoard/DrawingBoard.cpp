@@ -15,6 +15,8 @@
 
 #include <IPXACTmodels/common/VLNV.h>
 
+#include <KactusAPI/include/LibraryHandler.h>
+
 #include <QCoreApplication>
 #include <QKeyEvent>
 #include <QObject>
@@ -30,6 +32,11 @@ DrawingBoard::DrawingBoard(QWidget* parent) : QTabWidget(parent)
 {
     connect(this, SIGNAL(tabCloseRequested(int)), this, SLOT(closeAndRemoveDocument(int)), Qt::UniqueConnection);
 
+    connect(&LibraryHandler::getInstance(), &LibraryHandler::saveFailed,
+        this, &DrawingBoard::onDocumentSaveFailed, Qt::UniqueConnection);
+    connect(&LibraryHandler::getInstance(), &LibraryHandler::documentFileChanged,
+        this, &DrawingBoard::onDocumentFileChanged, Qt::UniqueConnection);
+
     tabBar()->installEventFilter(this);
 }
 
@@ -62,6 +69,17 @@ void DrawingBoard::addAndOpenDocument(TabDocument* doc)
         connect(doc->getEditProvider().data(), SIGNAL(editStateChanged()), this, SIGNAL(documentEditStateChanged()));
     }
 
+    // Keep the edited document in the library cache while the editor is open.
+    VLNV documentVLNV = doc->getDocumentVLNV();
+    if (documentVLNV.isValid())
+    {
+        LibraryHandler::getInstance().pinDocument(documentVLNV);
+        connect(doc, &QObject::destroyed, this, [documentVLNV]()
+            {
+                LibraryHandler::getInstance().unpinDocument(documentVLNV);
+            });
+    }
+
     addTab(doc, doc->getTitle());
     setCurrentWidget(doc);
 }
@@ -370,6 +388,55 @@ void DrawingBoard::onDocumentSaved(TabDocument* doc)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: DrawingBoard::onDocumentSaveFailed()
+//-----------------------------------------------------------------------------
+void DrawingBoard::onDocumentSaveFailed(VLNV const& vlnv)
+{
+    // The editors cleared their modified state when the save was started, so the unwritten changes are
+    // marked again to keep them from being lost.
+    int documentCount = count();
+    for (int i = 0; i < documentCount; i++)
+    {
+        TabDocument* doc = static_cast<TabDocument*>(widget(i));
+
+        if (doc->getDocumentVLNV() == vlnv || doc->getIdentifyingVLNV() == vlnv)
+        {
+            doc->setModified(true);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: DrawingBoard::onDocumentFileChanged()
+//-----------------------------------------------------------------------------
+void DrawingBoard::onDocumentFileChanged(VLNV const& vlnv)
+{
+    int documentCount = count();
+    for (int i = 0; i < documentCount; i++)
+    {
+        TabDocument* doc = static_cast<TabDocument*>(widget(i));
+
+        if (doc->getDocumentVLNV() == vlnv || doc->getIdentifyingVLNV() == vlnv)
+        {
+            // Unsaved changes are kept, but saving them overwrites the changes in the file.
+            if (doc->isModified())
+            {
+                emit errorMessage(tr("The file of %1 was modified outside Kactus2. Saving the open document "
+                    "will overwrite the changes.").arg(vlnv.toString()));
+            }
+            else
+            {
+                doc->refresh();
+            }
+        }
+        else if (doc->getRelatedVLNVs().contains(vlnv))
+        {
+            doc->requestRefresh();
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: DrawingBoard::shouldSave()
 //-----------------------------------------------------------------------------
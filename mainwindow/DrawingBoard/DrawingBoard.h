@@ -12,6 +12,8 @@
 #ifndef DRAWINGBOARD_H
 #define DRAWINGBOARD_H
 
+#include <IPXACTmodels/common/VLNV.h>
+
 #include <QTabWidget>
 
 class TabDocument;
@@ -124,6 +126,20 @@ private slots:
     //! Called when a document has been saved.
     void onDocumentSaved(TabDocument* doc);
 
+    /*!
+     *  Marks the documents modified again, when the file of a saved document could not be written.
+     *
+     *    @param [in] vlnv    Identifies the document that was not written.
+     */
+    void onDocumentSaveFailed(VLNV const& vlnv);
+
+    /*!
+     *  Reloads the unmodified documents, when the file of a document was modified outside the library.
+     *
+     *    @param [in] vlnv    Identifies the modified document.
+     */
+    void onDocumentFileChanged(VLNV const& vlnv);
+
 private:
     // Disable copying.
     DrawingBoard(DrawingBoard const& rhs);
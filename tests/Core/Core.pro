@@ -20,6 +20,8 @@ SUBDIRS += \
             tst_ExpressionEditor.pro \
             tst_ValueFormatter.pro \
             tst_ComponentParameterModel.pro \
+            tst_CellValueCache.pro \
+            tst_PortsModel.pro \
             tst_ParameterReferenceTree.pro \
             tst_VLNVComparator.pro \
             tst_ViewComparator.pro \
@@ -41,6 +41,8 @@ private slots:
 
     void testExpressions();
 
+    void testRegistersAddedOnExpandAreVisible();
+
 private:
     void expandItem(AddressBlockGraphItem* memoryMapItem);
 
@@ -247,6 +249,47 @@ void tst_AddressBlockGraphItem::testExpressions()
     delete addressBlockItem;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_AddressBlockGraphItem::testRegistersAddedOnExpandAreVisible()
+//-----------------------------------------------------------------------------
+void tst_AddressBlockGraphItem::testRegistersAddedOnExpandAreVisible()
+{
+    QSharedPointer<AddressBlock> addressBlock(new AddressBlock());
+    addressBlock->setBaseAddress(0);
+    addressBlock->setRange("1");
+
+    QSharedPointer<ExpressionParser> noParser(new NullParser());
+
+    AddressBlockGraphItem* addressBlockItem = new AddressBlockGraphItem(addressBlock, noParser, 0);
+    addressBlockItem->setAddressableUnitBits(8);
+    addressBlockItem->setChildrenPending(true);
+    addressBlockItem->redoChildLayout();
+
+    QSignalSpy expandSpy(addressBlockItem, SIGNAL(expandStateChanged()));
+
+    expandItem(addressBlockItem);
+
+    QCOMPARE(expandSpy.count(), 1);
+    QVERIFY(addressBlockItem->isExpanded());
+
+    // The address block tree item creates the deferred registers when the expansion is signaled.
+    QSharedPointer<Register> reg(new Register());
+    reg->setAddressOffset("0");
+    reg->setSize("8");
+    addressBlock->getRegisterData()->append(reg);
+
+    RegisterGraphItem* registerItem = new RegisterGraphItem(reg, noParser, addressBlockItem);
+    addressBlockItem->addChild(registerItem);
+    addressBlockItem->setChildrenPending(false);
+    addressBlockItem->redoChildLayout();
+
+    QVERIFY(registerItem->isVisible());
+    QCOMPARE(registerItem->pos().y(), qreal(VisualizerItem::DEFAULT_HEIGHT));
+    QCOMPARE(registerItem->getDisplayOffset(), quint64(0));
+
+    delete addressBlockItem;
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_MemoryMapGraphItem::expandItem()
 //-----------------------------------------------------------------------------
@@ -0,0 +1,175 @@
+//-----------------------------------------------------------------------------
+// File: tst_CellValueCache.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class CellValueCache.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QStandardItemModel>
+
+#include <editors/ComponentEditor/common/CellValueCache.h>
+
+class tst_CellValueCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_CellValueCache();
+
+private slots:
+
+    void testStoredValueIsReturned();
+    void testInvalidValueIsNotStored();
+    void testInvalidatedRowsAreDiscarded();
+
+    void testDataChangeDiscardsChangedRows();
+    void testRowChangesDiscardAllValues();
+    void testResetDiscardsAllValues();
+
+private:
+
+    void fillCache(CellValueCache& cache, int rowCount) const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_CellValueCache::tst_CellValueCache()
+//-----------------------------------------------------------------------------
+tst_CellValueCache::tst_CellValueCache()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CellValueCache::testStoredValueIsReturned()
+//-----------------------------------------------------------------------------
+void tst_CellValueCache::testStoredValueIsReturned()
+{
+    CellValueCache cache;
+    cache.insert(2, 1, Qt::DisplayRole, QString("display"));
+    cache.insert(2, 1, Qt::ToolTipRole, QString("tooltip"));
+
+    QCOMPARE(cache.value(2, 1, Qt::DisplayRole).toString(), QString("display"));
+    QCOMPARE(cache.value(2, 1, Qt::ToolTipRole).toString(), QString("tooltip"));
+
+    QVERIFY(cache.value(2, 0, Qt::DisplayRole).isValid() == false);
+    QVERIFY(cache.value(1, 1, Qt::DisplayRole).isValid() == false);
+    QVERIFY(cache.value(5, 1, Qt::DisplayRole).isValid() == false);
+    QVERIFY(cache.value(-1, 1, Qt::DisplayRole).isValid() == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CellValueCache::testInvalidValueIsNotStored()
+//-----------------------------------------------------------------------------
+void tst_CellValueCache::testInvalidValueIsNotStored()
+{
+    CellValueCache cache;
+    cache.insert(0, 0, Qt::DisplayRole, QVariant());
+    cache.insert(-1, 0, Qt::DisplayRole, QString("negative"));
+
+    QVERIFY(cache.value(0, 0, Qt::DisplayRole).isValid() == false);
+    QVERIFY(cache.value(-1, 0, Qt::DisplayRole).isValid() == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CellValueCache::testInvalidatedRowsAreDiscarded()
+//-----------------------------------------------------------------------------
+void tst_CellValueCache::testInvalidatedRowsAreDiscarded()
+{
+    CellValueCache cache;
+    fillCache(cache, 4);
+
+    cache.invalidateRows(1, 2);
+
+    QCOMPARE(cache.value(0, 0, Qt::DisplayRole).toInt(), 0);
+    QVERIFY(cache.value(1, 0, Qt::DisplayRole).isValid() == false);
+    QVERIFY(cache.value(2, 0, Qt::DisplayRole).isValid() == false);
+    QCOMPARE(cache.value(3, 0, Qt::DisplayRole).toInt(), 3);
+
+    // Rows outside the cached ones are ignored.
+    cache.invalidateRows(3, 10);
+    QVERIFY(cache.value(3, 0, Qt::DisplayRole).isValid() == false);
+    QCOMPARE(cache.value(0, 0, Qt::DisplayRole).toInt(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CellValueCache::testDataChangeDiscardsChangedRows()
+//-----------------------------------------------------------------------------
+void tst_CellValueCache::testDataChangeDiscardsChangedRows()
+{
+    QStandardItemModel model(3, 2);
+
+    CellValueCache cache;
+    cache.followModel(&model);
+    fillCache(cache, 3);
+
+    model.setData(model.index(1, 1), QString("changed"));
+
+    QCOMPARE(cache.value(0, 0, Qt::DisplayRole).toInt(), 0);
+    QVERIFY(cache.value(1, 0, Qt::DisplayRole).isValid() == false);
+    QCOMPARE(cache.value(2, 0, Qt::DisplayRole).toInt(), 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CellValueCache::testRowChangesDiscardAllValues()
+//-----------------------------------------------------------------------------
+void tst_CellValueCache::testRowChangesDiscardAllValues()
+{
+    QStandardItemModel model(3, 2);
+
+    CellValueCache cache;
+    cache.followModel(&model);
+
+    fillCache(cache, 3);
+    model.insertRow(1);
+
+    for (int row = 0; row < 3; ++row)
+    {
+        QVERIFY(cache.value(row, 0, Qt::DisplayRole).isValid() == false);
+    }
+
+    fillCache(cache, 3);
+    model.removeRow(0);
+
+    for (int row = 0; row < 3; ++row)
+    {
+        QVERIFY(cache.value(row, 0, Qt::DisplayRole).isValid() == false);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CellValueCache::testResetDiscardsAllValues()
+//-----------------------------------------------------------------------------
+void tst_CellValueCache::testResetDiscardsAllValues()
+{
+    QStandardItemModel model(3, 2);
+
+    CellValueCache cache;
+    cache.followModel(&model);
+
+    fillCache(cache, 3);
+    model.clear();
+
+    for (int row = 0; row < 3; ++row)
+    {
+        QVERIFY(cache.value(row, 0, Qt::DisplayRole).isValid() == false);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CellValueCache::fillCache()
+//-----------------------------------------------------------------------------
+void tst_CellValueCache::fillCache(CellValueCache& cache, int rowCount) const
+{
+    for (int row = 0; row < rowCount; ++row)
+    {
+        cache.insert(row, 0, Qt::DisplayRole, row);
+    }
+}
+
+QTEST_MAIN(tst_CellValueCache)
+
+#include "tst_CellValueCache.moc"
@@ -0,0 +1,7 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Tools.
+# ------------------------------------------------------
+
+HEADERS += ../../editors/ComponentEditor/common/CellValueCache.h
+SOURCES += ../../editors/ComponentEditor/common/CellValueCache.cpp \
+    ./tst_CellValueCache.cpp
@@ -2,7 +2,7 @@ TEMPLATE = app
 
 TARGET = tst_DocumentGenerator
 
-QT += core xml gui widgets testlib printsupport svg
+QT += core xml gui widgets testlib printsupport svg concurrent
 CONFIG += c++11 testcase console
 
 QMAKE_EXPORTED_VARIABLES += MAKE_TESTARGS
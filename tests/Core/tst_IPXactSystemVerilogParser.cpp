@@ -62,6 +62,8 @@ private slots:
 
     void testGetBaseForExpression();
 
+    void testEvaluateExpression();
+
     void testExpressionWithRealValueParameterReferences();
     void testExpressionWithRealValueParameterReferences_data();
 
@@ -422,6 +424,36 @@ void tst_IPXactSystemVerilogParser::testGetBaseForExpression()
     QCOMPARE(parser.baseForExpression(QString("2*first")), 16);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testEvaluateExpression()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testEvaluateExpression()
+{
+    QSharedPointer<Component> testComponent(new Component(VLNV(), Document::Revision::Std14));
+    QSharedPointer<Parameter> firstParameter(new Parameter());
+    firstParameter->setValueId("first");
+    firstParameter->setValue("'h1");
+    testComponent->getParameters()->append(firstParameter);
+
+    QSharedPointer<Parameter> secondParameter(new Parameter());
+    secondParameter->setValueId("second");
+    secondParameter->setValue("4");
+    testComponent->getParameters()->append(secondParameter);
+
+    IPXactSystemVerilogParser parser(QSharedPointer<ParameterFinder>(new ComponentParameterFinder(testComponent)));
+
+    QString const expression("2*first + second");
+    ExpressionParser::Evaluation evaluation = parser.evaluate(expression);
+
+    QCOMPARE(evaluation.valid, true);
+    QCOMPARE(evaluation.value, parser.parseExpression(expression));
+    QCOMPARE(evaluation.base, parser.baseForExpression(expression));
+    QCOMPARE(evaluation.references, QStringList({ "first", "second" }));
+
+    ExpressionParser::Evaluation invalid = parser.evaluate(QString("2*"));
+    QCOMPARE(invalid.valid, false);
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_IPXactSystemVerilogParser::testExpressionWithRealParameterReferences()
 //-----------------------------------------------------------------------------
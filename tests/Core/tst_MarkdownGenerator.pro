@@ -13,7 +13,7 @@ TEMPLATE = app
 
 TARGET = tst_MarkdownGenerator
 
-QT += core xml gui widgets testlib printsupport svg
+QT += core xml gui widgets testlib printsupport svg concurrent
 CONFIG += c++11 testcase console
 
 QMAKE_EXPORTED_VARIABLES += MAKE_TESTARGS
@@ -70,6 +70,8 @@ private slots:
 
     void testReferenceAsAnExpressionInParameter();
     void testMultipleReferencesInSameExpression();
+    void testIdInsideLongerIdentifierIsNotReference();
+    void testReferencesBetweenOperatorsWithoutSpaces();
 
     void testReferenceInViewParameterValueAddsFiveRows();
     void testReferenceInViewModuleParameterValueAddsFiveRows();
@@ -102,6 +104,8 @@ private slots:
 
     void testRerefencesInMultiplePlaces();
 
+    void testReferenceIndexFollowsModelChanges();
+
 private:
     QSharedPointer<Parameter> createTestParameter(QString const& name, QString const& value, 
         QString const& bitWidthLeft, QString const& bitWidthRight, QString const& arrayLeft,
@@ -614,6 +618,82 @@ void tst_ParameterReferenceTree::testMultipleReferencesInSameExpression()
     QCOMPARE(tree->topLevelItem(0)->child(0)->child(0)->childCount(), 0);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterReferenceTree::testIdInsideLongerIdentifierIsNotReference()
+//-----------------------------------------------------------------------------
+void tst_ParameterReferenceTree::testIdInsideLongerIdentifierIsNotReference()
+{
+    QSharedPointer<Parameter> searched(new Parameter);
+    searched->setName("searchedParameter");
+    searched->setValueId("searched");
+
+    QSharedPointer<Parameter> referencer = createTestParameter("referencer", "searched_2 + searched", "", "",
+        "", "");
+    QSharedPointer<Parameter> nonReferencer = createTestParameter("nonReferencer", "searched_2", "searchedOther",
+        "", "", "");
+
+    QSharedPointer<Component> component(new Component(VLNV(), Document::Revision::Std14));
+    component->getParameters()->append(searched);
+    component->getParameters()->append(referencer);
+    component->getParameters()->append(nonReferencer);
+
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
+    QSharedPointer<ComponentParameterReferenceCounter> referenceCounter(
+        new ComponentParameterReferenceCounter(finder, component));
+
+    QCOMPARE(referenceCounter->countReferencesInExpression(QStringLiteral("searched"), referencer->getValue()), 1);
+    QCOMPARE(referenceCounter->countReferencesInSingleParameter(QStringLiteral("searched"), nonReferencer), 0);
+    QCOMPARE(referenceCounter->countReferencesInParameters(QStringLiteral("searched"),
+        component->getParameters()), 1);
+    QCOMPARE(referenceCounter->countReferencesInComponent(QStringLiteral("searched")), 1);
+
+    ComponentParameterReferenceTree tree(component, createTestExpressionFormatter(component), referenceCounter);
+    tree.openReferenceTree(QStringLiteral("searched"));
+
+    QCOMPARE(tree.topLevelItemCount(), 1);
+    QCOMPARE(tree.topLevelItem(0)->text(ParameterReferenceTree::ITEM_NAME), QStringLiteral("Parameters"));
+    QCOMPARE(tree.topLevelItem(0)->childCount(), 1);
+    QCOMPARE(tree.topLevelItem(0)->child(0)->text(ParameterReferenceTree::ITEM_NAME), referencer->name());
+    QCOMPARE(tree.topLevelItem(0)->child(0)->childCount(), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterReferenceTree::testReferencesBetweenOperatorsWithoutSpaces()
+//-----------------------------------------------------------------------------
+void tst_ParameterReferenceTree::testReferencesBetweenOperatorsWithoutSpaces()
+{
+    QSharedPointer<Parameter> searched(new Parameter);
+    searched->setName("searchedParameter");
+    searched->setValueId("searched");
+
+    QSharedPointer<Parameter> ternaryReferencer = createTestParameter("ternary", "searched?searched:8'h1F", "",
+        "", "", "");
+    QSharedPointer<Parameter> rangeReferencer = createTestParameter("range", "{searched,2}", "[searched:0]", "",
+        "", "");
+
+    QSharedPointer<Component> component(new Component(VLNV(), Document::Revision::Std14));
+    component->getParameters()->append(searched);
+    component->getParameters()->append(ternaryReferencer);
+    component->getParameters()->append(rangeReferencer);
+
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
+    QSharedPointer<ComponentParameterReferenceCounter> referenceCounter(
+        new ComponentParameterReferenceCounter(finder, component));
+
+    QCOMPARE(referenceCounter->countReferencesInExpression(QStringLiteral("searched"),
+        ternaryReferencer->getValue()), 2);
+    QCOMPARE(referenceCounter->countReferencesInExpression(QStringLiteral("searched"), "1:searched"), 1);
+    QCOMPARE(referenceCounter->countReferencesInExpression(QStringLiteral("searched"), "(searched)-1"), 1);
+    QCOMPARE(referenceCounter->countReferencesInSingleParameter(QStringLiteral("searched"), rangeReferencer), 2);
+    QCOMPARE(referenceCounter->countReferencesInComponent(QStringLiteral("searched")), 4);
+    QCOMPARE(referenceCounter->countReferencesInArea(QStringLiteral("searched"),
+        ComponentParameterReferenceCounter::PARAMETERS), 4);
+
+    // Counting stays correct after the index has been built.
+    QCOMPARE(referenceCounter->countReferencesInParameters(QStringLiteral("searched"),
+        component->getParameters()), 4);
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_ParameterReferenceTree::testReferenceInViewParameterValueAddsFiveRows()
 //-----------------------------------------------------------------------------
@@ -2383,6 +2463,78 @@ void tst_ParameterReferenceTree::testRerefencesInMultiplePlaces()
     QCOMPARE(tree->topLevelItem(7)->child(0)->child(0)->child(0)->childCount(), 0);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterReferenceTree::testReferenceIndexFollowsModelChanges()
+//-----------------------------------------------------------------------------
+void tst_ParameterReferenceTree::testReferenceIndexFollowsModelChanges()
+{
+    QSharedPointer<Parameter> searched(new Parameter);
+    searched->setName("searchedParameter");
+    searched->setValueId("searched");
+
+    QSharedPointer<Port> portRef = createTestPort("portRef", "searched + 1", "", "", "", "");
+
+    QSharedPointer<Component> component(new Component(VLNV(), Document::Revision::Std14));
+    component->getParameters()->append(searched);
+    component->getPorts()->append(portRef);
+
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
+    QSharedPointer<ComponentParameterReferenceCounter> referenceCounter(
+        new ComponentParameterReferenceCounter(finder, component));
+
+    ComponentParameterReferenceTree tree(component, createTestExpressionFormatter(component), referenceCounter);
+    tree.openReferenceTree(QStringLiteral("searched"));
+
+    QCOMPARE(tree.topLevelItemCount(), 1);
+    QCOMPARE(tree.topLevelItem(0)->text(ParameterReferenceTree::ITEM_NAME), QStringLiteral("Ports"));
+
+    // Changes reported with their area update only that area of the index.
+    component->getPorts()->clear();
+    referenceCounter->decreaseReferenceCountInArea(QStringLiteral("searched"),
+        ComponentParameterReferenceCounter::PORTS);
+
+    QSharedPointer<Parameter> pastedParameter = createTestParameter("pasted", "searched * 2", "", "", "", "");
+    component->getParameters()->append(pastedParameter);
+    referenceCounter->increaseReferenceCountInArea(QStringLiteral("searched"),
+        ComponentParameterReferenceCounter::PARAMETERS);
+
+    QCOMPARE(referenceCounter->countReferencesInComponent(QStringLiteral("searched")), 1);
+    QCOMPARE(referenceCounter->countReferencesInArea(QStringLiteral("searched"),
+        ComponentParameterReferenceCounter::PORTS), 0);
+    QCOMPARE(referenceCounter->countReferencesInArea(QStringLiteral("searched"),
+        ComponentParameterReferenceCounter::PARAMETERS), 1);
+
+    tree.openReferenceTree(QStringLiteral("searched"));
+
+    QCOMPARE(tree.topLevelItemCount(), 1);
+    QCOMPARE(tree.topLevelItem(0)->text(ParameterReferenceTree::ITEM_NAME), QStringLiteral("Parameters"));
+    QCOMPARE(tree.topLevelItem(0)->childCount(), 1);
+    QCOMPARE(tree.topLevelItem(0)->child(0)->text(ParameterReferenceTree::ITEM_NAME), pastedParameter->name());
+
+    // The reported changes are applied to the index without reading the component again.
+    QSharedPointer<Port> unreportedPort = createTestPort("unreported", "searched", "", "", "", "");
+    component->getPorts()->append(unreportedPort);
+    referenceCounter->increaseReferenceCountInArea(QStringLiteral("searched"),
+        ComponentParameterReferenceCounter::PARAMETERS);
+
+    QCOMPARE(referenceCounter->countReferencesInComponent(QStringLiteral("searched")), 2);
+    QCOMPARE(referenceCounter->countReferencesInArea(QStringLiteral("searched"),
+        ComponentParameterReferenceCounter::PORTS), 0);
+
+    // A change without an area makes the next query rebuild the index from the component.
+    component->getPorts()->clear();
+    pastedParameter->setValue("");
+    referenceCounter->decreaseReferenceCount(QStringLiteral("searched"));
+
+    QCOMPARE(referenceCounter->countReferencesInComponent(QStringLiteral("searched")), 0);
+
+    tree.openReferenceTree(QStringLiteral("searched"));
+
+    QCOMPARE(tree.topLevelItemCount(), 1);
+    QCOMPARE(tree.topLevelItem(0)->text(ParameterReferenceTree::ITEM_NAME),
+        QStringLiteral("No references found."));
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_ParameterReferenceTree::createTestParameter()
 //-----------------------------------------------------------------------------
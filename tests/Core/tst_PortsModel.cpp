@@ -0,0 +1,210 @@
+//-----------------------------------------------------------------------------
+// File: tst_PortsModel.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for the locked cells and cached values of class PortsModel.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/ComponentEditor/ports/WirePortColumns.h>
+#include <editors/ComponentEditor/ports/WirePortsModel.h>
+
+#include <KactusAPI/include/ComponentParameterFinder.h>
+#include <KactusAPI/include/ExpressionFormatter.h>
+#include <KactusAPI/include/IPXactSystemVerilogParser.h>
+#include <KactusAPI/include/PortAbstractionInterface.h>
+#include <KactusAPI/include/PortsInterface.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/Port.h>
+#include <IPXACTmodels/Component/validators/PortValidator.h>
+
+#include <IPXACTmodels/common/Parameter.h>
+
+class tst_PortsModel : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_PortsModel();
+
+private slots:
+
+    void init();
+    void cleanup();
+
+    void testLockedPortIsNotEditable();
+    void testLockedCellsFollowRemovedRows();
+    void testLockedCellsFollowAddedRows();
+
+    void testChangedValueIsShown();
+    void testClearedValuesAreFormattedAgain();
+
+private:
+
+    QModelIndex cellIndex(int row, int column) const;
+
+    bool isEditable(int row, int column) const;
+
+    //! The component containing the ports.
+    QSharedPointer<Component> component_;
+
+    //! The referenced parameter.
+    QSharedPointer<Parameter> parameter_;
+
+    //! The model under test.
+    WirePortsModel* model_ = nullptr;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsModel::tst_PortsModel()
+//-----------------------------------------------------------------------------
+tst_PortsModel::tst_PortsModel()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsModel::init()
+//-----------------------------------------------------------------------------
+void tst_PortsModel::init()
+{
+    component_ = QSharedPointer<Component>(new Component(VLNV(VLNV::COMPONENT, "TUT", "TestLibrary",
+        "TestComponent", "1.0"), Document::Revision::Std22));
+
+    parameter_ = QSharedPointer<Parameter>(new Parameter());
+    parameter_->setName("leftParameter");
+    parameter_->setValueId("leftId");
+    parameter_->setValue("7");
+    component_->getParameters()->append(parameter_);
+
+    QSharedPointer<Port> phantomPort(new Port("phantomPort"));
+    phantomPort->setDirection(DirectionTypes::DIRECTION_PHANTOM);
+    component_->getPorts()->append(phantomPort);
+
+    QSharedPointer<Port> lockedPort(new Port("lockedPort"));
+    lockedPort->setDirection(DirectionTypes::IN);
+    lockedPort->setLeftBound("leftId");
+    lockedPort->setRightBound("0");
+    component_->getPorts()->append(lockedPort);
+
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component_));
+    QSharedPointer<ExpressionParser> parser(new IPXactSystemVerilogParser(finder));
+    QSharedPointer<ExpressionFormatter> formatter(new ExpressionFormatter(finder));
+
+    QSharedPointer<PortValidator> validator(new PortValidator(parser, component_->getViews()));
+    QSharedPointer<PortsInterface> portsInterface(new PortsInterface(validator, parser, formatter));
+    portsInterface->setPorts(component_->getPorts());
+
+    model_ = new WirePortsModel(finder, portsInterface, QSharedPointer<PortAbstractionInterface>(), this);
+    model_->resetModelAndLockCurrentPorts();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsModel::cleanup()
+//-----------------------------------------------------------------------------
+void tst_PortsModel::cleanup()
+{
+    delete model_;
+    model_ = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsModel::testLockedPortIsNotEditable()
+//-----------------------------------------------------------------------------
+void tst_PortsModel::testLockedPortIsNotEditable()
+{
+    QVERIFY(isEditable(1, WirePortColumns::NAME) == false);
+    QVERIFY(isEditable(1, WirePortColumns::DIRECTION) == false);
+    QVERIFY(isEditable(1, WirePortColumns::TYPE_NAME) == false);
+    QVERIFY(isEditable(1, WirePortColumns::DESCRIPTION));
+
+    QVERIFY(model_->setData(cellIndex(1, WirePortColumns::NAME), "renamed") == false);
+
+    // Phantom ports are not locked.
+    QVERIFY(isEditable(0, WirePortColumns::NAME));
+    QVERIFY(isEditable(0, WirePortColumns::DIRECTION));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsModel::testLockedCellsFollowRemovedRows()
+//-----------------------------------------------------------------------------
+void tst_PortsModel::testLockedCellsFollowRemovedRows()
+{
+    model_->onRemoveRow(0);
+
+    QCOMPARE(model_->rowCount(), 1);
+    QVERIFY(isEditable(0, WirePortColumns::NAME) == false);
+    QVERIFY(isEditable(0, WirePortColumns::DESCRIPTION));
+
+    // The locked port cannot be removed.
+    model_->onRemoveRow(0);
+    QCOMPARE(model_->rowCount(), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsModel::testLockedCellsFollowAddedRows()
+//-----------------------------------------------------------------------------
+void tst_PortsModel::testLockedCellsFollowAddedRows()
+{
+    model_->onAddRow();
+
+    QCOMPARE(model_->rowCount(), 3);
+    QVERIFY(isEditable(0, WirePortColumns::NAME));
+    QVERIFY(isEditable(1, WirePortColumns::NAME) == false);
+    QVERIFY(isEditable(2, WirePortColumns::NAME));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsModel::testChangedValueIsShown()
+//-----------------------------------------------------------------------------
+void tst_PortsModel::testChangedValueIsShown()
+{
+    QModelIndex leftIndex = cellIndex(1, WirePortColumns::LEFT_BOUND);
+    QCOMPARE(model_->data(leftIndex).toString(), QString("leftParameter"));
+
+    QVERIFY(model_->setData(leftIndex, "4"));
+
+    QCOMPARE(model_->data(leftIndex).toString(), QString("4"));
+    QCOMPARE(model_->data(leftIndex, Qt::EditRole).toString(), QString("4"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsModel::testClearedValuesAreFormattedAgain()
+//-----------------------------------------------------------------------------
+void tst_PortsModel::testClearedValuesAreFormattedAgain()
+{
+    QModelIndex leftIndex = cellIndex(1, WirePortColumns::LEFT_BOUND);
+    QCOMPARE(model_->data(leftIndex).toString(), QString("leftParameter"));
+
+    // Renaming the referenced parameter does not change the port, so the editor clears the values.
+    parameter_->setName("renamedParameter");
+    model_->clearCachedValues();
+
+    QCOMPARE(model_->data(leftIndex).toString(), QString("renamedParameter"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsModel::cellIndex()
+//-----------------------------------------------------------------------------
+QModelIndex tst_PortsModel::cellIndex(int row, int column) const
+{
+    // The ports model hides the row and column overload with a name lookup.
+    return static_cast<QAbstractItemModel*>(model_)->index(row, column);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsModel::isEditable()
+//-----------------------------------------------------------------------------
+bool tst_PortsModel::isEditable(int row, int column) const
+{
+    return model_->flags(cellIndex(row, column)).testFlag(Qt::ItemIsEditable);
+}
+
+QTEST_MAIN(tst_PortsModel)
+
+#include "tst_PortsModel.moc"
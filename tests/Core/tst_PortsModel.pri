@@ -0,0 +1,16 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Tools.
+# ------------------------------------------------------
+
+HEADERS += ../../editors/ComponentEditor/common/CellValueCache.h \
+    ../../editors/ComponentEditor/common/ParameterizableTable.h \
+    ../../editors/ComponentEditor/common/ReferencingTableModel.h \
+    ../../editors/ComponentEditor/ports/portsmodel.h \
+    ../../editors/ComponentEditor/ports/WirePortColumns.h \
+    ../../editors/ComponentEditor/ports/WirePortsModel.h
+SOURCES += ../../editors/ComponentEditor/common/CellValueCache.cpp \
+    ../../editors/ComponentEditor/common/ParameterizableTable.cpp \
+    ../../editors/ComponentEditor/common/ReferencingTableModel.cpp \
+    ../../editors/ComponentEditor/ports/portsmodel.cpp \
+    ../../editors/ComponentEditor/ports/WirePortsModel.cpp \
+    ./tst_PortsModel.cpp
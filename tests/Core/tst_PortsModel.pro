@@ -0,0 +1,46 @@
+#-----------------------------------------------------------------------------
+# File: tst_PortsModel.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author: agent
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for PortsModel.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_PortsModel
+
+QT += core gui xml testlib
+
+CONFIG += c++11 testcase console
+DEFINES += IPXACTMODELS_LIB
+
+win32:CONFIG(release, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels -lKactusAPI
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodelsd -lKactusAPId
+    DESTDIR = ./debug
+}
+else:unix {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels -lKactusAPI
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$PWD/../../
+INCLUDEPATH += $$PWD/../../KactusAPI/include
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += $$PWD/../../
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_PortsModel.pri)
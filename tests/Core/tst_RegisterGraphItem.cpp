@@ -10,6 +10,8 @@
 //-----------------------------------------------------------------------------
 
 #include <QtTest>
+#include <QGraphicsPixmapItem>
+#include <QSignalSpy>
 
 #include <editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/addressblockgraphitem.h>
 #include <editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registergraphitem.h>
@@ -67,9 +69,15 @@ private slots:
 
     void testNonPresentField();
 
+    void testPendingFieldsShowExpandIcon();
+
+    void testFieldsAddedOnExpandAreVisible();
+
 private:
     void expandItem(RegisterGraphItem* registerItem);
 
+    bool expandIconIsVisible(RegisterGraphItem* registerItem) const;
+
     RegisterGraphItem* createRegisterItem();
 
     FieldGraphItem* createFieldItem(QString name, unsigned int offset, unsigned int bitWidth, RegisterGraphItem* parentRegister);
@@ -668,6 +676,60 @@ void tst_RegisterGraphItem::testNonPresentField()
     delete registerItem->parentItem();
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterGraphItem::testPendingFieldsShowExpandIcon()
+//-----------------------------------------------------------------------------
+void tst_RegisterGraphItem::testPendingFieldsShowExpandIcon()
+{
+    RegisterGraphItem* registerItem = createRegisterItem();
+    registerItem->redoChildLayout();
+
+    QCOMPARE(expandIconIsVisible(registerItem), false);
+
+    registerItem->setChildrenPending(true);
+    QCOMPARE(expandIconIsVisible(registerItem), true);
+
+    registerItem->redoChildLayout();
+    QCOMPARE(expandIconIsVisible(registerItem), true);
+
+    registerItem->setChildrenPending(false);
+    QCOMPARE(expandIconIsVisible(registerItem), false);
+
+    delete registerItem->parentItem();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterGraphItem::testFieldsAddedOnExpandAreVisible()
+//-----------------------------------------------------------------------------
+void tst_RegisterGraphItem::testFieldsAddedOnExpandAreVisible()
+{
+    RegisterGraphItem* registerItem = createRegisterItem();
+    registerItem->setChildrenPending(true);
+    registerItem->redoChildLayout();
+
+    QSignalSpy expandSpy(registerItem, SIGNAL(expandStateChanged()));
+
+    expandItem(registerItem);
+
+    QCOMPARE(expandSpy.count(), 1);
+    QVERIFY(registerItem->isExpanded());
+
+    // The register tree item creates the deferred fields when the expansion is signaled.
+    FieldGraphItem* fieldItem = createFieldItem("deferredField", 0, 4, registerItem);
+    registerItem->setChildrenPending(false);
+    registerItem->redoChildLayout();
+
+    QVERIFY(fieldItem->isVisible());
+    QCOMPARE(expandIconIsVisible(registerItem), true);
+
+    QList<MemoryGapItem*> reservedSpaces = findMemoryGaps(registerItem);
+    QCOMPARE(reservedSpaces.size(), 1);
+    QCOMPARE(reservedSpaces.first()->getDisplayOffset(), quint64(4));
+    QCOMPARE(reservedSpaces.first()->getDisplayLastAddress(), quint64(7));
+
+    delete registerItem->parentItem();
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_MemoryMapGraphItem::expandItem()
 //-----------------------------------------------------------------------------
@@ -685,6 +747,22 @@ void tst_RegisterGraphItem::expandItem(RegisterGraphItem* registerItem)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterGraphItem::expandIconIsVisible()
+//-----------------------------------------------------------------------------
+bool tst_RegisterGraphItem::expandIconIsVisible(RegisterGraphItem* registerItem) const
+{
+    for (QGraphicsItem* item : registerItem->childItems())
+    {
+        if (dynamic_cast<QGraphicsPixmapItem*>(item) != nullptr)
+        {
+            return item->isVisibleTo(registerItem);
+        }
+    }
+
+    return false;
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_RegisterGraphItem::findMemoryGaps()
 //-----------------------------------------------------------------------------
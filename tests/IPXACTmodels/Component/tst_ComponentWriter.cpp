@@ -21,6 +21,7 @@
 #include <IPXACTmodels/Component/Mode.h>
 #include <IPXACTmodels/Component/AddressSpace.h>
 #include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/AddressBlock.h>
 #include <IPXACTmodels/Component/View.h>
 #include <IPXACTmodels/Component/ComponentInstantiation.h>
 #include <IPXACTmodels/Component/DesignInstantiation.h>
@@ -29,6 +30,7 @@
 #include <IPXACTmodels/Component/PowerDomain.h>
 #include <IPXACTmodels/Component/ComponentGenerator.h>
 #include <IPXACTmodels/Component/FileSet.h>
+#include <IPXACTmodels/Component/File.h>
 #include <IPXACTmodels/Component/Cpu.h>
 #include <IPXACTmodels/Component/OtherClockDriver.h>
 #include <IPXACTmodels/Component/ResetType.h>
@@ -104,8 +106,12 @@ private slots:
     void writeTags();
     void writeErasedTags();
 
+    void writeComponentInParallel();
+
 private:
 
+    QByteArray writeSequentially(QSharedPointer<Component> component) const;
+
     QSharedPointer<Component> testComponent_;
 };
 
@@ -1785,6 +1791,65 @@ void tst_ComponentWriter::writeErasedTags()
     QCOMPARE(output, expectedOutput);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentWriter::writeComponentInParallel()
+//-----------------------------------------------------------------------------
+void tst_ComponentWriter::writeComponentInParallel()
+{
+    VLNV componentVLNV(VLNV::COMPONENT, "tuni.fi", "TestLibrary", "TestComponent", "0.11");
+    testComponent_ = QSharedPointer<Component>(new Component(componentVLNV, Document::Revision::Std14));
+
+    for (int i = 0; i < 50; ++i)
+    {
+        QSharedPointer<MemoryMap> memoryMap(new MemoryMap("memoryMap" + QString::number(i)));
+        memoryMap->getMemoryBlocks()->append(QSharedPointer<AddressBlock>(
+            new AddressBlock("block", "'h" + QString::number(i * 0x100, 16))));
+        testComponent_->getMemoryMaps()->append(memoryMap);
+
+        QSharedPointer<Port> port(new Port("port" + QString::number(i)));
+        QSharedPointer<Wire> wire(new Wire());
+        wire->setDirection(DirectionTypes::IN);
+        port->setWire(wire);
+        testComponent_->getPorts()->append(port);
+
+        QSharedPointer<FileSet> fileSet(new FileSet("fileSet" + QString::number(i)));
+        fileSet->getFiles()->append(QSharedPointer<File>(new File("src/file<" + QString::number(i) + ">.v")));
+        testComponent_->getFileSets()->append(fileSet);
+    }
+
+    testComponent_->getCpus()->append(QSharedPointer<Cpu>(new Cpu("cpu")));
+    testComponent_->setDescription("Component & description");
+
+    ComponentWriter componentWriter;
+
+    // The ports are the only content of the model.
+    QCOMPARE(componentWriter.writeComponent(testComponent_), writeSequentially(testComponent_));
+
+    testComponent_->getViews()->append(QSharedPointer<View>(new View("testView")));
+    QCOMPARE(componentWriter.writeComponent(testComponent_), writeSequentially(testComponent_));
+
+    testComponent_->getMemoryMaps()->clear();
+    testComponent_->getFileSets()->clear();
+    QCOMPARE(componentWriter.writeComponent(testComponent_), writeSequentially(testComponent_));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentWriter::writeSequentially()
+//-----------------------------------------------------------------------------
+QByteArray tst_ComponentWriter::writeSequentially(QSharedPointer<Component> component) const
+{
+    QByteArray output;
+    QXmlStreamWriter xmlStreamWriter(&output);
+
+    xmlStreamWriter.setAutoFormatting(true);
+    xmlStreamWriter.setAutoFormattingIndent(-1);
+
+    ComponentWriter componentWriter;
+    componentWriter.writeComponent(xmlStreamWriter, component);
+
+    return output;
+}
+
 QTEST_APPLESS_MAIN(tst_ComponentWriter)
 
 #include "tst_ComponentWriter.moc"
@@ -11,6 +11,7 @@
 
 #include <IPXACTmodels/common/VendorExtension.h>
 #include <IPXACTmodels/common/Document.h>
+#include <IPXACTmodels/common/StringPool.h>
 
 #include <IPXACTmodels/Component/FieldReader.h>
 #include <IPXACTmodels/Component/Field.h>
@@ -53,6 +54,8 @@ private slots:
     void readParameters();
 
     void readVendorExtensions();
+
+    void readRepeatedValuesAreShared();
 };
 
 //-----------------------------------------------------------------------------
@@ -754,6 +757,49 @@ void tst_FieldReader::readVendorExtensions()
     QCOMPARE(testField->getVendorExtensions()->first()->type(), QString("testExtension"));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_FieldReader::readRepeatedValuesAreShared()
+//-----------------------------------------------------------------------------
+void tst_FieldReader::readRepeatedValuesAreShared()
+{
+    QString documentContent(
+        "<ipxact:register>"
+            "<ipxact:field>"
+                "<ipxact:name>first</ipxact:name>"
+                "<ipxact:typeIdentifier>status</ipxact:typeIdentifier>"
+                "<ipxact:bitOffset>0</ipxact:bitOffset>"
+                "<ipxact:bitWidth>16</ipxact:bitWidth>"
+            "</ipxact:field>"
+            "<ipxact:field>"
+                "<ipxact:name>second</ipxact:name>"
+                "<ipxact:typeIdentifier>status</ipxact:typeIdentifier>"
+                "<ipxact:bitOffset>16</ipxact:bitOffset>"
+                "<ipxact:bitWidth>16</ipxact:bitWidth>"
+            "</ipxact:field>"
+        "</ipxact:register>"
+        );
+
+    QDomDocument document;
+    document.setContent(documentContent);
+
+    QDomNodeList fieldNodes = document.elementsByTagName("ipxact:field");
+
+    QSharedPointer<Field> firstField = FieldReader::createFieldFrom(fieldNodes.at(0), Document::Revision::Std14);
+    QSharedPointer<Field> secondField = FieldReader::createFieldFrom(fieldNodes.at(1), Document::Revision::Std14);
+
+    QCOMPARE(firstField->getTypeIdentifier(), QString("status"));
+    QCOMPARE(secondField->getBitOffset(), QString("16"));
+
+    // The value may have been pooled by the previous tests, so the fields are compared to the pooled copy.
+    QString const pooled = StringPool::intern(QStringLiteral("status"));
+
+    QCOMPARE(firstField->getTypeIdentifier().constData(), pooled.constData());
+    QCOMPARE(secondField->getTypeIdentifier().constData(), pooled.constData());
+
+    // Expressions have too many distinct values to be pooled.
+    QVERIFY(firstField->getBitWidth().constData() != secondField->getBitWidth().constData());
+}
+
 QTEST_APPLESS_MAIN(tst_FieldReader)
 
 #include "tst_FieldReader.moc"
@@ -17,6 +17,7 @@
 #include <IPXACTmodels/Component/Register.h>
 #include <IPXACTmodels/Component/RegisterFile.h>
 #include <IPXACTmodels/Component/Field.h>
+#include <IPXACTmodels/Component/SubSpaceMap.h>
 
 #include <IPXACTmodels/common/VendorExtension.h>
 
@@ -34,6 +35,7 @@ private slots:
     void readSimpleMemoryMapBase();
     void readIsPresent();
     void readAddressBlocks();
+    void readManyBlocksInDocumentOrder();
 };
 
 //-----------------------------------------------------------------------------
@@ -171,6 +173,68 @@ void tst_MemoryMapBaseReader::readAddressBlocks()
     QCOMPARE(containedFile->getRange(), QString("containedRange"));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapBaseReader::readManyBlocksInDocumentOrder()
+//-----------------------------------------------------------------------------
+void tst_MemoryMapBaseReader::readManyBlocksInDocumentOrder()
+{
+    QString documentContent(QStringLiteral("<ipxact:MemoryMapBase><ipxact:name>testMemoryMapBase</ipxact:name>"));
+
+    const int blockCount = 64;
+    for (int i = 0; i < blockCount; ++i)
+    {
+        if (i == blockCount / 2)
+        {
+            documentContent.append(QStringLiteral(
+                "<ipxact:subspaceMap initiatorRef=\"initiator\">"
+                    "<ipxact:name>subspace</ipxact:name>"
+                    "<ipxact:baseAddress>0</ipxact:baseAddress>"
+                "</ipxact:subspaceMap>"));
+        }
+
+        documentContent.append(QStringLiteral(
+            "<ipxact:addressBlock>"
+                "<ipxact:name>block%1</ipxact:name>"
+                "<ipxact:baseAddress>%1</ipxact:baseAddress>"
+                "<ipxact:register>"
+                    "<ipxact:name>register%1</ipxact:name>"
+                    "<ipxact:addressOffset>0</ipxact:addressOffset>"
+                    "<ipxact:size>32</ipxact:size>"
+                "</ipxact:register>"
+            "</ipxact:addressBlock>").arg(i));
+    }
+
+    documentContent.append(QStringLiteral("</ipxact:MemoryMapBase>"));
+
+    QDomDocument document;
+    document.setContent(documentContent);
+
+    QDomNode MemoryMapBaseNode = document.firstChildElement("ipxact:MemoryMapBase");
+
+    QSharedPointer<MemoryMapBase> testMemoryMapBase(new MemoryMapBase);
+    MemoryMapBaseReader::readMemoryMapBase(MemoryMapBaseNode, testMemoryMapBase, Document::Revision::Std14);
+
+    QCOMPARE(testMemoryMapBase->getMemoryBlocks()->size(), blockCount + 1);
+
+    int blockIndex = 0;
+    for (int i = 0; i < testMemoryMapBase->getMemoryBlocks()->size(); ++i)
+    {
+        QSharedPointer<MemoryBlockBase> block = testMemoryMapBase->getMemoryBlocks()->at(i);
+        if (i == blockCount / 2)
+        {
+            QCOMPARE(block.dynamicCast<SubSpaceMap>().isNull(), false);
+            QCOMPARE(block->name(), QString("subspace"));
+            continue;
+        }
+
+        QSharedPointer<AddressBlock> addressBlock = block.dynamicCast<AddressBlock>();
+        QCOMPARE(addressBlock.isNull(), false);
+        QCOMPARE(addressBlock->name(), QString("block%1").arg(blockIndex));
+        QCOMPARE(addressBlock->getRegisterData()->first()->name(), QString("register%1").arg(blockIndex));
+        ++blockIndex;
+    }
+}
+
 QTEST_APPLESS_MAIN(tst_MemoryMapBaseReader)
 
 #include "tst_MemoryMapBaseReader.moc"
@@ -13,4 +13,11 @@ TEMPLATE = subdirs
 
 CONFIG += testcase
 SUBDIRS += \
-            tst_ModeConditionParser.pro 
+            tst_ComponentParameterFinder.pro \
+            tst_DocumentCache.pro \
+            tst_LibraryHandler.pro \
+            tst_LibraryWatcher.pro \
+            tst_ModeConditionParser.pro \
+            tst_MultipleParameterFinder.pro \
+            tst_NameIndex.pro \
+            tst_RegisterMapImporter.pro
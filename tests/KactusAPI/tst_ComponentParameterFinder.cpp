@@ -0,0 +1,219 @@
+//-----------------------------------------------------------------------------
+// File: tst_ComponentParameterFinder.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class ComponentParameterFinder.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QSharedPointer>
+
+#include <KactusAPI/include/ComponentParameterFinder.h>
+
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/BusInterface.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/Register.h>
+
+#include <IPXACTmodels/common/Parameter.h>
+
+class tst_ComponentParameterFinder : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ComponentParameterFinder();
+
+private slots:
+
+    void init();
+
+    void testParameterIsFound();
+    void testRemovedParameterIsNotFound();
+    void testRemovedBusInterfaceParameterIsNotFound();
+    void testRemovedRegisterParameterIsNotFound();
+    void testReplacedParameterIsFound();
+    void testChangedIdIsFound();
+    void testAddedParameterIsFound();
+    void testFirstParameterWithIdIsFound();
+
+private:
+
+    QSharedPointer<Parameter> createParameter(QString const& name, QString const& id, QString const& value) const;
+
+    //! The component to search the parameters from.
+    QSharedPointer<Component> component_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterFinder::tst_ComponentParameterFinder()
+//-----------------------------------------------------------------------------
+tst_ComponentParameterFinder::tst_ComponentParameterFinder():
+component_()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterFinder::init()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterFinder::init()
+{
+    component_ = QSharedPointer<Component>(new Component(VLNV(VLNV::COMPONENT, "TUT", "TestLibrary",
+        "TestComponent", "1.0"), Document::Revision::Std22));
+
+    component_->getParameters()->append(createParameter("first", "firstId", "1"));
+    component_->getParameters()->append(createParameter("second", "secondId", "2"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterFinder::testParameterIsFound()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterFinder::testParameterIsFound()
+{
+    ComponentParameterFinder finder(component_);
+
+    QCOMPARE(finder.getParameterWithID(u"firstId"), component_->getParameters()->first());
+    QCOMPARE(finder.valueForId(u"secondId"), QString("2"));
+    QVERIFY(finder.hasId(u"missingId") == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterFinder::testRemovedParameterIsNotFound()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterFinder::testRemovedParameterIsNotFound()
+{
+    ComponentParameterFinder finder(component_);
+    QVERIFY(finder.hasId(u"firstId"));
+
+    component_->getParameters()->removeFirst();
+
+    QVERIFY(finder.hasId(u"firstId") == false);
+    QVERIFY(finder.getParameterWithID(u"firstId").isNull());
+    QVERIFY(finder.hasId(u"secondId"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterFinder::testRemovedBusInterfaceParameterIsNotFound()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterFinder::testRemovedBusInterfaceParameterIsNotFound()
+{
+    QSharedPointer<BusInterface> busInterface(new BusInterface());
+    busInterface->setName("testBus");
+    busInterface->getParameters()->append(createParameter("busParameter", "busId", "8"));
+    component_->getBusInterfaces()->append(busInterface);
+
+    ComponentParameterFinder finder(component_);
+    QCOMPARE(finder.valueForId(u"busId"), QString("8"));
+
+    component_->getBusInterfaces()->clear();
+
+    QVERIFY(finder.hasId(u"busId") == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterFinder::testRemovedRegisterParameterIsNotFound()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterFinder::testRemovedRegisterParameterIsNotFound()
+{
+    QSharedPointer<Register> testRegister(new Register("testRegister", "0", "32"));
+    testRegister->getParameters()->append(createParameter("registerParameter", "registerId", "4"));
+
+    QSharedPointer<AddressBlock> addressBlock(new AddressBlock("testBlock", "0"));
+    addressBlock->getRegisterData()->append(testRegister);
+
+    QSharedPointer<MemoryMap> memoryMap(new MemoryMap("testMap"));
+    memoryMap->getMemoryBlocks()->append(addressBlock);
+    component_->getMemoryMaps()->append(memoryMap);
+
+    ComponentParameterFinder finder(component_);
+    QCOMPARE(finder.valueForId(u"registerId"), QString("4"));
+
+    // The register is removed without changing the parameter or the register.
+    addressBlock->getRegisterData()->clear();
+
+    QVERIFY(finder.hasId(u"registerId") == false);
+    QVERIFY(finder.hasId(u"firstId"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterFinder::testReplacedParameterIsFound()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterFinder::testReplacedParameterIsFound()
+{
+    ComponentParameterFinder finder(component_);
+    QCOMPARE(finder.valueForId(u"firstId"), QString("1"));
+
+    QSharedPointer<Parameter> replacement = createParameter("first", "firstId", "10");
+    component_->getParameters()->replace(0, replacement);
+
+    QCOMPARE(finder.getParameterWithID(u"firstId"), replacement);
+    QCOMPARE(finder.valueForId(u"firstId"), QString("10"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterFinder::testChangedIdIsFound()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterFinder::testChangedIdIsFound()
+{
+    ComponentParameterFinder finder(component_);
+    QVERIFY(finder.hasId(u"firstId"));
+
+    component_->getParameters()->first()->setValueId("renamedId");
+
+    QVERIFY(finder.hasId(u"firstId") == false);
+    QCOMPARE(finder.nameForId(u"renamedId"), QString("first"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterFinder::testAddedParameterIsFound()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterFinder::testAddedParameterIsFound()
+{
+    ComponentParameterFinder finder(component_);
+    QVERIFY(finder.hasId(u"thirdId") == false);
+
+    component_->getParameters()->append(createParameter("third", "thirdId", "3"));
+
+    QCOMPARE(finder.valueForId(u"thirdId"), QString("3"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterFinder::testFirstParameterWithIdIsFound()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterFinder::testFirstParameterWithIdIsFound()
+{
+    QSharedPointer<BusInterface> busInterface(new BusInterface());
+    busInterface->setName("testBus");
+    busInterface->getParameters()->append(createParameter("duplicate", "firstId", "8"));
+    component_->getBusInterfaces()->append(busInterface);
+
+    ComponentParameterFinder finder(component_);
+    QCOMPARE(finder.nameForId(u"firstId"), QString("first"));
+
+    component_->getParameters()->removeFirst();
+
+    QCOMPARE(finder.nameForId(u"firstId"), QString("duplicate"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterFinder::createParameter()
+//-----------------------------------------------------------------------------
+QSharedPointer<Parameter> tst_ComponentParameterFinder::createParameter(QString const& name, QString const& id,
+    QString const& value) const
+{
+    QSharedPointer<Parameter> parameter(new Parameter());
+    parameter->setName(name);
+    parameter->setValueId(id);
+    parameter->setValue(value);
+
+    return parameter;
+}
+
+QTEST_APPLESS_MAIN(tst_ComponentParameterFinder)
+
+#include "tst_ComponentParameterFinder.moc"
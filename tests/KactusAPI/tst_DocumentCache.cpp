@@ -0,0 +1,320 @@
+//-----------------------------------------------------------------------------
+// File: tst_DocumentCache.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for the binary document cache.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QDomDocument>
+#include <QStandardPaths>
+#include <QTemporaryDir>
+
+#include <KactusAPI/include/DocumentCache.h>
+
+class tst_DocumentCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_DocumentCache();
+
+private slots:
+
+    void initTestCase();
+    void init();
+
+    void testContentIsRestored();
+    void testChangedSourceIsNotRestored();
+    void testSmallSourceIsNotCached();
+    void testDisabledCacheIsNotUsed();
+    void testCorruptCacheIsNotRestored();
+    void testStaleFilesArePruned();
+    void testCacheSizeIsLimited();
+    void testSourceIsCachedWhenParsedAgain();
+
+    void benchmarkRead();
+    void benchmarkRead_data();
+
+private:
+
+    QString writeSource(QString const& fileName, int registerCount) const;
+
+    QDomDocument parseSource(QString const& path) const;
+
+    QTemporaryDir sourceDirectory_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::tst_DocumentCache()
+//-----------------------------------------------------------------------------
+tst_DocumentCache::tst_DocumentCache()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::initTestCase()
+//-----------------------------------------------------------------------------
+void tst_DocumentCache::initTestCase()
+{
+    QStandardPaths::setTestModeEnabled(true);
+    QVERIFY(sourceDirectory_.isValid());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::init()
+//-----------------------------------------------------------------------------
+void tst_DocumentCache::init()
+{
+    DocumentCache::setEnabled(true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::testContentIsRestored()
+//-----------------------------------------------------------------------------
+void tst_DocumentCache::testContentIsRestored()
+{
+    QString sourcePath = writeSource("restored.xml", 2000);
+    QDomDocument parsed = parseSource(sourcePath);
+
+    QVERIFY(DocumentCache::write(sourcePath, parsed));
+    QVERIFY(QFile::exists(DocumentCache::cachePath(sourcePath)));
+
+    QDomDocument restored;
+    QVERIFY(DocumentCache::read(sourcePath, restored));
+    QCOMPARE(restored.toString(), parsed.toString());
+
+    QDomElement root = restored.documentElement();
+    QCOMPARE(root.nodeName(), QString("ipxact:component"));
+    QCOMPARE(root.attribute("xmlns:ipxact"), QString("http://www.accellera.org/XMLSchema/IPXACT/1685-2014"));
+    QCOMPARE(root.firstChildElement("ipxact:name").text(), QString("cached"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::testChangedSourceIsNotRestored()
+//-----------------------------------------------------------------------------
+void tst_DocumentCache::testChangedSourceIsNotRestored()
+{
+    QString sourcePath = writeSource("changed.xml", 2000);
+    QVERIFY(DocumentCache::write(sourcePath, parseSource(sourcePath)));
+
+    writeSource("changed.xml", 2001);
+
+    QDomDocument restored;
+    QVERIFY(DocumentCache::read(sourcePath, restored) == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::testSmallSourceIsNotCached()
+//-----------------------------------------------------------------------------
+void tst_DocumentCache::testSmallSourceIsNotCached()
+{
+    QString sourcePath = writeSource("small.xml", 1);
+
+    QVERIFY(DocumentCache::write(sourcePath, parseSource(sourcePath)) == false);
+    QVERIFY(QFile::exists(DocumentCache::cachePath(sourcePath)) == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::testDisabledCacheIsNotUsed()
+//-----------------------------------------------------------------------------
+void tst_DocumentCache::testDisabledCacheIsNotUsed()
+{
+    QString sourcePath = writeSource("disabled.xml", 2000);
+    QVERIFY(DocumentCache::write(sourcePath, parseSource(sourcePath)));
+
+    DocumentCache::setEnabled(false);
+
+    QDomDocument restored;
+    QVERIFY(DocumentCache::read(sourcePath, restored) == false);
+    QVERIFY(DocumentCache::write(sourcePath, parseSource(sourcePath)) == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::testCorruptCacheIsNotRestored()
+//-----------------------------------------------------------------------------
+void tst_DocumentCache::testCorruptCacheIsNotRestored()
+{
+    QString sourcePath = writeSource("corrupt.xml", 2000);
+    QVERIFY(DocumentCache::write(sourcePath, parseSource(sourcePath)));
+
+    QFile cacheFile(DocumentCache::cachePath(sourcePath));
+    QVERIFY(cacheFile.open(QIODevice::ReadWrite));
+    QByteArray content = cacheFile.readAll();
+    cacheFile.resize(content.size() / 2);
+    cacheFile.close();
+
+    QDomDocument restored;
+    QVERIFY(DocumentCache::read(sourcePath, restored) == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::testStaleFilesArePruned()
+//-----------------------------------------------------------------------------
+void tst_DocumentCache::testStaleFilesArePruned()
+{
+    QString removedPath = writeSource("removed.xml", 2000);
+    QVERIFY(DocumentCache::write(removedPath, parseSource(removedPath)));
+
+    QString outdatedPath = writeSource("outdated.xml", 2000);
+    QVERIFY(DocumentCache::write(outdatedPath, parseSource(outdatedPath)));
+
+    QString keptPath = writeSource("kept.xml", 2000);
+    QVERIFY(DocumentCache::write(keptPath, parseSource(keptPath)));
+
+    QVERIFY(QFile::remove(removedPath));
+    writeSource("outdated.xml", 2001);
+
+    QVERIFY(DocumentCache::prune() >= 2);
+
+    QVERIFY(QFile::exists(DocumentCache::cachePath(removedPath)) == false);
+    QVERIFY(QFile::exists(DocumentCache::cachePath(outdatedPath)) == false);
+    QVERIFY(QFile::exists(DocumentCache::cachePath(keptPath)));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::testCacheSizeIsLimited()
+//-----------------------------------------------------------------------------
+void tst_DocumentCache::testCacheSizeIsLimited()
+{
+    QString olderPath = writeSource("older.xml", 2000);
+    QVERIFY(DocumentCache::write(olderPath, parseSource(olderPath)));
+
+    QString newerPath = writeSource("newer.xml", 2000);
+    QVERIFY(DocumentCache::write(newerPath, parseSource(newerPath)));
+
+    // Order the cache files explicitly, since they may have been written within the timestamp resolution.
+    QFile newerCache(DocumentCache::cachePath(newerPath));
+    QVERIFY(newerCache.open(QIODevice::ReadWrite));
+    QVERIFY(newerCache.setFileTime(QDateTime::currentDateTime().addSecs(60), QFileDevice::FileModificationTime));
+    newerCache.close();
+
+    QVERIFY(DocumentCache::prune(newerCache.size()) >= 1);
+
+    QVERIFY(QFile::exists(DocumentCache::cachePath(olderPath)) == false);
+    QVERIFY(QFile::exists(DocumentCache::cachePath(newerPath)));
+
+    QDomDocument restored;
+    QVERIFY(DocumentCache::read(newerPath, restored));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::testSourceIsCachedWhenParsedAgain()
+//-----------------------------------------------------------------------------
+void tst_DocumentCache::testSourceIsCachedWhenParsedAgain()
+{
+    QString sourcePath = writeSource("reparsed.xml", 2000);
+
+    QVERIFY(DocumentCache::writeIfParsedBefore(sourcePath, parseSource(sourcePath)) == false);
+    QVERIFY(QFile::exists(DocumentCache::cachePath(sourcePath)) == false);
+
+    // A changed source counts as parsed for the first time.
+    writeSource("reparsed.xml", 2001);
+    QVERIFY(DocumentCache::writeIfParsedBefore(sourcePath, parseSource(sourcePath)) == false);
+    QVERIFY(QFile::exists(DocumentCache::cachePath(sourcePath)) == false);
+
+    QVERIFY(DocumentCache::writeIfParsedBefore(sourcePath, parseSource(sourcePath)));
+
+    QDomDocument restored;
+    QVERIFY(DocumentCache::read(sourcePath, restored));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::benchmarkRead()
+//-----------------------------------------------------------------------------
+void tst_DocumentCache::benchmarkRead()
+{
+    QFETCH(int, registerCount);
+    QFETCH(bool, fromCache);
+
+    QString sourcePath = writeSource(QString("benchmark_%1.xml").arg(registerCount), registerCount);
+    QDomDocument parsed = parseSource(sourcePath);
+    QVERIFY(DocumentCache::write(sourcePath, parsed));
+
+    QDomDocument document;
+    if (fromCache)
+    {
+        QBENCHMARK
+        {
+            DocumentCache::read(sourcePath, document);
+        }
+    }
+    else
+    {
+        QBENCHMARK
+        {
+            document = parseSource(sourcePath);
+        }
+    }
+
+    QCOMPARE(document.documentElement().childNodes().size(), parsed.documentElement().childNodes().size());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::benchmarkRead_data()
+//-----------------------------------------------------------------------------
+void tst_DocumentCache::benchmarkRead_data()
+{
+    QTest::addColumn<int>("registerCount");
+    QTest::addColumn<bool>("fromCache");
+
+    QTest::newRow("2000 registers parsed with setContent") << 2000 << false;
+    QTest::newRow("2000 registers restored from cache") << 2000 << true;
+    QTest::newRow("20000 registers parsed with setContent") << 20000 << false;
+    QTest::newRow("20000 registers restored from cache") << 20000 << true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::writeSource()
+//-----------------------------------------------------------------------------
+QString tst_DocumentCache::writeSource(QString const& fileName, int registerCount) const
+{
+    QString path = sourceDirectory_.filePath(fileName);
+
+    QFile sourceFile(path);
+    sourceFile.open(QIODevice::WriteOnly | QIODevice::Truncate);
+
+    QTextStream output(&sourceFile);
+    output << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<!-- Generated for testing -->\n"
+        "<ipxact:component xmlns:ipxact=\"http://www.accellera.org/XMLSchema/IPXACT/1685-2014\">\n"
+        "  <ipxact:vendor>tut.fi</ipxact:vendor>\n"
+        "  <ipxact:name>cached</ipxact:name>\n"
+        "  <ipxact:description><![CDATA[Text & <markup>]]></ipxact:description>\n";
+
+    for (int i = 0; i < registerCount; ++i)
+    {
+        output << "  <ipxact:register ipxact:id=\"reg" << i << "\">\n"
+            "    <ipxact:name>register_" << i << "</ipxact:name>\n"
+            "    <ipxact:addressOffset>'h" << QString::number(i * 4, 16) << "</ipxact:addressOffset>\n"
+            "  </ipxact:register>\n";
+    }
+
+    output << "</ipxact:component>\n";
+    output.flush();
+    sourceFile.close();
+
+    return path;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentCache::parseSource()
+//-----------------------------------------------------------------------------
+QDomDocument tst_DocumentCache::parseSource(QString const& path) const
+{
+    QFile sourceFile(path);
+    sourceFile.open(QIODevice::ReadOnly);
+
+    QDomDocument document;
+    document.setContent(&sourceFile);
+
+    return document;
+}
+
+QTEST_MAIN(tst_DocumentCache)
+
+#include "tst_DocumentCache.moc"
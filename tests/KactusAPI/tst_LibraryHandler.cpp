@@ -0,0 +1,899 @@
+//-----------------------------------------------------------------------------
+// File: tst_LibraryHandler.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for the document cache, the background saves and the file change updates of class LibraryHandler.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QDir>
+#include <QFileInfo>
+#include <QSettings>
+#include <QSignalSpy>
+#include <QStandardPaths>
+#include <QTemporaryDir>
+
+#include <KactusAPI/include/DocumentFileAccess.h>
+#include <KactusAPI/include/LibraryHandler.h>
+
+#include <IPXACTmodels/common/Parameter.h>
+
+#include <IPXACTmodels/Component/Component.h>
+
+class tst_LibraryHandler : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_LibraryHandler();
+
+private slots:
+
+    void initTestCase();
+    void init();
+
+    void testLeastRecentlyUsedIsReleased();
+    void testPinnedDocumentIsKept();
+    void testReleasedDocumentInUseIsReused();
+    void testStatisticsAreUpdated();
+
+    void testSavedFileIsReplaced();
+    void testConsecutiveSavesAreWrittenInOrder();
+    void testFailedSaveRestoresWrittenDocument();
+    void testFailedNewDocumentIsRemoved();
+    void testUnwritableFileIsRejected();
+    void testNewDocumentIsRevalidatedAfterWrite();
+    void testWaitForSavesCompletesFailedSave();
+
+    void testRemovedFileIsForgotten();
+    void testAddedFileIsFound();
+    void testModifiedFileIsReadAgain();
+    void testPendingSaveIsNotReadAgain();
+    void testChangedVLNVReplacesDocument();
+
+    void testRescanAddsFoundFile();
+    void testRescanRemovesMissingFile();
+    void testRescanUpdatesModifiedFile();
+    void testRescanUpdatesInvalidatedFile();
+    void testRescanResetsModelsAfterLargeChange();
+
+private:
+
+    VLNV writeComponent(QString const& name) const;
+
+    VLNV writeComponentFile(QString const& name, bool valid) const;
+
+    QModelIndex treeIndex(VLNV const& vlnv) const;
+
+    QModelIndex hierarchyIndex(VLNV const& vlnv) const;
+
+    void finishSaves() const;
+
+    QString fileContent(QString const& path) const;
+
+    void replaceInFile(QString const& path, QString const& before, QString const& after) const;
+
+    void changeFiles(QStringList const& added, QStringList const& removed, QStringList const& modified) const;
+
+    //! The directory containing the test library.
+    QTemporaryDir libraryDirectory_;
+
+    //! The components in the test library.
+    VLNV first_;
+    VLNV second_;
+    VLNV third_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::tst_LibraryHandler()
+//-----------------------------------------------------------------------------
+tst_LibraryHandler::tst_LibraryHandler():
+libraryDirectory_(),
+first_(),
+second_(),
+third_()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::initTestCase()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::initTestCase()
+{
+    QStandardPaths::setTestModeEnabled(true);
+    QVERIFY(libraryDirectory_.isValid());
+
+    QSettings settings;
+    settings.setValue(QStringLiteral("Library/Locations"), QStringList(libraryDirectory_.path()));
+    settings.setValue(QStringLiteral("Library/ActiveLocations"), QStringList(libraryDirectory_.path()));
+    settings.setValue(QStringLiteral("Library/WatchLocations"), false);
+    settings.setValue(QStringLiteral("Library/BinaryDocumentCache"), false);
+    settings.remove(QStringLiteral("Library/DocumentCacheBudget"));
+
+    // The names have the same length, so the files and their estimated sizes are equal.
+    first_ = writeComponent("first");
+    second_ = writeComponent("secnd");
+    third_ = writeComponent("third");
+
+    // Read the library from the written files.
+    LibraryHandler::getInstance().searchForIPXactFiles();
+
+    QVERIFY(LibraryHandler::getInstance().contains(first_));
+    QVERIFY(LibraryHandler::getInstance().contains(second_));
+    QVERIFY(LibraryHandler::getInstance().contains(third_));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::init()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::init()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    // Release all the documents and remove the budget.
+    library.setCacheBudget(1);
+    library.setCacheBudget(0);
+
+    QCOMPARE(library.getCacheStatistics().residentDocuments, 0);
+    QCOMPARE(library.getCacheStatistics().residentSize, qint64(0));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testLeastRecentlyUsedIsReleased()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testLeastRecentlyUsedIsReleased()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    library.getModel(first_);
+    library.getModel(second_);
+    library.getModel(third_);
+
+    QCOMPARE(library.getCacheStatistics().residentDocuments, 3);
+    qint64 documentSize = library.getCacheStatistics().residentSize / 3;
+
+    // Using the first document again leaves the second one as the least recently used.
+    library.getModel(first_);
+
+    library.setCacheBudget(documentSize * 5 / 2);
+
+    LibraryHandler::CacheStatistics statistics = library.getCacheStatistics();
+    QCOMPARE(statistics.residentDocuments, 2);
+    QCOMPARE(statistics.residentSize, documentSize * 2);
+
+    library.getModel(third_);
+    library.getModel(first_);
+    QCOMPARE(library.getCacheStatistics().misses, statistics.misses);
+    QCOMPARE(library.getCacheStatistics().hits, statistics.hits + 2);
+
+    library.getModel(second_);
+    QCOMPARE(library.getCacheStatistics().misses, statistics.misses + 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testPinnedDocumentIsKept()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testPinnedDocumentIsKept()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    library.pinDocument(first_);
+    library.getModel(first_);
+    library.getModel(second_);
+
+    library.setCacheBudget(1);
+    QCOMPARE(library.getCacheStatistics().residentDocuments, 1);
+
+    quint64 misses = library.getCacheStatistics().misses;
+    library.getModel(first_);
+    QCOMPARE(library.getCacheStatistics().misses, misses);
+
+    // The pin is counted, so the document stays until every pin is released.
+    library.pinDocument(first_);
+    library.unpinDocument(first_);
+    QCOMPARE(library.getCacheStatistics().residentDocuments, 1);
+
+    library.unpinDocument(first_);
+    QCOMPARE(library.getCacheStatistics().residentDocuments, 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testReleasedDocumentInUseIsReused()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testReleasedDocumentInUseIsReused()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    QSharedPointer<Document const> held = library.getModelReadOnly(first_);
+    QVERIFY(held);
+
+    library.setCacheBudget(1);
+    QCOMPARE(library.getCacheStatistics().residentDocuments, 0);
+    library.setCacheBudget(0);
+
+    LibraryHandler::CacheStatistics statistics = library.getCacheStatistics();
+
+    QSharedPointer<Document const> reused = library.getModelReadOnly(first_);
+    QCOMPARE(reused.data(), held.data());
+    QCOMPARE(library.getCacheStatistics().hits, statistics.hits + 1);
+    QCOMPARE(library.getCacheStatistics().misses, statistics.misses);
+    QCOMPARE(library.getCacheStatistics().residentDocuments, 1);
+
+    // A released document without other users is read again.
+    held.clear();
+    reused.clear();
+    library.setCacheBudget(1);
+    library.setCacheBudget(0);
+
+    QVERIFY(library.getModelReadOnly(first_));
+    QCOMPARE(library.getCacheStatistics().misses, statistics.misses + 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testStatisticsAreUpdated()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testStatisticsAreUpdated()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+    LibraryHandler::CacheStatistics statistics = library.getCacheStatistics();
+
+    library.getModel(first_);
+    library.getModel(first_);
+    library.getModelReadOnly(second_);
+
+    LibraryHandler::CacheStatistics loaded = library.getCacheStatistics();
+    QCOMPARE(loaded.misses, statistics.misses + 2);
+    QCOMPARE(loaded.hits, statistics.hits + 1);
+    QCOMPARE(loaded.residentDocuments, 2);
+    QVERIFY(loaded.residentSize >= QFileInfo(library.getPath(first_)).size() * 2);
+
+    library.setCacheBudget(1);
+
+    LibraryHandler::CacheStatistics released = library.getCacheStatistics();
+    QCOMPARE(released.evictions, loaded.evictions + 2);
+    QCOMPARE(released.residentDocuments, 0);
+    QCOMPARE(released.residentSize, qint64(0));
+    QCOMPARE(released.budget, qint64(1));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testSavedFileIsReplaced()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testSavedFileIsReplaced()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV componentVLNV = writeComponent("replaced");
+    finishSaves();
+
+    QSharedPointer<Document> model = library.getModel(componentVLNV);
+    model->setDescription("Replaced content");
+    QVERIFY(library.writeModelToFile(model));
+    finishSaves();
+
+    QString path = library.getPath(componentVLNV);
+    QVERIFY(fileContent(path).contains("Replaced content"));
+
+    // The temporary file has replaced the target.
+    QCOMPARE(QDir(QFileInfo(path).absolutePath()).entryList(QDir::Files), QStringList("replaced.1.0.xml"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testConsecutiveSavesAreWrittenInOrder()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testConsecutiveSavesAreWrittenInOrder()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV componentVLNV = writeComponent("consecutive");
+
+    QSharedPointer<Document> model = library.getModel(componentVLNV);
+    for (int i = 1; i <= 5; ++i)
+    {
+        model->setDescription(QString("Revision %1").arg(i));
+        QVERIFY(library.writeModelToFile(model));
+    }
+
+    // The cache holds the latest save before the files are written.
+    QCOMPARE(library.getModelReadOnly(componentVLNV)->getDescription(), QString("Revision 5"));
+
+    finishSaves();
+
+    QString content = fileContent(library.getPath(componentVLNV));
+    QVERIFY(content.contains("Revision 5"));
+    QVERIFY(content.contains("Revision 4") == false);
+    QCOMPARE(library.getModelReadOnly(componentVLNV)->getDescription(), QString("Revision 5"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testFailedSaveRestoresWrittenDocument()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testFailedSaveRestoresWrittenDocument()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV componentVLNV = writeComponent("failed");
+
+    QSharedPointer<Document> model = library.getModel(componentVLNV);
+    model->setDescription("Written");
+    QVERIFY(library.writeModelToFile(model));
+    finishSaves();
+
+    // A directory in place of the file lets the save start, but makes the write fail.
+    QString path = library.getPath(componentVLNV);
+    QVERIFY(QFile::remove(path));
+    QVERIFY(QDir().mkdir(path));
+
+    QSignalSpy failedSpy(&library, &LibraryHandler::saveFailed);
+
+    model->setDescription("First unwritten");
+    QVERIFY(library.writeModelToFile(model));
+    model->setDescription("Second unwritten");
+    QVERIFY(library.writeModelToFile(model));
+
+    QCOMPARE(library.getModelReadOnly(componentVLNV)->getDescription(), QString("Second unwritten"));
+
+    finishSaves();
+
+    QCOMPARE(failedSpy.count(), 2);
+    QCOMPARE(failedSpy.first().first().value<VLNV>(), componentVLNV);
+
+    QVERIFY(library.contains(componentVLNV));
+    QCOMPARE(library.getModelReadOnly(componentVLNV)->getDescription(), QString("Written"));
+    QVERIFY(QFileInfo(path).isDir());
+
+    QVERIFY(QDir().rmdir(path));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testFailedNewDocumentIsRemoved()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testFailedNewDocumentIsRemoved()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    QString directory = libraryDirectory_.filePath("blocked");
+    QVERIFY(QDir().mkpath(directory + "/blocked.1.0.xml"));
+
+    QSignalSpy failedSpy(&library, &LibraryHandler::saveFailed);
+
+    VLNV componentVLNV(VLNV::COMPONENT, "TUT", "cache", "blocked", "1.0");
+    QSharedPointer<Component> component(new Component(componentVLNV, Document::Revision::Std22));
+    QVERIFY(library.writeModelToFile(directory, component));
+    QVERIFY(library.contains(componentVLNV));
+
+    finishSaves();
+
+    QCOMPARE(failedSpy.count(), 1);
+    QVERIFY(library.contains(componentVLNV) == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testUnwritableFileIsRejected()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testUnwritableFileIsRejected()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV componentVLNV = writeComponent("readOnly");
+    finishSaves();
+
+    QString path = library.getPath(componentVLNV);
+    QFile::Permissions permissions = QFile::permissions(path);
+    QVERIFY(QFile::setPermissions(path, QFileDevice::ReadOwner));
+
+    if (QFileInfo(path).isWritable())
+    {
+        QFile::setPermissions(path, permissions);
+        QSKIP("File permissions are not enforced for the current user.");
+    }
+
+    QSharedPointer<Document> model = library.getModel(componentVLNV);
+    model->setDescription("Rejected");
+
+    QVERIFY(library.writeModelToFile(model) == false);
+    QVERIFY(library.getModelReadOnly(componentVLNV)->getDescription() != QString("Rejected"));
+
+    QFile::setPermissions(path, permissions);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testNewDocumentIsRevalidatedAfterWrite()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testNewDocumentIsRevalidatedAfterWrite()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV componentVLNV = writeComponent("revalidated");
+
+    // The file did not exist yet, when the document was validated.
+    QVERIFY(library.isValid(componentVLNV) == false);
+
+    finishSaves();
+
+    QVERIFY(library.isValid(componentVLNV));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testWaitForSavesCompletesFailedSave()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testWaitForSavesCompletesFailedSave()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV componentVLNV = writeComponent("waited");
+
+    QSharedPointer<Document> model = library.getModel(componentVLNV);
+    model->setDescription("Written");
+    QVERIFY(library.writeModelToFile(model));
+    finishSaves();
+
+    QString path = library.getPath(componentVLNV);
+    QVERIFY(QFile::remove(path));
+    QVERIFY(QDir().mkdir(path));
+
+    QSignalSpy failedSpy(&library, &LibraryHandler::saveFailed);
+
+    model->setDescription("Unwritten");
+    QVERIFY(library.writeModelToFile(model));
+
+    library.waitForSaves();
+
+    QCOMPARE(failedSpy.count(), 1);
+    QCOMPARE(library.getModelReadOnly(componentVLNV)->getDescription(), QString("Written"));
+
+    // The finished signal delivered afterwards does not complete the save again.
+    QCoreApplication::processEvents();
+
+    QCOMPARE(failedSpy.count(), 1);
+    QCOMPARE(library.getModelReadOnly(componentVLNV)->getDescription(), QString("Written"));
+
+    QVERIFY(QDir().rmdir(path));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testRemovedFileIsForgotten()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testRemovedFileIsForgotten()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV componentVLNV = writeComponent("removed");
+    finishSaves();
+
+    QString path = library.getPath(componentVLNV);
+    QVERIFY(QFile::remove(path));
+
+    changeFiles(QStringList(), { path }, QStringList());
+
+    QVERIFY(library.contains(componentVLNV) == false);
+
+    // A removed file not in the library is ignored.
+    changeFiles(QStringList(), { libraryDirectory_.filePath("unknown.xml") }, QStringList());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testAddedFileIsFound()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testAddedFileIsFound()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV componentVLNV = writeComponent("added");
+    finishSaves();
+
+    // The library forgets the file left on the disk and finds it again as an added file.
+    QString path = library.getPath(componentVLNV);
+    changeFiles(QStringList(), { path }, QStringList());
+    QVERIFY(library.contains(componentVLNV) == false);
+
+    changeFiles({ path }, QStringList(), QStringList());
+
+    QVERIFY(library.contains(componentVLNV));
+    QCOMPARE(library.getPath(componentVLNV), path);
+    QVERIFY(library.isValid(componentVLNV));
+
+    // A file already in the library is not added again.
+    changeFiles({ path }, QStringList(), QStringList());
+    QVERIFY(library.contains(componentVLNV));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testModifiedFileIsReadAgain()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testModifiedFileIsReadAgain()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV componentVLNV = writeComponent("modified");
+
+    QSharedPointer<Document> model = library.getModel(componentVLNV);
+    model->setDescription("Original description");
+    QVERIFY(library.writeModelToFile(model));
+    finishSaves();
+
+    QString path = library.getPath(componentVLNV);
+    replaceInFile(path, "Original description", "Modified description");
+
+    QSignalSpy changedSpy(&library, &LibraryHandler::documentFileChanged);
+
+    changeFiles(QStringList(), QStringList(), { path });
+
+    QVERIFY(library.contains(componentVLNV));
+    QCOMPARE(library.getModelReadOnly(componentVLNV)->getDescription(), QString("Modified description"));
+    QVERIFY(library.isValid(componentVLNV));
+
+    QCOMPARE(changedSpy.count(), 1);
+    QCOMPARE(changedSpy.first().first().value<VLNV>(), componentVLNV);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testPendingSaveIsNotReadAgain()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testPendingSaveIsNotReadAgain()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV componentVLNV = writeComponent("pending");
+    finishSaves();
+
+    QString path = library.getPath(componentVLNV);
+
+    QSignalSpy changedSpy(&library, &LibraryHandler::documentFileChanged);
+
+    QSharedPointer<Document> model = library.getModel(componentVLNV);
+    model->setDescription("Pending description");
+    QVERIFY(library.writeModelToFile(model));
+
+    // The write of the save is reported before the save is completed.
+    changeFiles(QStringList(), { path }, { path });
+
+    QVERIFY(library.contains(componentVLNV));
+    QCOMPARE(library.getModelReadOnly(componentVLNV)->getDescription(), QString("Pending description"));
+    QCOMPARE(changedSpy.count(), 0);
+
+    finishSaves();
+
+    QVERIFY(fileContent(path).contains("Pending description"));
+    QCOMPARE(library.getModelReadOnly(componentVLNV)->getDescription(), QString("Pending description"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testChangedVLNVReplacesDocument()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testChangedVLNVReplacesDocument()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV previousVLNV = writeComponent("previousName");
+    finishSaves();
+
+    QString path = library.getPath(previousVLNV);
+    replaceInFile(path, "previousName", "currentName");
+
+    changeFiles(QStringList(), QStringList(), { path });
+
+    VLNV currentVLNV(VLNV::COMPONENT, "TUT", "cache", "currentName", "1.0");
+    QVERIFY(library.contains(previousVLNV) == false);
+    QVERIFY(library.contains(currentVLNV));
+    QCOMPARE(library.getPath(currentVLNV), path);
+    QCOMPARE(library.getModelReadOnly(currentVLNV)->getVlnv(), currentVLNV);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testRescanAddsFoundFile()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testRescanAddsFoundFile()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    // The files saved by the previous tests are found as changed files in the first scan.
+    library.searchForIPXactFiles();
+
+    VLNV componentVLNV = writeComponentFile("rescanAdded", true);
+    QVERIFY(library.contains(componentVLNV) == false);
+    QVERIFY(treeIndex(componentVLNV).isValid() == false);
+
+    QSignalSpy treeResetSpy(library.getTreeModel(), &QAbstractItemModel::modelReset);
+    QSignalSpy hierarchyResetSpy(library.getHierarchyModel(), &QAbstractItemModel::modelReset);
+
+    library.searchForIPXactFiles();
+
+    QVERIFY(library.contains(componentVLNV));
+    QVERIFY(treeIndex(componentVLNV).isValid());
+    QVERIFY(hierarchyIndex(componentVLNV).isValid());
+
+    QCOMPARE(treeResetSpy.count(), 0);
+    QCOMPARE(hierarchyResetSpy.count(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testRescanRemovesMissingFile()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testRescanRemovesMissingFile()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV componentVLNV = writeComponent("rescanRemoved");
+    finishSaves();
+
+    library.searchForIPXactFiles();
+
+    QVERIFY(treeIndex(componentVLNV).isValid());
+    QVERIFY(hierarchyIndex(componentVLNV).isValid());
+
+    QVERIFY(QFile::remove(library.getPath(componentVLNV)));
+
+    QSignalSpy treeResetSpy(library.getTreeModel(), &QAbstractItemModel::modelReset);
+    QSignalSpy hierarchyResetSpy(library.getHierarchyModel(), &QAbstractItemModel::modelReset);
+
+    library.searchForIPXactFiles();
+
+    QVERIFY(library.contains(componentVLNV) == false);
+    QVERIFY(treeIndex(componentVLNV).isValid() == false);
+    QVERIFY(hierarchyIndex(componentVLNV).isValid() == false);
+
+    // The other documents are kept.
+    QVERIFY(treeIndex(first_).isValid());
+    QVERIFY(hierarchyIndex(first_).isValid());
+
+    QCOMPARE(treeResetSpy.count(), 0);
+    QCOMPARE(hierarchyResetSpy.count(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testRescanUpdatesModifiedFile()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testRescanUpdatesModifiedFile()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV componentVLNV = writeComponent("rescanModified");
+
+    QSharedPointer<Document> model = library.getModel(componentVLNV);
+    model->setDescription("Original");
+    QVERIFY(library.writeModelToFile(model));
+    finishSaves();
+
+    library.searchForIPXactFiles();
+
+    // The changed size marks the file modified, even if the modification time is not updated.
+    replaceInFile(library.getPath(componentVLNV), "Original", "Modified outside the library");
+
+    QSignalSpy treeResetSpy(library.getTreeModel(), &QAbstractItemModel::modelReset);
+    QSignalSpy hierarchyResetSpy(library.getHierarchyModel(), &QAbstractItemModel::modelReset);
+    QSignalSpy treeChangedSpy(library.getTreeModel(), &QAbstractItemModel::dataChanged);
+
+    library.searchForIPXactFiles();
+
+    QCOMPARE(library.getModelReadOnly(componentVLNV)->getDescription(),
+        QString("Modified outside the library"));
+
+    QModelIndex modifiedIndex = treeIndex(componentVLNV);
+    QVERIFY(modifiedIndex.isValid());
+    QVERIFY(hierarchyIndex(componentVLNV).isValid());
+
+    // The change is reported for the highest item identifying only the modified document.
+    bool modifiedRowChanged = false;
+    for (QList<QVariant> const& arguments : treeChangedSpy)
+    {
+        QModelIndex changedIndex = arguments.first().value<QModelIndex>();
+        for (QModelIndex item = modifiedIndex; item.isValid(); item = item.parent())
+        {
+            modifiedRowChanged |= item == changedIndex;
+        }
+    }
+    QVERIFY(modifiedRowChanged);
+
+    QCOMPARE(treeResetSpy.count(), 0);
+    QCOMPARE(hierarchyResetSpy.count(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testRescanUpdatesInvalidatedFile()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testRescanUpdatesInvalidatedFile()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    VLNV componentVLNV = writeComponentFile("rescanInvalid", true);
+    library.searchForIPXactFiles();
+
+    QVERIFY(library.isValid(componentVLNV));
+    QCOMPARE(treeIndex(componentVLNV).data(Qt::ForegroundRole), treeIndex(first_).data(Qt::ForegroundRole));
+    QCOMPARE(hierarchyIndex(componentVLNV).data(Qt::ForegroundRole),
+        hierarchyIndex(first_).data(Qt::ForegroundRole));
+
+    writeComponentFile("rescanInvalid", false);
+
+    QSignalSpy treeResetSpy(library.getTreeModel(), &QAbstractItemModel::modelReset);
+    QSignalSpy hierarchyResetSpy(library.getHierarchyModel(), &QAbstractItemModel::modelReset);
+
+    library.searchForIPXactFiles();
+
+    QVERIFY(library.contains(componentVLNV));
+    QVERIFY(library.isValid(componentVLNV) == false);
+
+    // The invalid documents are shown in a different color.
+    QVERIFY(treeIndex(componentVLNV).data(Qt::ForegroundRole) != treeIndex(first_).data(Qt::ForegroundRole));
+    QVERIFY(hierarchyIndex(componentVLNV).data(Qt::ForegroundRole) !=
+        hierarchyIndex(first_).data(Qt::ForegroundRole));
+
+    QCOMPARE(treeResetSpy.count(), 0);
+    QCOMPARE(hierarchyResetSpy.count(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testRescanResetsModelsAfterLargeChange()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testRescanResetsModelsAfterLargeChange()
+{
+    LibraryHandler& library = LibraryHandler::getInstance();
+
+    // Adding more than a third of the current documents changes more than a quarter of the library.
+    int const addedCount = library.getAllVLNVs().size() / 3 + 1;
+
+    QVector<VLNV> addedComponents;
+    for (int i = 0; i < addedCount; ++i)
+    {
+        addedComponents.append(writeComponentFile(QString("bulk%1").arg(i), true));
+    }
+
+    QSignalSpy treeResetSpy(library.getTreeModel(), &QAbstractItemModel::modelReset);
+    QSignalSpy hierarchyResetSpy(library.getHierarchyModel(), &QAbstractItemModel::modelReset);
+
+    library.searchForIPXactFiles();
+
+    QCOMPARE(treeResetSpy.count(), 1);
+    QCOMPARE(hierarchyResetSpy.count(), 1);
+
+    for (VLNV const& componentVLNV : addedComponents)
+    {
+        QVERIFY(treeIndex(componentVLNV).isValid());
+        QVERIFY(hierarchyIndex(componentVLNV).isValid());
+    }
+
+    QVERIFY(treeIndex(first_).isValid());
+    QVERIFY(hierarchyIndex(first_).isValid());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::writeComponent()
+//-----------------------------------------------------------------------------
+VLNV tst_LibraryHandler::writeComponent(QString const& name) const
+{
+    VLNV componentVLNV(VLNV::COMPONENT, "TUT", "cache", name, "1.0");
+
+    QSharedPointer<Component> component(new Component(componentVLNV, Document::Revision::Std22));
+    LibraryHandler::getInstance().writeModelToFile(libraryDirectory_.filePath(name), component);
+
+    return componentVLNV;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::writeComponentFile()
+//-----------------------------------------------------------------------------
+VLNV tst_LibraryHandler::writeComponentFile(QString const& name, bool valid) const
+{
+    VLNV componentVLNV(VLNV::COMPONENT, "TUT", "cache", name, "1.0");
+
+    QSharedPointer<Component> component(new Component(componentVLNV, Document::Revision::Std22));
+    if (valid == false)
+    {
+        // A parameter without a value is not valid.
+        QSharedPointer<Parameter> parameter(new Parameter());
+        parameter->setName("invalid");
+        component->getParameters()->append(parameter);
+    }
+
+    // The file is written without the library, as if it was written by another application.
+    QString directory = libraryDirectory_.filePath(name);
+    QDir().mkpath(directory);
+    DocumentFileAccess::writeDocument(component, directory + "/" + name + ".1.0.xml");
+
+    return componentVLNV;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::treeIndex()
+//-----------------------------------------------------------------------------
+QModelIndex tst_LibraryHandler::treeIndex(VLNV const& vlnv) const
+{
+    LibraryTreeModel* model = LibraryHandler::getInstance().getTreeModel();
+
+    // The tree has a level for each part of the VLNV.
+    QModelIndex item;
+    for (QString const& name : { vlnv.getVendor(), vlnv.getLibrary(), vlnv.getName(), vlnv.getVersion() })
+    {
+        QModelIndex parentItem = item;
+        item = QModelIndex();
+
+        for (int row = 0; row < model->rowCount(parentItem) && item.isValid() == false; ++row)
+        {
+            QModelIndex child = model->index(row, 0, parentItem);
+            if (child.data().toString() == name)
+            {
+                item = child;
+            }
+        }
+
+        if (item.isValid() == false)
+        {
+            break;
+        }
+    }
+
+    return item;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::hierarchyIndex()
+//-----------------------------------------------------------------------------
+QModelIndex tst_LibraryHandler::hierarchyIndex(VLNV const& vlnv) const
+{
+    HierarchyModel* model = LibraryHandler::getInstance().getHierarchyModel();
+
+    for (int row = 0; row < model->rowCount(); ++row)
+    {
+        QModelIndex item = model->index(row, HierarchyModel::OBJECT_COLUMN);
+        if (item.data().toString() == vlnv.toString())
+        {
+            return item;
+        }
+    }
+
+    return QModelIndex();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::finishSaves()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::finishSaves() const
+{
+    // The completed writes are handled before returning, without the event loop.
+    LibraryHandler::getInstance().waitForSaves();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::fileContent()
+//-----------------------------------------------------------------------------
+QString tst_LibraryHandler::fileContent(QString const& path) const
+{
+    QFile file(path);
+    file.open(QIODevice::ReadOnly);
+
+    return QString::fromUtf8(file.readAll());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::replaceInFile()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::replaceInFile(QString const& path, QString const& before, QString const& after) const
+{
+    QString content = fileContent(path);
+    QVERIFY(content.contains(before));
+
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write(content.replace(before, after).toUtf8());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::changeFiles()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::changeFiles(QStringList const& added, QStringList const& removed,
+    QStringList const& modified) const
+{
+    // The changes are normally reported by the library watcher.
+    QVERIFY(QMetaObject::invokeMethod(&LibraryHandler::getInstance(), "onLibraryFilesChanged",
+        Qt::DirectConnection, Q_ARG(QStringList, added), Q_ARG(QStringList, removed),
+        Q_ARG(QStringList, modified)));
+}
+
+QTEST_MAIN(tst_LibraryHandler)
+
+#include "tst_LibraryHandler.moc"
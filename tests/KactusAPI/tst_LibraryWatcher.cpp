@@ -0,0 +1,232 @@
+//-----------------------------------------------------------------------------
+// File: tst_LibraryWatcher.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for the library location watcher.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+
+#include <KactusAPI/include/LibraryWatcher.h>
+
+class tst_LibraryWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_LibraryWatcher();
+
+private slots:
+
+    void initTestCase();
+
+    void testAddedFileIsReported();
+    void testRemovedFileIsReported();
+    void testModifiedFileIsReported();
+    void testKnownWriteIsNotReported();
+    void testFilesInNewDirectoryAreReported();
+    void testOtherFilesAreNotReported();
+
+private:
+
+    QString createLocation(QString const& name) const;
+
+    void writeFile(QString const& path, QString const& content) const;
+
+    QTemporaryDir libraryDirectory_;
+};
+
+namespace
+{
+    //! The time to wait for a batch of changes.
+    const int CHANGE_TIMEOUT = 5000;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::tst_LibraryWatcher()
+//-----------------------------------------------------------------------------
+tst_LibraryWatcher::tst_LibraryWatcher()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::initTestCase()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::initTestCase()
+{
+    QVERIFY(libraryDirectory_.isValid());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::testAddedFileIsReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::testAddedFileIsReported()
+{
+    QString location = createLocation("added");
+
+    LibraryWatcher watcher;
+    watcher.watch({ location });
+
+    QSignalSpy spy(&watcher, &LibraryWatcher::filesChanged);
+
+    QString filePath = location + "/component.1.0.xml";
+    writeFile(filePath, "<component/>");
+
+    QVERIFY(spy.wait(CHANGE_TIMEOUT));
+    QCOMPARE(spy.count(), 1);
+
+    QList<QVariant> arguments = spy.takeFirst();
+    QCOMPARE(arguments.at(0).toStringList(), QStringList({ filePath }));
+    QVERIFY(arguments.at(1).toStringList().isEmpty());
+    QVERIFY(arguments.at(2).toStringList().isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::testRemovedFileIsReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::testRemovedFileIsReported()
+{
+    QString location = createLocation("removed");
+    QString filePath = location + "/component.1.0.xml";
+    writeFile(filePath, "<component/>");
+
+    LibraryWatcher watcher;
+    watcher.watch({ location });
+
+    QSignalSpy spy(&watcher, &LibraryWatcher::filesChanged);
+
+    QVERIFY(QFile::remove(filePath));
+
+    QVERIFY(spy.wait(CHANGE_TIMEOUT));
+
+    QList<QVariant> arguments = spy.takeFirst();
+    QVERIFY(arguments.at(0).toStringList().isEmpty());
+    QCOMPARE(arguments.at(1).toStringList(), QStringList({ filePath }));
+    QVERIFY(arguments.at(2).toStringList().isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::testModifiedFileIsReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::testModifiedFileIsReported()
+{
+    QString location = createLocation("modified");
+    QString filePath = location + "/component.1.0.xml";
+    writeFile(filePath, "<component/>");
+
+    LibraryWatcher watcher;
+    watcher.watch({ location });
+
+    QSignalSpy spy(&watcher, &LibraryWatcher::filesChanged);
+
+    writeFile(filePath, "<component><name>changed</name></component>");
+
+    QVERIFY(spy.wait(CHANGE_TIMEOUT));
+
+    QList<QVariant> arguments = spy.takeFirst();
+    QVERIFY(arguments.at(0).toStringList().isEmpty());
+    QVERIFY(arguments.at(1).toStringList().isEmpty());
+    QCOMPARE(arguments.at(2).toStringList(), QStringList({ filePath }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::testKnownWriteIsNotReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::testKnownWriteIsNotReported()
+{
+    QString location = createLocation("known");
+    QString filePath = location + "/component.1.0.xml";
+    writeFile(filePath, "<component/>");
+
+    LibraryWatcher watcher;
+    watcher.watch({ location });
+
+    QSignalSpy spy(&watcher, &LibraryWatcher::filesChanged);
+
+    writeFile(filePath, "<component><name>saved</name></component>");
+    watcher.markAsKnown(filePath);
+
+    QVERIFY(spy.wait(LibraryWatcher::BATCH_DELAY * 4) == false);
+    QCOMPARE(spy.count(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::testFilesInNewDirectoryAreReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::testFilesInNewDirectoryAreReported()
+{
+    QString location = createLocation("directory");
+
+    LibraryWatcher watcher;
+    watcher.watch({ location });
+
+    QSignalSpy spy(&watcher, &LibraryWatcher::filesChanged);
+
+    QString subdirectory = location + "/vendor/library/component/1.0";
+    QVERIFY(QDir().mkpath(subdirectory));
+
+    QString filePath = subdirectory + "/component.1.0.xml";
+    writeFile(filePath, "<component/>");
+
+    QVERIFY(spy.wait(CHANGE_TIMEOUT));
+
+    QStringList added;
+    for (QList<QVariant> const& arguments : spy)
+    {
+        added += arguments.at(0).toStringList();
+    }
+
+    QCOMPARE(added, QStringList({ filePath }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::testOtherFilesAreNotReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::testOtherFilesAreNotReported()
+{
+    QString location = createLocation("other");
+
+    LibraryWatcher watcher;
+    watcher.watch({ location });
+
+    QSignalSpy spy(&watcher, &LibraryWatcher::filesChanged);
+
+    writeFile(location + "/notes.txt", "Not an IP-XACT file.");
+
+    QVERIFY(spy.wait(LibraryWatcher::BATCH_DELAY * 4) == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::createLocation()
+//-----------------------------------------------------------------------------
+QString tst_LibraryWatcher::createLocation(QString const& name) const
+{
+    QString location = libraryDirectory_.filePath(name);
+    QDir().mkpath(location);
+
+    return location;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::writeFile()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::writeFile(QString const& path, QString const& content) const
+{
+    QFile file(path);
+    file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+
+    QTextStream output(&file);
+    output << content;
+    output.flush();
+    file.close();
+}
+
+QTEST_MAIN(tst_LibraryWatcher)
+
+#include "tst_LibraryWatcher.moc"
@@ -0,0 +1,203 @@
+//-----------------------------------------------------------------------------
+// File: tst_MultipleParameterFinder.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class MultipleParameterFinder.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QSharedPointer>
+
+#include <KactusAPI/include/ListParameterFinder.h>
+#include <KactusAPI/include/MultipleParameterFinder.h>
+
+#include <IPXACTmodels/common/Parameter.h>
+
+class tst_MultipleParameterFinder : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_MultipleParameterFinder();
+
+private slots:
+
+    void init();
+
+    void testFirstFinderResolvesId();
+    void testMissingIdIsNotFound();
+    void testEarlierFinderGainsId();
+    void testRemovedParameterIsNotFound();
+    void testMovedParameterIsFound();
+    void testRemovedFinderIsNotSearched();
+
+private:
+
+    QSharedPointer<Parameter> createParameter(QString const& name, QString const& id, QString const& value) const;
+
+    //! The parameters of the first and the second finder.
+    QSharedPointer<QList<QSharedPointer<Parameter> > > firstParameters_;
+    QSharedPointer<QList<QSharedPointer<Parameter> > > secondParameters_;
+
+    //! The finders searched by the finder under test.
+    QSharedPointer<ListParameterFinder> firstFinder_;
+    QSharedPointer<ListParameterFinder> secondFinder_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_MultipleParameterFinder::tst_MultipleParameterFinder()
+//-----------------------------------------------------------------------------
+tst_MultipleParameterFinder::tst_MultipleParameterFinder():
+firstParameters_(),
+secondParameters_(),
+firstFinder_(),
+secondFinder_()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MultipleParameterFinder::init()
+//-----------------------------------------------------------------------------
+void tst_MultipleParameterFinder::init()
+{
+    firstParameters_ = QSharedPointer<QList<QSharedPointer<Parameter> > >(new QList<QSharedPointer<Parameter> >());
+    firstParameters_->append(createParameter("first", "firstId", "1"));
+    firstParameters_->append(createParameter("shared", "sharedId", "10"));
+
+    secondParameters_ = QSharedPointer<QList<QSharedPointer<Parameter> > >(new QList<QSharedPointer<Parameter> >());
+    secondParameters_->append(createParameter("second", "secondId", "2"));
+    secondParameters_->append(createParameter("otherShared", "sharedId", "20"));
+
+    firstFinder_ = QSharedPointer<ListParameterFinder>(new ListParameterFinder());
+    firstFinder_->setParameterList(firstParameters_);
+
+    secondFinder_ = QSharedPointer<ListParameterFinder>(new ListParameterFinder());
+    secondFinder_->setParameterList(secondParameters_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MultipleParameterFinder::testFirstFinderResolvesId()
+//-----------------------------------------------------------------------------
+void tst_MultipleParameterFinder::testFirstFinderResolvesId()
+{
+    MultipleParameterFinder finder;
+    finder.addFinder(firstFinder_);
+    finder.addFinder(secondFinder_);
+
+    QCOMPARE(finder.valueForId(u"firstId"), QString("1"));
+    QCOMPARE(finder.valueForId(u"secondId"), QString("2"));
+    QCOMPARE(finder.nameForId(u"sharedId"), QString("shared"));
+    QCOMPARE(finder.getParameterWithID(u"sharedId"), firstParameters_->last());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MultipleParameterFinder::testMissingIdIsNotFound()
+//-----------------------------------------------------------------------------
+void tst_MultipleParameterFinder::testMissingIdIsNotFound()
+{
+    MultipleParameterFinder finder;
+    finder.addFinder(firstFinder_);
+
+    QVERIFY(finder.hasId(u"missingId") == false);
+    QVERIFY(finder.valueForId(u"missingId").isEmpty());
+    QVERIFY(finder.nameForId(u"missingId").isEmpty());
+    QVERIFY(finder.getParameterWithID(u"missingId").isNull() == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MultipleParameterFinder::testEarlierFinderGainsId()
+//-----------------------------------------------------------------------------
+void tst_MultipleParameterFinder::testEarlierFinderGainsId()
+{
+    MultipleParameterFinder finder;
+    finder.addFinder(firstFinder_);
+    finder.addFinder(secondFinder_);
+
+    QCOMPARE(finder.valueForId(u"secondId"), QString("2"));
+
+    firstParameters_->append(createParameter("added", "secondId", "100"));
+
+    QCOMPARE(finder.valueForId(u"secondId"), QString("100"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MultipleParameterFinder::testRemovedParameterIsNotFound()
+//-----------------------------------------------------------------------------
+void tst_MultipleParameterFinder::testRemovedParameterIsNotFound()
+{
+    MultipleParameterFinder finder;
+    finder.addFinder(firstFinder_);
+    finder.addFinder(secondFinder_);
+
+    QCOMPARE(finder.valueForId(u"sharedId"), QString("10"));
+    QVERIFY(finder.hasId(u"firstId"));
+
+    // Removing the parameters does not change the id generation.
+    firstParameters_->clear();
+
+    QCOMPARE(finder.valueForId(u"sharedId"), QString("20"));
+    QVERIFY(finder.hasId(u"firstId") == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MultipleParameterFinder::testMovedParameterIsFound()
+//-----------------------------------------------------------------------------
+void tst_MultipleParameterFinder::testMovedParameterIsFound()
+{
+    QSharedPointer<Parameter> moved = createParameter("moved", "movedId", "3");
+
+    MultipleParameterFinder finder;
+    finder.addFinder(firstFinder_);
+    finder.addFinder(secondFinder_);
+
+    QVERIFY(finder.hasId(u"movedId") == false);
+
+    // Adding an existing parameter does not change the id generation.
+    secondParameters_->append(moved);
+
+    QCOMPARE(finder.getParameterWithID(u"movedId"), moved);
+    QCOMPARE(finder.valueForId(u"movedId"), QString("3"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MultipleParameterFinder::testRemovedFinderIsNotSearched()
+//-----------------------------------------------------------------------------
+void tst_MultipleParameterFinder::testRemovedFinderIsNotSearched()
+{
+    MultipleParameterFinder finder;
+    finder.addFinder(firstFinder_);
+    finder.addFinder(secondFinder_);
+
+    QCOMPARE(finder.valueForId(u"sharedId"), QString("10"));
+
+    finder.removeFinder(firstFinder_);
+
+    QCOMPARE(finder.valueForId(u"sharedId"), QString("20"));
+    QVERIFY(finder.hasId(u"firstId") == false);
+
+    finder.removeAllFinders();
+
+    QVERIFY(finder.hasId(u"secondId") == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MultipleParameterFinder::createParameter()
+//-----------------------------------------------------------------------------
+QSharedPointer<Parameter> tst_MultipleParameterFinder::createParameter(QString const& name, QString const& id,
+    QString const& value) const
+{
+    QSharedPointer<Parameter> parameter(new Parameter());
+    parameter->setName(name);
+    parameter->setValueId(id);
+    parameter->setValue(value);
+
+    return parameter;
+}
+
+QTEST_APPLESS_MAIN(tst_MultipleParameterFinder)
+
+#include "tst_MultipleParameterFinder.moc"
@@ -0,0 +1,272 @@
+//-----------------------------------------------------------------------------
+// File: tst_NameIndex.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class NameIndex.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QSharedPointer>
+
+#include <KactusAPI/include/NameIndex.h>
+
+#include <IPXACTmodels/common/Parameter.h>
+
+class tst_NameIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_NameIndex();
+
+private slots:
+
+    void init();
+
+    void testItemIsFound();
+    void testMissingItemIsNotFound();
+    void testRenamedItemIsFound();
+    void testRemovedItemIsNotFound();
+    void testInsertedItemsAreFound();
+    void testOtherListIsIndexed();
+    void testFirstItemWithNameIsFound();
+    void testInvalidatedIndexIsRebuilt();
+    void testAppendedItemIsIndexed();
+    void testInsertedItemInvalidatesPositions();
+    void testMissDoesNotRebuild();
+
+private:
+
+    QSharedPointer<Parameter> createItem(QString const& name) const;
+
+    //! The indexed items.
+    NameIndex<Parameter>::List items_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::tst_NameIndex()
+//-----------------------------------------------------------------------------
+tst_NameIndex::tst_NameIndex():
+items_()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::init()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::init()
+{
+    items_.clear();
+    items_.append(createItem("first"));
+    items_.append(createItem("second"));
+    items_.append(createItem("third"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testItemIsFound()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testItemIsFound()
+{
+    NameIndex<Parameter> index;
+
+    QCOMPARE(index.indexOf(QString("second"), items_), 1);
+    QCOMPARE(index.indexOf(std::string("third"), items_), 2);
+    QCOMPARE(index.find("first", items_), items_.first());
+
+    QSharedPointer<NameIndex<Parameter>::List> sharedItems(new NameIndex<Parameter>::List(items_));
+    QCOMPARE(index.find("third", sharedItems), items_.last());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testMissingItemIsNotFound()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testMissingItemIsNotFound()
+{
+    NameIndex<Parameter> index;
+
+    QCOMPARE(index.indexOf(QString("missing"), items_), -1);
+    QVERIFY(index.find("missing", items_).isNull());
+
+    QSharedPointer<NameIndex<Parameter>::List> noItems;
+    QCOMPARE(index.indexOf("first", noItems), -1);
+    QVERIFY(index.find("first", noItems).isNull());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testRenamedItemIsFound()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testRenamedItemIsFound()
+{
+    NameIndex<Parameter> index;
+    QCOMPARE(index.indexOf(QString("second"), items_), 1);
+
+    // The hit is checked against the list without invalidating the index.
+    items_.at(1)->setName("renamed");
+
+    QCOMPARE(index.indexOf(QString("second"), items_), -1);
+    QCOMPARE(index.indexOf(QString("renamed"), items_), 1);
+
+    items_.at(1)->setName("second");
+    index.invalidate();
+
+    QCOMPARE(index.indexOf(QString("second"), items_), 1);
+    QCOMPARE(index.indexOf(QString("renamed"), items_), -1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testRemovedItemIsNotFound()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testRemovedItemIsNotFound()
+{
+    NameIndex<Parameter> index;
+    QCOMPARE(index.indexOf(QString("third"), items_), 2);
+
+    items_.removeFirst();
+
+    QCOMPARE(index.indexOf(QString("first"), items_), -1);
+    QCOMPARE(index.indexOf(QString("third"), items_), 1);
+    QCOMPARE(index.indexOf(QString("second"), items_), 0);
+
+    items_.removeLast();
+
+    QCOMPARE(index.indexOf(QString("third"), items_), -1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testInsertedItemsAreFound()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testInsertedItemsAreFound()
+{
+    NameIndex<Parameter> index;
+    QCOMPARE(index.indexOf(QString("fourth"), items_), -1);
+
+    // A changed item count rebuilds the index.
+    items_.append(createItem("fourth"));
+    QCOMPARE(index.indexOf(QString("fourth"), items_), 3);
+
+    // A stale position misses and rebuilds the index.
+    items_.prepend(createItem("zeroth"));
+    QCOMPARE(index.indexOf(QString("first"), items_), 1);
+    QCOMPARE(index.indexOf(QString("zeroth"), items_), 0);
+    QCOMPARE(index.indexOf(QString("fourth"), items_), 4);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testOtherListIsIndexed()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testOtherListIsIndexed()
+{
+    NameIndex<Parameter> index;
+    QCOMPARE(index.indexOf(QString("second"), items_), 1);
+
+    NameIndex<Parameter>::List otherItems;
+    otherItems.append(createItem("other"));
+    otherItems.append(createItem("second"));
+    otherItems.append(createItem("first"));
+
+    QCOMPARE(index.indexOf(QString("first"), otherItems), 2);
+    QCOMPARE(index.indexOf(QString("first"), items_), 0);
+    QCOMPARE(index.indexOf(QString("other"), items_), -1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testFirstItemWithNameIsFound()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testFirstItemWithNameIsFound()
+{
+    items_.append(createItem("first"));
+
+    NameIndex<Parameter> index;
+    QCOMPARE(index.find("first", items_), items_.first());
+
+    items_.removeFirst();
+
+    QCOMPARE(index.find("first", items_), items_.last());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testInvalidatedIndexIsRebuilt()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testInvalidatedIndexIsRebuilt()
+{
+    NameIndex<Parameter> index;
+    QCOMPARE(index.indexOf(QString("first"), items_), 0);
+
+    items_.swapItemsAt(0, 2);
+    index.invalidate();
+
+    QCOMPARE(index.indexOf(QString("first"), items_), 2);
+    QCOMPARE(index.indexOf(QString("third"), items_), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testAppendedItemIsIndexed()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testAppendedItemIsIndexed()
+{
+    NameIndex<Parameter> index;
+    QCOMPARE(index.indexOf(QString("fourth"), items_), -1);
+
+    items_.append(createItem("fourth"));
+    index.insert(items_.size() - 1, items_);
+
+    QCOMPARE(index.indexOf(QString("fourth"), items_), 3);
+
+    // The first item of a duplicated name is kept.
+    items_.append(createItem("first"));
+    index.insert(items_.size() - 1, items_);
+
+    QCOMPARE(index.find("first", items_), items_.first());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testInsertedItemInvalidatesPositions()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testInsertedItemInvalidatesPositions()
+{
+    NameIndex<Parameter> index;
+    QCOMPARE(index.indexOf(QString("third"), items_), 2);
+
+    items_.insert(1, createItem("inserted"));
+    index.insert(1, items_);
+
+    QCOMPARE(index.indexOf(QString("inserted"), items_), 1);
+    QCOMPARE(index.indexOf(QString("third"), items_), 3);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testMissDoesNotRebuild()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testMissDoesNotRebuild()
+{
+    NameIndex<Parameter> index;
+    QCOMPARE(index.indexOf(QString("first"), items_), 0);
+
+    // A rename outside the owner keeps the item count, so the index stays current and the new name is not found.
+    items_.at(2)->setName("renamed");
+
+    QCOMPARE(index.indexOf(QString("renamed"), items_), -1);
+
+    index.invalidate();
+
+    QCOMPARE(index.indexOf(QString("renamed"), items_), 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::createItem()
+//-----------------------------------------------------------------------------
+QSharedPointer<Parameter> tst_NameIndex::createItem(QString const& name) const
+{
+    QSharedPointer<Parameter> item(new Parameter());
+    item->setName(name);
+
+    return item;
+}
+
+QTEST_APPLESS_MAIN(tst_NameIndex)
+
+#include "tst_NameIndex.moc"
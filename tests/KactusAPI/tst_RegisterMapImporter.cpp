@@ -0,0 +1,345 @@
+//-----------------------------------------------------------------------------
+// File: tst_RegisterMapImporter.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 18.10.2026
+//
+// Description:
+// Unit test for class RegisterMapImporter.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QBuffer>
+#include <QSharedPointer>
+#include <QTemporaryDir>
+
+#include <KactusAPI/include/RegisterMapImporter.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/Register.h>
+#include <IPXACTmodels/Component/Field.h>
+#include <IPXACTmodels/Component/FieldReset.h>
+
+class tst_RegisterMapImporter : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_RegisterMapImporter();
+
+private slots:
+
+    void testImportCsv();
+    void testImportJsonLines();
+    void testImportJsonArray();
+    void testFileFormatIsSelectedBySuffix();
+    void testExistingItemsAreReused();
+    void testInvalidRowsAreReported();
+    void testUnknownAccessIsNotImported();
+
+private:
+
+    int importText(RegisterMapImporter& importer, QByteArray text, RegisterMapImporter::Format format) const;
+
+    QSharedPointer<Register> findRegister(QSharedPointer<Component> component, QString const& mapName,
+        QString const& blockName, QString const& registerName) const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterMapImporter::tst_RegisterMapImporter()
+//-----------------------------------------------------------------------------
+tst_RegisterMapImporter::tst_RegisterMapImporter()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterMapImporter::testImportCsv()
+//-----------------------------------------------------------------------------
+void tst_RegisterMapImporter::testImportCsv()
+{
+    QSharedPointer<Component> testComponent(new Component());
+    RegisterMapImporter importer(testComponent);
+
+    QByteArray input(
+        "memoryMap,addressBlock,blockRange,register,registerOffset,field,bitOffset,bitWidth,access,resetValue,"
+        "description\n"
+        "map,block,16,control,'h0,enable,0,1,read-write,0,\"Enables the unit, when set\"\n"
+        "map,block,,control,,mode,1,2,read-only,,\"Multi-line\n"
+        "description\"\n"
+        "map,block,,status,'h4,,,,,,\n");
+
+    QCOMPARE(importText(importer, input, RegisterMapImporter::Format::CSV), 3);
+    QCOMPARE(importer.getErrors().size(), 0);
+
+    QCOMPARE(testComponent->getMemoryMaps()->size(), 1);
+    QSharedPointer<AddressBlock> block =
+        testComponent->getMemoryMaps()->first()->getMemoryBlocks()->first().dynamicCast<AddressBlock>();
+    QVERIFY(block);
+    QCOMPARE(block->getRange(), QString("16"));
+    QCOMPARE(block->getRegisterData()->size(), 2);
+
+    QSharedPointer<Register> control = findRegister(testComponent, "map", "block", "control");
+    QVERIFY(control);
+    QCOMPARE(control->getAddressOffset(), QString("'h0"));
+    QCOMPARE(control->getFields()->size(), 2);
+
+    QSharedPointer<Field> enable = control->getFields()->first();
+    QCOMPARE(enable->name(), QString("enable"));
+    QCOMPARE(enable->getBitWidth(), QString("1"));
+    QCOMPARE(enable->getAccess(), AccessTypes::READ_WRITE);
+    QCOMPARE(enable->getDescription(), QString("Enables the unit, when set"));
+    QCOMPARE(enable->getResets()->size(), 1);
+    QCOMPARE(enable->getResets()->first()->getResetValue(), QString("0"));
+
+    QSharedPointer<Field> mode = control->getFields()->last();
+    QCOMPARE(mode->getBitOffset(), QString("1"));
+    QCOMPARE(mode->getDescription(), QString("Multi-line\ndescription"));
+    QCOMPARE(mode->getResets()->size(), 0);
+
+    QSharedPointer<Register> status = findRegister(testComponent, "map", "block", "status");
+    QVERIFY(status);
+    QCOMPARE(status->getFields()->size(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterMapImporter::testImportJsonLines()
+//-----------------------------------------------------------------------------
+void tst_RegisterMapImporter::testImportJsonLines()
+{
+    QSharedPointer<Component> testComponent(new Component());
+    RegisterMapImporter importer(testComponent);
+
+    QByteArray input(
+        "{\"memoryMap\": \"map\", \"addressBlock\": \"block\", \"register\": \"data\", \"registerOffset\": 8, "
+        "\"field\": \"value\", \"bitOffset\": 0, \"bitWidth\": 32}\n"
+        "\n"
+        "{\"MemoryMap\": \"map\", \"AddressBlock\": \"other\", \"Register\": \"data\", \"RegisterOffset\": 0}\n");
+
+    QCOMPARE(importText(importer, input, RegisterMapImporter::Format::JsonLines), 2);
+    QCOMPARE(importer.getErrors().size(), 0);
+
+    QCOMPARE(testComponent->getMemoryMaps()->first()->getMemoryBlocks()->size(), 2);
+
+    QSharedPointer<Register> data = findRegister(testComponent, "map", "block", "data");
+    QVERIFY(data);
+    QCOMPARE(data->getAddressOffset(), QString("8"));
+    QCOMPARE(data->getFields()->first()->getBitWidth(), QString("32"));
+
+    QVERIFY(findRegister(testComponent, "map", "other", "data"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterMapImporter::testImportJsonArray()
+//-----------------------------------------------------------------------------
+void tst_RegisterMapImporter::testImportJsonArray()
+{
+    QSharedPointer<Component> testComponent(new Component());
+    RegisterMapImporter importer(testComponent);
+
+    QByteArray input(
+        "[\n"
+        "  {\"memoryMap\": \"map\", \"addressBlock\": \"block\", \"register\": \"data\",\n"
+        "   \"registerOffset\": 8, \"field\": \"value\", \"bitOffset\": 0, \"bitWidth\": 32},\n"
+        "  \"not an object\",\n"
+        "  {\"memoryMap\": \"map\", \"addressBlock\": \"block\", \"register\": \"status\"}\n"
+        "]\n");
+
+    QCOMPARE(importText(importer, input, RegisterMapImporter::Format::Json), 1);
+
+    QVector<RegisterMapImporter::RowError> errors = importer.getErrors();
+    QCOMPARE(errors.size(), 2);
+    QCOMPARE(errors.at(0).line, 2);
+    QCOMPARE(errors.at(1).line, 3);
+
+    QSharedPointer<Register> data = findRegister(testComponent, "map", "block", "data");
+    QVERIFY(data);
+    QCOMPARE(data->getAddressOffset(), QString("8"));
+    QCOMPARE(data->getFields()->first()->name(), QString("value"));
+
+    RegisterMapImporter invalidImporter(testComponent);
+    QCOMPARE(importText(invalidImporter, "[{\"memoryMap\": ", RegisterMapImporter::Format::Json), 0);
+    QCOMPARE(invalidImporter.getErrors().size(), 1);
+    QCOMPARE(invalidImporter.getErrors().first().line, 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterMapImporter::testFileFormatIsSelectedBySuffix()
+//-----------------------------------------------------------------------------
+void tst_RegisterMapImporter::testFileFormatIsSelectedBySuffix()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    QFile jsonFile(directory.filePath("registers.json"));
+    QVERIFY(jsonFile.open(QIODevice::WriteOnly));
+    jsonFile.write(
+        "[{\"memoryMap\": \"map\", \"addressBlock\": \"block\", \"register\": \"first\", "
+        "\"registerOffset\": 0},\n"
+        " {\"memoryMap\": \"map\", \"addressBlock\": \"block\", \"register\": \"second\", "
+        "\"registerOffset\": 4}]\n");
+    jsonFile.close();
+
+    QFile linesFile(directory.filePath("registers.jsonl"));
+    QVERIFY(linesFile.open(QIODevice::WriteOnly));
+    linesFile.write(
+        "{\"memoryMap\": \"map\", \"addressBlock\": \"block\", \"register\": \"third\", "
+        "\"registerOffset\": 8}\n");
+    linesFile.close();
+
+    QSharedPointer<Component> testComponent(new Component());
+    RegisterMapImporter importer(testComponent);
+
+    QCOMPARE(importer.importFile(jsonFile.fileName()), 2);
+    QCOMPARE(importer.importFile(linesFile.fileName()), 1);
+    QCOMPARE(importer.getErrors().size(), 0);
+
+    QVERIFY(findRegister(testComponent, "map", "block", "first"));
+    QVERIFY(findRegister(testComponent, "map", "block", "second"));
+    QVERIFY(findRegister(testComponent, "map", "block", "third"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterMapImporter::testExistingItemsAreReused()
+//-----------------------------------------------------------------------------
+void tst_RegisterMapImporter::testExistingItemsAreReused()
+{
+    QSharedPointer<Register> existingRegister(new Register("control", "0", "32"));
+    existingRegister->getFields()->append(QSharedPointer<Field>(new Field("enable")));
+
+    QSharedPointer<AddressBlock> existingBlock(new AddressBlock("block", "0"));
+    existingBlock->getRegisterData()->append(existingRegister);
+
+    QSharedPointer<MemoryMap> existingMap(new MemoryMap("map"));
+    existingMap->getMemoryBlocks()->append(existingBlock);
+
+    QSharedPointer<Component> testComponent(new Component());
+    testComponent->getMemoryMaps()->append(existingMap);
+
+    RegisterMapImporter importer(testComponent);
+
+    QByteArray input(
+        "memoryMap,addressBlock,register,field,bitOffset,bitWidth\n"
+        "map,block,control,mode,1,1\n"
+        "map,block,control,enable,0,1\n");
+
+    QCOMPARE(importText(importer, input, RegisterMapImporter::Format::CSV), 1);
+    QCOMPARE(importer.getErrors().size(), 1);
+    QCOMPARE(importer.getErrors().first().line, 3);
+
+    QCOMPARE(testComponent->getMemoryMaps()->size(), 1);
+    QCOMPARE(existingMap->getMemoryBlocks()->size(), 1);
+    QCOMPARE(existingBlock->getRegisterData()->size(), 1);
+    QCOMPARE(existingRegister->getFields()->size(), 2);
+    QCOMPARE(existingRegister->getFields()->last()->name(), QString("mode"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterMapImporter::testInvalidRowsAreReported()
+//-----------------------------------------------------------------------------
+void tst_RegisterMapImporter::testInvalidRowsAreReported()
+{
+    QSharedPointer<Component> testComponent(new Component());
+    RegisterMapImporter importer(testComponent);
+
+    QByteArray input(
+        "memoryMap,addressBlock,register,registerOffset,field,bitOffset,bitWidth\n"
+        "map,,control,0,enable,0,1\n"
+        "map,block,control,,enable,0,1\n"
+        "map,block,control,0,enable,,1\n"
+        "map,block,control,0,enable,0,1,extra\n"
+        "map,block,control,0,enable,0,1\n"
+        "map,block,control,4,mode,1,1\n");
+
+    QCOMPARE(importText(importer, input, RegisterMapImporter::Format::CSV), 1);
+
+    QVector<RegisterMapImporter::RowError> errors = importer.getErrors();
+    QCOMPARE(errors.size(), 5);
+    QCOMPARE(errors.at(0).line, 2);
+    QCOMPARE(errors.at(1).line, 3);
+    QCOMPARE(errors.at(2).line, 4);
+    QCOMPARE(errors.at(3).line, 5);
+    QCOMPARE(errors.at(4).line, 7);
+
+    QSharedPointer<Register> control = findRegister(testComponent, "map", "block", "control");
+    QVERIFY(control);
+    QCOMPARE(control->getFields()->size(), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterMapImporter::testUnknownAccessIsNotImported()
+//-----------------------------------------------------------------------------
+void tst_RegisterMapImporter::testUnknownAccessIsNotImported()
+{
+    QSharedPointer<Component> testComponent(new Component());
+    RegisterMapImporter importer(testComponent);
+
+    QByteArray input(
+        "memoryMap,addressBlock,register,registerOffset,field,bitOffset,bitWidth,access\n"
+        "map,block,control,0,enable,0,1,read-write\n"
+        "map,block,control,,mode,1,1,sometimes\n"
+        "map,other,status,4,ready,0,1,never\n");
+
+    QCOMPARE(importText(importer, input, RegisterMapImporter::Format::CSV), 1);
+
+    QVector<RegisterMapImporter::RowError> errors = importer.getErrors();
+    QCOMPARE(errors.size(), 2);
+    QCOMPARE(errors.at(0).line, 3);
+    QCOMPARE(errors.at(1).line, 4);
+
+    QSharedPointer<Register> control = findRegister(testComponent, "map", "block", "control");
+    QVERIFY(control);
+    QCOMPARE(control->getFields()->size(), 1);
+    QCOMPARE(control->getFields()->first()->name(), QString("enable"));
+
+    // The rejected row does not create its containing items.
+    QCOMPARE(testComponent->getMemoryMaps()->first()->getMemoryBlocks()->size(), 1);
+    QVERIFY(findRegister(testComponent, "map", "other", "status").isNull());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterMapImporter::importText()
+//-----------------------------------------------------------------------------
+int tst_RegisterMapImporter::importText(RegisterMapImporter& importer, QByteArray text,
+    RegisterMapImporter::Format format) const
+{
+    QBuffer input(&text);
+    input.open(QIODevice::ReadOnly | QIODevice::Text);
+
+    return importer.importData(input, format);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterMapImporter::findRegister()
+//-----------------------------------------------------------------------------
+QSharedPointer<Register> tst_RegisterMapImporter::findRegister(QSharedPointer<Component> component,
+    QString const& mapName, QString const& blockName, QString const& registerName) const
+{
+    for (QSharedPointer<MemoryMap> map : *component->getMemoryMaps())
+    {
+        for (QSharedPointer<MemoryBlockBase> blockItem : *map->getMemoryBlocks())
+        {
+            QSharedPointer<AddressBlock> block = blockItem.dynamicCast<AddressBlock>();
+            if (map->name() != mapName || block.isNull() || block->name() != blockName)
+            {
+                continue;
+            }
+
+            for (QSharedPointer<RegisterBase> registerItem : *block->getRegisterData())
+            {
+                if (registerItem->name() == registerName)
+                {
+                    return registerItem.dynamicCast<Register>();
+                }
+            }
+        }
+    }
+
+    return QSharedPointer<Register>();
+}
+
+QTEST_MAIN(tst_RegisterMapImporter)
+
+#include "tst_RegisterMapImporter.moc"
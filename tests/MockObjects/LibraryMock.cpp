@@ -11,6 +11,8 @@
 
 #include "LibraryMock.h"
 
+#include <KactusAPI/include/DocumentSummary.h>
+
 #include <IPXACTmodels/common/Document.h>
 #include <IPXACTmodels/common/VLNV.h>
 
@@ -65,6 +67,14 @@ QSharedPointer<Document const> LibraryMock::getModelReadOnly(const VLNV& vlnv)
     return components_.value(vlnv, QSharedPointer<Document>(0));
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryMock::getSummary()
+//-----------------------------------------------------------------------------
+QSharedPointer<DocumentSummary const> LibraryMock::getSummary(const VLNV& /*vlnv*/)
+{
+    return QSharedPointer<DocumentSummary const>();
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryMock::contains()
 //-----------------------------------------------------------------------------
@@ -304,3 +314,11 @@ void LibraryMock::endSave()
 {
    Q_ASSERT(false);
 }
+
+//-----------------------------------------------------------------------------
+// Function: LibraryMock::waitForSaves()
+//-----------------------------------------------------------------------------
+void LibraryMock::waitForSaves()
+{
+
+}
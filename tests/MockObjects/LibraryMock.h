@@ -63,6 +63,15 @@ public:
     */
     virtual QSharedPointer<Document const> getModelReadOnly(const VLNV& vlnv);
 
+    /*!
+    *  Method description.
+    *
+    *    @param [in]    Description.
+    *
+    *    @return Description.
+    */
+    virtual QSharedPointer<DocumentSummary const> getSummary(const VLNV& vlnv);
+
     /*!
     *  Method description.
     *
@@ -324,6 +333,9 @@ public slots:
     */
     virtual void endSave();
 
+    //! The mock writes the documents immediately, so there is nothing to wait for.
+    virtual void waitForSaves();
+
 private:
 
     //! Disable copying.
@@ -63,6 +63,7 @@ private slots:
 
     void testDesignMemoryMapHeaderGeneration();
     void testMemoryMapHeaderGenerationInDesignWithMultipleSlaves();
+    void testDesignMemoryMapHeaderWithSharedRegisterLayouts();
     void testDesignMemoryMapHeaderWithReferences();
     void testDesignMemoryMapHeaderWithMasterReference();
     void testDesignMemoryMapHeaderWithConfigurableElements();
@@ -963,6 +964,261 @@ void tst_MemoryMapHeaderGenerator::testMemoryMapHeaderGenerationInDesignWithMult
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapHeaderGenerator::testDesignMemoryMapHeaderWithSharedRegisterLayouts()
+//-----------------------------------------------------------------------------
+void tst_MemoryMapHeaderGenerator::testDesignMemoryMapHeaderWithSharedRegisterLayouts()
+{
+    QSharedPointer<Component> masterComponent = createTestMasterComponent("masterComponent", "4");
+    QSharedPointer<Component> slaveComponent = createTestSlaveComponent("slaveComponent", "4");
+    QSharedPointer<Component> slaveComponentTwo = createTestSlaveComponent("slaveComponentTwo", "8");
+
+    // The instances of the shared layout are behind bridges to place them at different base addresses.
+    QSharedPointer<Component> bridgeComponentOne = createTestBridgeComponent("bridgeComponentOne", "16", "");
+    QSharedPointer<Component> bridgeComponentTwo = createTestBridgeComponent("bridgeComponentTwo", "32", "");
+
+    QSharedPointer<Design> headerDesign (new Design(VLNV(VLNV::DESIGN, "TUT", "TestLibrary", "headerDesign",
+        "1.0"), Document::Revision::Std14));
+
+    library_.addComponent(masterComponent);
+    library_.writeModelToFile("C:/Test/TestLibrary/TestComponent/1.0/masterComponent.1.0.xml", topComponent_);
+    library_.addComponent(slaveComponent);
+    library_.writeModelToFile("C:/Test/TestLibrary/TestComponent/1.0/slaveComponent.1.0.xml", topComponent_);
+    library_.addComponent(slaveComponentTwo);
+    library_.writeModelToFile("C:/Test/TestLibrary/TestComponent/1.0/slaveComponentTwo.1.0.xml", topComponent_);
+    library_.addComponent(bridgeComponentOne);
+    library_.writeModelToFile("C:/Test/TestLibrary/TestComponent/1.0/bridgeComponentOne.1.0.xml", topComponent_);
+    library_.addComponent(bridgeComponentTwo);
+    library_.writeModelToFile("C:/Test/TestLibrary/TestComponent/1.0/bridgeComponentTwo.1.0.xml", topComponent_);
+    library_.addComponent(headerDesign);
+    library_.writeModelToFile("C:/Test/TestLibrary/TestComponent/1.0/testDesign.1.0.xml", topComponent_);
+
+    QSharedPointer<ComponentInstance> masterInstance (new ComponentInstance("masterInstance_0", 
+        QSharedPointer<ConfigurableVLNVReference>(new ConfigurableVLNVReference(masterComponent->getVlnv())))); 
+    masterInstance->setUuid("masterID");
+
+    QSharedPointer<ComponentInstance> bridgeInstanceOne (new ComponentInstance("bridgeInstance_0",
+        QSharedPointer<ConfigurableVLNVReference>(new ConfigurableVLNVReference(bridgeComponentOne->getVlnv()))));
+    bridgeInstanceOne->setUuid("bridgeID_0");
+
+    QSharedPointer<ComponentInstance> bridgeInstanceTwo (new ComponentInstance("bridgeInstance_1",
+        QSharedPointer<ConfigurableVLNVReference>(new ConfigurableVLNVReference(bridgeComponentTwo->getVlnv()))));
+    bridgeInstanceTwo->setUuid("bridgeID_1");
+
+    QSharedPointer<ComponentInstance> slaveInstanceOne (new ComponentInstance("slaveInstance_0", 
+        QSharedPointer<ConfigurableVLNVReference>(new ConfigurableVLNVReference(slaveComponent->getVlnv())))); 
+    slaveInstanceOne->setUuid("slaveID_0");
+
+    QSharedPointer<ComponentInstance> slaveInstanceTwo (new ComponentInstance("slaveInstance_1",
+        QSharedPointer<ConfigurableVLNVReference>(new ConfigurableVLNVReference(slaveComponent->getVlnv()))));
+    slaveInstanceTwo->setUuid("slaveID_1");
+
+    QSharedPointer<ComponentInstance> slaveInstanceThree (new ComponentInstance("slaveInstanceTwo_0",
+        QSharedPointer<ConfigurableVLNVReference>(new ConfigurableVLNVReference(slaveComponentTwo->getVlnv()))));
+    slaveInstanceThree->setUuid("slaveIDTwo_0");
+    
+    QSharedPointer<QList<QSharedPointer<ComponentInstance> > > componentInstances(
+        new QList<QSharedPointer<ComponentInstance> >());
+    componentInstances->append(masterInstance);
+    componentInstances->append(bridgeInstanceOne);
+    componentInstances->append(bridgeInstanceTwo);
+    componentInstances->append(slaveInstanceOne);
+    componentInstances->append(slaveInstanceTwo);
+    componentInstances->append(slaveInstanceThree);
+    headerDesign->setComponentInstances(componentInstances);
+
+    QSharedPointer<ActiveInterface> interfaceMaster (
+        new ActiveInterface(masterInstance->getInstanceName(), masterComponent->getBusInterfaceNames().at(0)));
+    QSharedPointer<ActiveInterface> interfaceBridgeOneSlave (new ActiveInterface(
+        bridgeInstanceOne->getInstanceName(), bridgeComponentOne->getBusInterfaceNames().at(0)));
+    QSharedPointer<ActiveInterface> interfaceBridgeOneMaster (new ActiveInterface(
+        bridgeInstanceOne->getInstanceName(), bridgeComponentOne->getBusInterfaceNames().at(1)));
+    QSharedPointer<ActiveInterface> interfaceBridgeTwoSlave (new ActiveInterface(
+        bridgeInstanceTwo->getInstanceName(), bridgeComponentTwo->getBusInterfaceNames().at(0)));
+    QSharedPointer<ActiveInterface> interfaceBridgeTwoMaster (new ActiveInterface(
+        bridgeInstanceTwo->getInstanceName(), bridgeComponentTwo->getBusInterfaceNames().at(1)));
+    QSharedPointer<ActiveInterface> interfaceSlaveOne (new ActiveInterface(
+        slaveInstanceOne->getInstanceName(), slaveComponent->getBusInterfaceNames().at(0)));
+    QSharedPointer<ActiveInterface> interfaceSlaveTwo (new ActiveInterface(
+        slaveInstanceTwo->getInstanceName(), slaveComponent->getBusInterfaceNames().at(0)));
+    QSharedPointer<ActiveInterface> interfaceSlaveThree (new ActiveInterface(
+        slaveInstanceThree->getInstanceName(), slaveComponentTwo->getBusInterfaceNames().at(0)));
+
+    QSharedPointer<Interconnection> masterBridgeOneConnection(
+        new Interconnection("masterBridgeOne", interfaceMaster));
+    masterBridgeOneConnection->getActiveInterfaces()->append(interfaceBridgeOneSlave);
+
+    QSharedPointer<Interconnection> masterBridgeTwoConnection(
+        new Interconnection("masterBridgeTwo", interfaceMaster));
+    masterBridgeTwoConnection->getActiveInterfaces()->append(interfaceBridgeTwoSlave);
+
+    QSharedPointer<Interconnection> masterSlaveThreeConnection(new Interconnection(
+        "masterSlaveThree", interfaceMaster));
+    masterSlaveThreeConnection->getActiveInterfaces()->append(interfaceSlaveThree);
+
+    QSharedPointer<Interconnection> bridgeOneSlaveConnection(
+        new Interconnection("bridgeOneSlaveOne", interfaceBridgeOneMaster));
+    bridgeOneSlaveConnection->getActiveInterfaces()->append(interfaceSlaveOne);
+
+    QSharedPointer<Interconnection> bridgeTwoSlaveConnection(
+        new Interconnection("bridgeTwoSlaveTwo", interfaceBridgeTwoMaster));
+    bridgeTwoSlaveConnection->getActiveInterfaces()->append(interfaceSlaveTwo);
+
+    QSharedPointer<QList<QSharedPointer<Interconnection> > >  interconnectionList = 
+        headerDesign->getInterconnections();
+    interconnectionList->append(masterBridgeOneConnection);
+    interconnectionList->append(masterBridgeTwoConnection);
+    interconnectionList->append(masterSlaveThreeConnection);
+    interconnectionList->append(bridgeOneSlaveConnection);
+    interconnectionList->append(bridgeTwoSlaveConnection);
+    
+    QSharedPointer<View> headerTestView(new View("headerView"));
+    
+    headerTestView->setDesignInstantiationRef("testInstantiation");
+    
+    QSharedPointer<DesignInstantiation> testInstatiation(new DesignInstantiation("testInstantiation"));
+    testInstatiation->setDesignReference(QSharedPointer<ConfigurableVLNVReference>(
+        new ConfigurableVLNVReference(headerDesign->getVlnv())));
+
+    topComponent_->getViews()->append(headerTestView);
+
+    QFileInfo saveFileInfo (targetPath_);
+
+    headerGenerator_->setGlobalSaveFileOptions(topComponent_, "masterInstance_0", "masterID",
+        masterComponent->getBusInterfaceNames().at(0), saveFileInfo, true);
+
+    QWidget parentWidget;
+
+    MessagePasser messageChannel;
+    PluginUtilityAdapter adapter(&library_, &messageChannel, QString(), &parentWidget);
+
+    headerGenerator_->runGenerator(&adapter, topComponent_, headerDesign, QSharedPointer<DesignConfiguration>());
+
+    readOutPutFile();
+
+    QString headerDefine = "__MASTERINSTANCE_0_" + masterComponent->getBusInterfaceNames().at(0).toUpper() + "_H";
+
+    QString expectedOutput(
+        "/*\n"
+        " * File: generatorOutput.h\n"
+        " * Created on: " + QDate::currentDate().toString("dd.MM.yyyy") + "\n"
+        " * Generated by: \n"
+        " *\n"
+        " * Description:\n"
+        " * Header file generated by Kactus2 for instance \"masterInstance_0\" interface \"masterBusInterface\".\n"
+        " * This file contains addresses of the memories and registers defined in the memory maps of connected "
+            "components.\n"
+        " * Source component: " + topComponent_->getVlnv().toString(":") + ".\n"
+        "*/\n"
+        "\n"
+        "#ifndef " + headerDefine + "\n"
+        "#define " + headerDefine + "\n"
+        "\n"
+        "/*\n"
+        " * Instance: " + slaveInstanceOne->getInstanceName() + " Interface: " +
+            slaveComponent->getBusInterfaceNames().at(0) + "\n"
+        " * Instance base address: 0x14\n"
+        " * Source component: " + slaveComponent->getVlnv().toString(":") + "\n"
+        " * The defines for the memory map \"slaveMemoryMap\":\n"
+        "*/\n"
+        "\n"
+        "/*\n"
+        " * Register layout: SLAVECOMPONENT_SLAVEMEMORYMAP\n"
+        " * Register offsets are relative to the instance base address.\n"
+        "*/\n"
+        "/*\n"
+        " * Address block: slaveAddressBlock\n"
+        "*/\n"
+        "/*\n"
+        " * Register name: slaveRegister\n"
+        " * Offset: 4\n"
+        "*/\n"
+        "#define SLAVECOMPONENT_SLAVEMEMORYMAP_SLAVEREGISTER 0x4\n"
+        "\n"
+        "/*\n"
+        " * Registers of instance " + slaveInstanceOne->getInstanceName() +
+            " use the register layout SLAVECOMPONENT_SLAVEMEMORYMAP.\n"
+        "*/\n"
+        "#define " + slaveInstanceOne->getInstanceName().toUpper() + "_BASE 0x14\n"
+        "#define " + slaveInstanceOne->getInstanceName().toUpper() + "_REGISTER(name) (" +
+            slaveInstanceOne->getInstanceName().toUpper() + "_BASE + SLAVECOMPONENT_SLAVEMEMORYMAP_##name)\n"
+        "\n"
+        "/*\n"
+        " * Instance: " + slaveInstanceTwo->getInstanceName() + " Interface: " +
+            slaveComponent->getBusInterfaceNames().at(0) + "\n"
+        " * Instance base address: 0x24\n"
+        " * Source component: " + slaveComponent->getVlnv().toString(":") + "\n"
+        " * The defines for the memory map \"slaveMemoryMap\":\n"
+        "*/\n"
+        "\n"
+        "/*\n"
+        " * Registers of instance " + slaveInstanceTwo->getInstanceName() +
+            " use the register layout SLAVECOMPONENT_SLAVEMEMORYMAP.\n"
+        "*/\n"
+        "#define " + slaveInstanceTwo->getInstanceName().toUpper() + "_BASE 0x24\n"
+        "#define " + slaveInstanceTwo->getInstanceName().toUpper() + "_REGISTER(name) (" +
+            slaveInstanceTwo->getInstanceName().toUpper() + "_BASE + SLAVECOMPONENT_SLAVEMEMORYMAP_##name)\n"
+        "\n"
+        "/*\n"
+        " * Instance: " + slaveInstanceThree->getInstanceName() + " Interface: " +
+            slaveComponentTwo->getBusInterfaceNames().at(0) + "\n"
+        " * Instance base address: 0x4\n"
+        " * Source component: " + slaveComponentTwo->getVlnv().toString(":") + "\n"
+        " * The defines for the memory map \"slaveMemoryMap\":\n"
+        "*/\n"
+        "\n"
+        "/*\n"
+        " * Register layout: SLAVECOMPONENTTWO_SLAVEMEMORYMAP\n"
+        " * Register offsets are relative to the instance base address.\n"
+        "*/\n"
+        "/*\n"
+        " * Address block: slaveAddressBlock\n"
+        "*/\n"
+        "/*\n"
+        " * Register name: slaveRegister\n"
+        " * Offset: 8\n"
+        "*/\n"
+        "#define SLAVECOMPONENTTWO_SLAVEMEMORYMAP_SLAVEREGISTER 0x8\n"
+        "\n"
+        "/*\n"
+        " * Registers of instance " + slaveInstanceThree->getInstanceName() +
+            " use the register layout SLAVECOMPONENTTWO_SLAVEMEMORYMAP.\n"
+        "*/\n"
+        "#define " + slaveInstanceThree->getInstanceName().toUpper() + "_BASE 0x4\n"
+        "#define " + slaveInstanceThree->getInstanceName().toUpper() + "_REGISTER(name) (" +
+            slaveInstanceThree->getInstanceName().toUpper() + "_BASE + SLAVECOMPONENTTWO_SLAVEMEMORYMAP_##name)\n"
+        "\n"
+        );
+
+    if (!output_.contains(expectedOutput))
+    {
+        QStringList outputLines = output_.split("\n");
+        QStringList expectedLines = expectedOutput.split("\n");
+
+        QVERIFY(outputLines.count() >= expectedLines.count());
+
+        int lineOffset = outputLines.indexOf(expectedLines.first());
+        if (lineOffset == -1)
+        {
+            readOutPutFile();
+            QCOMPARE(output_, expectedOutput);
+        }
+        else
+        {
+            int lineCount = expectedLines.count();
+            for (int i = 0; i < lineCount; ++i)
+            {
+                QCOMPARE(outputLines.at(i + lineOffset), expectedLines.at(i));
+            }
+        }
+    }
+    else if (output_.count(expectedOutput) != 1)
+    {
+        QVERIFY2(false, QString(expectedOutput + " was found " + QString::number(output_.count(expectedOutput)) +
+            " times in output.").toLocal8Bit());
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_MemoryMapHeaderGenerator::testDesignMemoryMapHeaderWithReferences()
 //-----------------------------------------------------------------------------
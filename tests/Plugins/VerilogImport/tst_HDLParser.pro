@@ -13,7 +13,7 @@ TEMPLATE = app
 
 TARGET = tst_HDLParser
 
-QT += core xml testlib
+QT += core xml testlib concurrent
 CONFIG += c++11 testcase console
 
 win32:CONFIG(release, debug|release) {
@@ -0,0 +1,16 @@
+#-----------------------------------------------------------------------------
+# File: PythonAPI.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author: agent
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for the Kactus2 Python API.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = subdirs
+
+CONFIG += testcase
+SUBDIRS += \
+            tst_PythonAPI.pro
@@ -0,0 +1,281 @@
+//-----------------------------------------------------------------------------
+// File: tst_PythonAPI.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for the batch operations of class PythonAPI.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QTemporaryDir>
+
+#include <PythonAPI/PythonAPI.h>
+
+#include <KactusAPI/KactusAPI.h>
+#include <KactusAPI/include/ConsoleMediator.h>
+#include <KactusAPI/include/LibraryInterface.h>
+
+#include <IPXACTmodels/common/ConfigurableVLNVReference.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/Port.h>
+
+#include <IPXACTmodels/Design/ComponentInstance.h>
+#include <IPXACTmodels/Design/Design.h>
+
+class tst_PythonAPI : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_PythonAPI();
+
+private slots:
+
+    void initTestCase();
+
+    void testQueuedConnectionIsCreatedOnCommit();
+    void testFailedConnectionsAreReported();
+    void testConnectionWithoutDesignIsRejected();
+    void testQueuedConnectionsAreSavedWithDesign();
+    void testDesignChangeCreatesQueuedConnections();
+    void testClosedDesignCreatesQueuedConnections();
+    void testDiscardedConnectionsAreNotCreated();
+
+private:
+
+    VLNV createDesign(QString const& name);
+
+    int adHocConnectionCount(VLNV const& designVLNV) const;
+
+    //! The channel for the library messages.
+    ConsoleMediator messages_;
+
+    //! The directory containing the test library.
+    QTemporaryDir libraryDirectory_;
+
+    //! The component instantiated in the test designs.
+    VLNV componentVLNV_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_PythonAPI::tst_PythonAPI()
+//-----------------------------------------------------------------------------
+tst_PythonAPI::tst_PythonAPI():
+messages_(),
+libraryDirectory_(),
+componentVLNV_(VLNV::COMPONENT, "TUT", "batch", "batchComponent", "1.0")
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PythonAPI::initTestCase()
+//-----------------------------------------------------------------------------
+void tst_PythonAPI::initTestCase()
+{
+    QStandardPaths::setTestModeEnabled(true);
+    QVERIFY(libraryDirectory_.isValid());
+
+    KactusAPI core(&messages_);
+
+    QSharedPointer<Component> component(new Component(componentVLNV_, Document::Revision::Std22));
+
+    QSharedPointer<Port> outPort(new Port("dataOut"));
+    outPort->setDirection(DirectionTypes::OUT);
+    component->getPorts()->append(outPort);
+
+    QSharedPointer<Port> inPort(new Port("dataIn"));
+    inPort->setDirection(DirectionTypes::IN);
+    component->getPorts()->append(inPort);
+
+    QVERIFY(KactusAPI::getLibrary()->writeModelToFile(libraryDirectory_.filePath("batchComponent"), component));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PythonAPI::testQueuedConnectionIsCreatedOnCommit()
+//-----------------------------------------------------------------------------
+void tst_PythonAPI::testQueuedConnectionIsCreatedOnCommit()
+{
+    VLNV designVLNV = createDesign("committed");
+
+    PythonAPI api;
+    QVERIFY(api.openDesign(designVLNV.toString().toStdString()));
+
+    api.beginBatch();
+    QVERIFY(api.isBatchActive());
+    QVERIFY(api.createAdHocConnection("sender", "dataOut", "receiver", "dataIn"));
+
+    QVERIFY(api.commitBatch().empty());
+    QVERIFY(api.isBatchActive() == false);
+
+    api.saveDesign();
+    QCOMPARE(adHocConnectionCount(designVLNV), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PythonAPI::testFailedConnectionsAreReported()
+//-----------------------------------------------------------------------------
+void tst_PythonAPI::testFailedConnectionsAreReported()
+{
+    VLNV designVLNV = createDesign("failed");
+
+    PythonAPI api;
+    QVERIFY(api.openDesign(designVLNV.toString().toStdString()));
+
+    api.beginBatch();
+    QVERIFY(api.createAdHocConnection("sender", "dataOut", "receiver", "dataIn"));
+    QVERIFY(api.createAdHocConnection("sender", "missingPort", "receiver", "dataIn"));
+    QVERIFY(api.createConnection("sender", "missingBus", "receiver", "missingBus"));
+
+    std::vector<std::string> failedConnections = api.commitBatch();
+
+    QCOMPARE(failedConnections.size(), size_t(2));
+    QCOMPARE(failedConnections.at(0), std::string("Ad hoc connection sender.missingPort - receiver.dataIn"));
+    QCOMPARE(failedConnections.at(1), std::string("Interconnection sender.missingBus - receiver.missingBus"));
+
+    api.saveDesign();
+    QCOMPARE(adHocConnectionCount(designVLNV), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PythonAPI::testConnectionWithoutDesignIsRejected()
+//-----------------------------------------------------------------------------
+void tst_PythonAPI::testConnectionWithoutDesignIsRejected()
+{
+    PythonAPI api;
+
+    api.beginBatch();
+    QVERIFY(api.createAdHocConnection("sender", "dataOut", "receiver", "dataIn") == false);
+    QVERIFY(api.createConnection("sender", "bus", "receiver", "bus") == false);
+
+    QVERIFY(api.commitBatch().empty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PythonAPI::testQueuedConnectionsAreSavedWithDesign()
+//-----------------------------------------------------------------------------
+void tst_PythonAPI::testQueuedConnectionsAreSavedWithDesign()
+{
+    VLNV designVLNV = createDesign("saved");
+
+    PythonAPI api;
+    QVERIFY(api.openDesign(designVLNV.toString().toStdString()));
+
+    api.beginBatch();
+    QVERIFY(api.createAdHocConnection("sender", "dataOut", "receiver", "dataIn"));
+
+    api.saveDesign();
+    QCOMPARE(adHocConnectionCount(designVLNV), 1);
+
+    QVERIFY(api.isBatchActive());
+    QVERIFY(api.commitBatch().empty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PythonAPI::testDesignChangeCreatesQueuedConnections()
+//-----------------------------------------------------------------------------
+void tst_PythonAPI::testDesignChangeCreatesQueuedConnections()
+{
+    VLNV firstVLNV = createDesign("firstOpened");
+    VLNV secondVLNV = createDesign("secondOpened");
+
+    PythonAPI api;
+    QVERIFY(api.openDesign(firstVLNV.toString().toStdString()));
+
+    api.beginBatch();
+    QVERIFY(api.createAdHocConnection("sender", "missingPort", "receiver", "dataIn"));
+
+    // The connection queued for the first design is not created into the second one.
+    QVERIFY(api.openDesign(secondVLNV.toString().toStdString()));
+    QVERIFY(api.createAdHocConnection("sender", "dataOut", "receiver", "dataIn"));
+
+    std::vector<std::string> failedConnections = api.commitBatch();
+    QCOMPARE(failedConnections.size(), size_t(1));
+    QCOMPARE(failedConnections.front(), std::string("Ad hoc connection sender.missingPort - receiver.dataIn"));
+
+    api.saveDesign();
+    QCOMPARE(adHocConnectionCount(secondVLNV), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PythonAPI::testClosedDesignCreatesQueuedConnections()
+//-----------------------------------------------------------------------------
+void tst_PythonAPI::testClosedDesignCreatesQueuedConnections()
+{
+    VLNV designVLNV = createDesign("closed");
+
+    PythonAPI api;
+    QVERIFY(api.openDesign(designVLNV.toString().toStdString()));
+
+    api.beginBatch();
+    QVERIFY(api.createAdHocConnection("receiver", "dataIn", "sender", "missingPort"));
+
+    api.closeOpenDesign();
+
+    std::vector<std::string> failedConnections = api.commitBatch();
+    QCOMPARE(failedConnections.size(), size_t(1));
+    QCOMPARE(failedConnections.front(), std::string("Ad hoc connection receiver.dataIn - sender.missingPort"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PythonAPI::testDiscardedConnectionsAreNotCreated()
+//-----------------------------------------------------------------------------
+void tst_PythonAPI::testDiscardedConnectionsAreNotCreated()
+{
+    VLNV designVLNV = createDesign("discarded");
+
+    PythonAPI api;
+    QVERIFY(api.openDesign(designVLNV.toString().toStdString()));
+
+    api.beginBatch();
+    QVERIFY(api.createAdHocConnection("sender", "dataOut", "receiver", "dataIn"));
+    QVERIFY(api.createAdHocConnection("sender", "missingPort", "receiver", "dataIn"));
+
+    api.discardBatch();
+    QVERIFY(api.isBatchActive() == false);
+    QVERIFY(api.commitBatch().empty());
+
+    api.saveDesign();
+    QCOMPARE(adHocConnectionCount(designVLNV), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PythonAPI::createDesign()
+//-----------------------------------------------------------------------------
+VLNV tst_PythonAPI::createDesign(QString const& name)
+{
+    VLNV designVLNV(VLNV::DESIGN, "TUT", "batch", name, "1.0");
+
+    QSharedPointer<Design> design(new Design(designVLNV, Document::Revision::Std22));
+
+    QSharedPointer<ConfigurableVLNVReference> componentReference(new ConfigurableVLNVReference(componentVLNV_));
+    design->getComponentInstances()->append(QSharedPointer<ComponentInstance>(
+        new ComponentInstance("sender", componentReference)));
+    design->getComponentInstances()->append(QSharedPointer<ComponentInstance>(
+        new ComponentInstance("receiver", componentReference)));
+
+    KactusAPI::getLibrary()->writeModelToFile(libraryDirectory_.filePath(name), design);
+
+    return designVLNV;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PythonAPI::adHocConnectionCount()
+//-----------------------------------------------------------------------------
+int tst_PythonAPI::adHocConnectionCount(VLNV const& designVLNV) const
+{
+    QSharedPointer<Design const> design = KactusAPI::getLibrary()->getModelReadOnly<Design>(designVLNV);
+    if (design.isNull())
+    {
+        return -1;
+    }
+
+    return design->getAdHocConnections()->size();
+}
+
+QTEST_MAIN(tst_PythonAPI)
+
+#include "tst_PythonAPI.moc"
@@ -0,0 +1,8 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../PythonAPI/PythonAPI.h \
+    ../../PythonAPI/pythonapi_global.h
+SOURCES += ../../PythonAPI/PythonAPI.cpp \
+    ./tst_PythonAPI.cpp
@@ -15,6 +15,7 @@ CONFIG += testcase
 
 SUBDIRS += IPXACTmodels/IPXACTmodels.pro \
 		KactusAPI/KactusAPI.pro \
+		PythonAPI/PythonAPI.pro \
 		Core/Core.pro \
 		Plugins/Plugins.pro
         